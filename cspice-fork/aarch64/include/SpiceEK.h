@@ -319,6 +319,11 @@
       
 -Version
 
+   -CSPICE Version 2.1.0
+
+      Added SPICE_EK_MAXQPRM, the maximum number of parameter
+      placeholders in a prepared query.
+
    -CSPICE Version 2.0.0 27-JUL-2002 (NJB) 
    
       Defined SpiceEKDataType using SpiceDataType.  Removed declaration
@@ -384,6 +389,7 @@
    #define  SPICE_EK_MAXQNUM                100
    #define  SPICE_EK_MAXQCLN                SPICE_EK_MAXQRY
    #define  SPICE_EK_MAXQSTR                1024
+   #define  SPICE_EK_MAXQPRM                SPICE_EK_MAXQNUM
    
    
    
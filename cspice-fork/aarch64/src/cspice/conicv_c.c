@@ -0,0 +1,363 @@
+/*
+
+-Procedure conicv_c ( Determine states from many conic elements )
+
+-Abstract
+
+   Determine the states of many orbiting bodies from conic elements,
+   at one epoch.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   None.
+
+-Keywords
+
+   CONIC
+   EPHEMERIS
+
+*/
+
+   #include <math.h>
+   #include <stdlib.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+
+
+   void conicv_c ( SpiceInt            n,
+                   ConstSpiceDouble    elts   [][8],
+                   SpiceDouble         et,
+                   SpiceDouble         states [][6] )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   n          I   Number of element sets
+   elts       I   Conic elements
+   et         I   Input time
+   states     O   States of the orbiting bodies at `et'
+
+-Detailed_Input
+
+   n           is the number of element sets.
+
+   elts        is an array of `n' sets of conic elements, each as for
+               conics_c.
+
+   et          is the epoch, in seconds past J2000 TDB, at which the
+               states are to be determined.
+
+-Detailed_Output
+
+   states      is an array of `n' states. states[i] is exactly the
+               state conics_c would produce from elts[i] and `et'.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `n' is negative, the error SPICE(INVALIDCOUNT) is
+       signaled.
+
+   2)  If the eccentricity of an element set is negative, the error
+       SPICE(BADECCENTRICITY) is signaled.
+
+   3)  If the periapse distance of an element set is not positive,
+       the error SPICE(BADPERIAPSEVALUE) is signaled.
+
+   4)  If the gravitational parameter of an element set is not
+       positive, the error SPICE(BADGM) is signaled.
+
+   5)  If the state of an element set cannot be propagated, an error
+       is signaled as by prop2v_c.
+
+   6)  If memory for the intermediate states cannot be allocated,
+       the error SPICE(MALLOCFAILED) is signaled.
+
+   No states are computed if any element set is invalid.
+
+-Files
+
+   None.
+
+-Particulars
+
+   conics_c constructs the state at periapse for its element set and
+   propagates it with prop2b_c. This routine constructs the periapse
+   states of all the element sets first, and then propagates them
+   together in the same way as prop2v_c.
+
+-Examples
+
+   1)    /.
+         Determine the states of `n' bodies at `et'.
+         ./
+         conicv_c ( n, elts, et, states );
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0, 16-OCT-2026
+
+-Index_Entries
+
+   state of many bodies from conic elements
+
+-&
+*/
+
+{ /* Begin conicv_c */
+
+   /*
+   Local constants
+   */
+   static integer          each   = 1;
+
+   /*
+   f2c library function
+   */
+   double                  d_mod ( doublereal *, doublereal * );
+
+   /*
+   Local variables
+   */
+   SpiceDouble           * buffer;
+   SpiceDouble           * gm;
+   SpiceDouble           * dt;
+   SpiceDouble           * pstate;
+   SpiceDouble           * pvprop;
+   SpiceDouble             ainvrs;
+   SpiceDouble             argp;
+   SpiceDouble             basisp [3];
+   SpiceDouble             basisq [3];
+   SpiceDouble             cnci;
+   SpiceDouble             cosi;
+   SpiceDouble             cosn;
+   SpiceDouble             cosw;
+   SpiceDouble             d__1;
+   SpiceDouble             ecc;
+   SpiceDouble             inc;
+   SpiceDouble             lnode;
+   SpiceDouble             m0;
+   SpiceDouble             mean;
+   SpiceDouble             period;
+   SpiceDouble             rp;
+   SpiceDouble             sini;
+   SpiceDouble             sinn;
+   SpiceDouble             sinw;
+   SpiceDouble             snci;
+   SpiceDouble             t0;
+   SpiceDouble             v;
+   SpiceInt                i;
+   SpiceInt                k;
+   integer                 code;
+   integer                 fail;
+   integer                 nn;
+
+
+   /*
+   Participate in error tracing.
+   */
+   chkin_c ( "conicv_c" );
+
+   if ( n < 0 )
+   {
+      setmsg_c ( "The number of element sets must be non-negative "
+                 "but was #."                                       );
+      errint_c ( "#", n                                             );
+      sigerr_c ( "SPICE(INVALIDCOUNT)"                              );
+      chkout_c ( "conicv_c"                                         );
+      return;
+   }
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      if ( elts[i][1] < 0. )
+      {
+         setmsg_c ( "The eccentricity of the element set at index # "
+                    "was negative. Only positive values are "
+                    "meaningful. The value was #."                    );
+         errint_c ( "#", i                                            );
+         errdp_c  ( "#", elts[i][1]                                   );
+         sigerr_c ( "SPICE(BADECCENTRICITY)"                          );
+         chkout_c ( "conicv_c"                                        );
+         return;
+      }
+
+      if ( elts[i][0] <= 0. )
+      {
+         setmsg_c ( "The periapse range of the element set at index # "
+                    "was non-positive. Only positive values are "
+                    "allowed. The value was #."                         );
+         errint_c ( "#", i                                              );
+         errdp_c  ( "#", elts[i][0]                                     );
+         sigerr_c ( "SPICE(BADPERIAPSEVALUE)"                           );
+         chkout_c ( "conicv_c"                                          );
+         return;
+      }
+
+      if ( elts[i][7] <= 0. )
+      {
+         setmsg_c ( "The GM of the element set at index # was "
+                    "non-positive. Only positive values are "
+                    "allowed. The value was #."                  );
+         errint_c ( "#", i                                       );
+         errdp_c  ( "#", elts[i][7]                              );
+         sigerr_c ( "SPICE(BADGM)"                               );
+         chkout_c ( "conicv_c"                                   );
+         return;
+      }
+   }
+
+   if ( n == 0 )
+   {
+      chkout_c ( "conicv_c" );
+      return;
+   }
+
+   /*
+   The periapse states and the propagated states are stored as
+   structures of arrays, followed by the GM and time offset of each
+   element set.
+   */
+   buffer = (SpiceDouble *) malloc ( 14 * n * sizeof(SpiceDouble) );
+
+   if ( buffer == NULL )
+   {
+      setmsg_c ( "Could not allocate memory for # element sets." );
+      errint_c ( "#", n                                          );
+      sigerr_c ( "SPICE(MALLOCFAILED)"                           );
+      chkout_c ( "conicv_c"                                      );
+      return;
+   }
+
+   pstate = buffer;
+   pvprop = buffer + 6 * n;
+   gm     = buffer + 12 * n;
+   dt     = buffer + 13 * n;
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      /*
+      Construct the state at periapse and the time since periapse
+      as conics_c does.
+      */
+      rp    = elts[i][0];
+      ecc   = elts[i][1];
+      inc   = elts[i][2];
+      lnode = elts[i][3];
+      argp  = elts[i][4];
+      m0    = elts[i][5];
+      t0    = elts[i][6];
+      gm[i] = elts[i][7];
+
+      cosi = cos( inc );
+      sini = sin( inc );
+      cosn = cos( lnode );
+      sinn = sin( lnode );
+      cosw = cos( argp );
+      sinw = sin( argp );
+      snci = sinn * cosi;
+      cnci = cosn * cosi;
+
+      basisp[0] =  cosn * cosw - snci * sinw;
+      basisp[1] =  sinn * cosw + cnci * sinw;
+      basisp[2] =  sini * sinw;
+
+      basisq[0] = -cosn * sinw - snci * cosw;
+      basisq[1] = -sinn * sinw + cnci * cosw;
+      basisq[2] =  sini * cosw;
+
+      v = sqrt( gm[i] * ( ecc + 1. ) / rp );
+
+      for ( k = 0;  k < 3;  k++ )
+      {
+         pstate[  k    * n + i ] = rp * basisp[k];
+         pstate[ (k+3) * n + i ] = v  * basisq[k];
+      }
+
+      if ( ecc < 1. )
+      {
+         ainvrs = ( 1. - ecc ) / rp;
+         mean   = sqrt( gm[i] * ainvrs ) * ainvrs;
+         period = twopi_() / mean;
+         d__1   = et - t0 + m0 / mean;
+         dt[i]  = d_mod( &d__1, &period );
+      }
+      else if ( ecc > 1. )
+      {
+         ainvrs = ( ecc - 1. ) / rp;
+         mean   = sqrt( gm[i] * ainvrs ) * ainvrs;
+         dt[i]  = et - t0 + m0 / mean;
+      }
+      else
+      {
+         mean   = sqrt( gm[i] / ( rp * 2. ) ) / rp;
+         dt[i]  = et - t0 + m0 / mean;
+      }
+   }
+
+   nn = n;
+
+   zzprop2v_ ( &nn, &nn, gm, &each, pstate, dt, &each, pvprop, &fail, &code );
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      for ( k = 0;  k < 6;  k++ )
+      {
+         states[i][k] = pvprop[ k * n + i ];
+      }
+   }
+
+   free ( buffer );
+
+   if ( fail != 0 )
+   {
+      zzp2verr_ ( &fail, &code );
+   }
+
+   chkout_c ( "conicv_c" );
+
+} /* End conicv_c */
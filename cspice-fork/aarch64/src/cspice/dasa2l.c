@@ -3,6 +3,7 @@
 	-lf2c -lm   (in that order)
 */
 
+#include <stdlib.h>
 #include "f2c.h"
 
 /* Table of constant values */
@@ -11,6 +12,325 @@ static integer c__1 = 1;
 static integer c__256 = 256;
 static integer c__2 = 2;
 
+/* File table. Entries are added for each DAS file for which an */
+/* address is mapped, and removed by ZZDASA2C when the file is */
+/* closed. The arrays TBBASE, TBSIZE and TBMXAD are dimensioned */
+/* (3, TBCAP). */
+
+/* For read-only files that are not segregated, TBMAP contains a */
+/* map of the clusters of each data type: for each cluster, in */
+/* order of address, the highest address the cluster can contain, */
+/* its base record and its size. TBNMAP is dimensioned (3, TBCAP) */
+/* and contains the number of clusters of each type. */
+
+static integer tbcap = 0;
+static integer nfiles = 0;
+static integer *tbhan = 0, *tbfwrd = 0, *tbbase = 0, *tbsize = 0, *tbmxad = 
+	0, *tbnmap = 0;
+static logical *tbrdon = 0, *tbfast = 0;
+static integer **tbmap = 0;
+
+/* Hash table of file table indices, keyed by handle. Empty slots */
+/* contain zero. */
+
+static integer hshsiz = 0;
+static integer *hshtab = 0;
+
+/* FIDX is the file table index of the file of the previous call; */
+/* PRVOK indicates that the previous call succeeded. */
+
+static integer fidx = 0;
+static logical prvok = FALSE_;
+
+static integer zzdashsh(integer handle)
+{
+    return (integer) (((unsigned long) handle * 2654435761UL) & (unsigned 
+	    long) (hshsiz - 1));
+}
+
+/* Rebuild the hash table, with at least twice as many slots as */
+/* there are file table entries. */
+
+static logical zzdasrhs(void)
+{
+    integer i__, h__, newsiz;
+    integer *newtab;
+
+    newsiz = hshsiz > 0 ? hshsiz : 64;
+    while (newsiz < tbcap << 1) {
+	newsiz <<= 1;
+    }
+    if (newsiz != hshsiz) {
+	newtab = (integer *) malloc(newsiz * sizeof(integer));
+	if (newtab == 0) {
+	    return FALSE_;
+	}
+	free(hshtab);
+	hshtab = newtab;
+	hshsiz = newsiz;
+    }
+    for (i__ = 0; i__ < hshsiz; ++i__) {
+	hshtab[i__] = 0;
+    }
+    for (i__ = 1; i__ <= nfiles; ++i__) {
+	h__ = zzdashsh(tbhan[i__ - 1]);
+	while (hshtab[h__] != 0) {
+	    h__ = (h__ + 1) & (hshsiz - 1);
+	}
+	hshtab[h__] = i__;
+    }
+    return TRUE_;
+}
+
+/* Return the file table index of HANDLE, or zero if there is none. */
+
+static integer zzdasfnd(integer handle)
+{
+    integer h__;
+
+    if (hshsiz == 0) {
+	return 0;
+    }
+    h__ = zzdashsh(handle);
+    while (hshtab[h__] != 0) {
+	if (tbhan[hshtab[h__] - 1] == handle) {
+	    return hshtab[h__];
+	}
+	h__ = (h__ + 1) & (hshsiz - 1);
+    }
+    return 0;
+}
+
+/* Free the cluster maps of file table entry FIDX. */
+
+static void zzdasfmp(integer fidx)
+{
+    integer j;
+
+    for (j = 1; j <= 3; ++j) {
+	free(tbmap[j + fidx * 3 - 4]);
+	tbmap[j + fidx * 3 - 4] = 0;
+	tbnmap[j + fidx * 3 - 4] = 0;
+    }
+}
+
+/* Add a file table entry for HANDLE, enlarging the table if */
+/* necessary, and return its index. Zero is returned if memory */
+/* could not be allocated. */
+
+static integer zzdasadd(integer handle)
+{
+    integer h__, j, newcap;
+    void *p[9];
+    logical ok;
+
+    if (nfiles == tbcap) {
+	newcap = tbcap > 0 ? tbcap << 1 : 20;
+	p[0] = realloc(tbhan, newcap * sizeof(integer));
+	if (p[0] != 0) {
+	    tbhan = (integer *) p[0];
+	}
+	p[1] = realloc(tbfwrd, newcap * sizeof(integer));
+	if (p[1] != 0) {
+	    tbfwrd = (integer *) p[1];
+	}
+	p[2] = realloc(tbbase, newcap * 3 * sizeof(integer));
+	if (p[2] != 0) {
+	    tbbase = (integer *) p[2];
+	}
+	p[3] = realloc(tbsize, newcap * 3 * sizeof(integer));
+	if (p[3] != 0) {
+	    tbsize = (integer *) p[3];
+	}
+	p[4] = realloc(tbmxad, newcap * 3 * sizeof(integer));
+	if (p[4] != 0) {
+	    tbmxad = (integer *) p[4];
+	}
+	p[5] = realloc(tbnmap, newcap * 3 * sizeof(integer));
+	if (p[5] != 0) {
+	    tbnmap = (integer *) p[5];
+	}
+	p[6] = realloc(tbrdon, newcap * sizeof(logical));
+	if (p[6] != 0) {
+	    tbrdon = (logical *) p[6];
+	}
+	p[7] = realloc(tbfast, newcap * sizeof(logical));
+	if (p[7] != 0) {
+	    tbfast = (logical *) p[7];
+	}
+	p[8] = realloc(tbmap, newcap * 3 * sizeof(integer *));
+	if (p[8] != 0) {
+	    tbmap = (integer **) p[8];
+	}
+
+/*        Arrays that were enlarged successfully remain so; the */
+/*        capacity is only increased once all of them have been. */
+
+	ok = TRUE_;
+	for (j = 0; j < 9; ++j) {
+	    ok = ok && p[j] != 0;
+	}
+	if (! ok) {
+	    return 0;
+	}
+	tbcap = newcap;
+	if (! zzdasrhs()) {
+	    return 0;
+	}
+    }
+    ++nfiles;
+    tbhan[nfiles - 1] = handle;
+    tbrdon[nfiles - 1] = FALSE_;
+    tbfast[nfiles - 1] = FALSE_;
+    tbfwrd[nfiles - 1] = -1;
+    for (j = 1; j <= 3; ++j) {
+	tbbase[j + nfiles * 3 - 4] = -1;
+	tbsize[j + nfiles * 3 - 4] = -1;
+	tbmxad[j + nfiles * 3 - 4] = -1;
+	tbmap[j + nfiles * 3 - 4] = 0;
+	tbnmap[j + nfiles * 3 - 4] = 0;
+    }
+    h__ = zzdashsh(handle);
+    while (hshtab[h__] != 0) {
+	h__ = (h__ + 1) & (hshsiz - 1);
+    }
+    hshtab[h__] = nfiles;
+    return nfiles;
+}
+
+/* Remove file table entry FIDX. The last entry takes its place. */
+
+static void zzdasrem(integer fidx)
+{
+    integer j;
+
+    zzdasfmp(fidx);
+    if (fidx < nfiles) {
+	tbhan[fidx - 1] = tbhan[nfiles - 1];
+	tbrdon[fidx - 1] = tbrdon[nfiles - 1];
+	tbfast[fidx - 1] = tbfast[nfiles - 1];
+	tbfwrd[fidx - 1] = tbfwrd[nfiles - 1];
+	for (j = 1; j <= 3; ++j) {
+	    tbbase[j + fidx * 3 - 4] = tbbase[j + nfiles * 3 - 4];
+	    tbsize[j + fidx * 3 - 4] = tbsize[j + nfiles * 3 - 4];
+	    tbmxad[j + fidx * 3 - 4] = tbmxad[j + nfiles * 3 - 4];
+	    tbmap[j + fidx * 3 - 4] = tbmap[j + nfiles * 3 - 4];
+	    tbnmap[j + fidx * 3 - 4] = tbnmap[j + nfiles * 3 - 4];
+	    tbmap[j + nfiles * 3 - 4] = 0;
+	    tbnmap[j + nfiles * 3 - 4] = 0;
+	}
+    }
+    --nfiles;
+    zzdasrhs();
+    prvok = FALSE_;
+}
+
+/* Build the cluster maps of file table entry FIDX by reading each */
+/* of the file's directory records, starting with record FIRST. */
+/* If memory cannot be allocated, the file is left without maps. */
+
+static void zzdasbld(integer *handle, integer fidx, integer first)
+{
+    static integer c__1 = 1;
+    static integer c__256 = 256;
+    static integer next[3] = { 2,3,1 };
+    static integer prev[3] = { 3,1,2 };
+    static integer nw[3] = { 1024,128,256 };
+    static integer rngloc[3] = { 3,5,7 };
+    extern logical failed_(void);
+    extern /* Subroutine */ int dasrri_(integer *, integer *, integer *, 
+	    integer *, integer *);
+    integer dirrec[256], cap[3], hiaddr[3], nrec, clbase, dscloc, prvtyp, 
+	    curtyp, size, j, n;
+    integer *m;
+
+    for (j = 0; j < 3; ++j) {
+	cap[j] = 0;
+    }
+    nrec = first;
+    while (nrec > 0) {
+	dasrri_(handle, &nrec, &c__1, &c__256, dirrec);
+	if (failed_()) {
+	    zzdasfmp(fidx);
+	    return;
+	}
+	if (dirrec[8] < 1 || dirrec[8] > 3) {
+
+/*           The directory describes no clusters. Addresses not */
+/*           covered by the maps are found by reading directories. */
+
+	    return;
+	}
+	for (j = 0; j < 3; ++j) {
+	    hiaddr[j] = dirrec[rngloc[j] - 1] - 1;
+	}
+	clbase = nrec + 1;
+	prvtyp = prev[dirrec[8] - 1];
+	for (dscloc = 10; dscloc <= 256 && dirrec[dscloc - 1] != 0; ++dscloc) 
+		{
+	    if (dirrec[dscloc - 1] > 0) {
+		curtyp = next[prvtyp - 1];
+		size = dirrec[dscloc - 1];
+	    } else {
+		curtyp = prev[prvtyp - 1];
+		size = -dirrec[dscloc - 1];
+	    }
+	    prvtyp = curtyp;
+	    hiaddr[curtyp - 1] += nw[curtyp - 1] * size;
+	    n = tbnmap[curtyp + fidx * 3 - 4];
+	    if (n == cap[curtyp - 1]) {
+		cap[curtyp - 1] = n > 0 ? n << 1 : 64;
+		m = (integer *) realloc(tbmap[curtyp + fidx * 3 - 4], cap[
+			curtyp - 1] * 3 * sizeof(integer));
+		if (m == 0) {
+		    zzdasfmp(fidx);
+		    return;
+		}
+		tbmap[curtyp + fidx * 3 - 4] = m;
+	    }
+	    m = tbmap[curtyp + fidx * 3 - 4] + n * 3;
+	    m[0] = hiaddr[curtyp - 1];
+	    m[1] = clbase;
+	    m[2] = size;
+	    tbnmap[curtyp + fidx * 3 - 4] = n + 1;
+	    clbase += size;
+	}
+	nrec = dirrec[1];
+    }
+}
+
+/* Look up the cluster of type TYPE containing ADDRSS in the cluster */
+/* map of file table entry FIDX. Return FALSE if it is not found. */
+
+static logical zzdasmlk(integer fidx, integer type__, integer addrss, 
+	integer *clbase, integer *clsize, integer *hiaddr)
+{
+    integer lo, hi, mid;
+    integer *m;
+
+    m = tbmap[type__ + fidx * 3 - 4];
+    lo = 0;
+    hi = tbnmap[type__ + fidx * 3 - 4];
+    if (m == 0) {
+	return FALSE_;
+    }
+    while (lo < hi) {
+	mid = lo + (hi - lo) / 2;
+	if (m[mid * 3] < addrss) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid;
+	}
+    }
+    if (lo == tbnmap[type__ + fidx * 3 - 4]) {
+	return FALSE_;
+    }
+    *hiaddr = m[lo * 3];
+    *clbase = m[lo * 3 + 1];
+    *clsize = m[lo * 3 + 2];
+    return TRUE_;
+}
+
 /* $Procedure DASA2L ( DAS, address to physical location ) */
 /* Subroutine */ int dasa2l_(integer *handle, integer *type__, integer *
 	addrss, integer *clbase, integer *clsize, integer *recno, integer *
@@ -19,35 +339,11 @@ static integer c__2 = 2;
     /* Initialized data */
 
     static integer next[3] = { 2,3,1 };
-    static logical prvok = FALSE_;
-    static integer tbbase[60]	/* was [3][20] */ = { -1,-1,-1,-1,-1,-1,-1,-1,
-	    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	    -1,-1,-1,-1,-1,-1,-1,-1 };
-    static logical tbfast[20] = { FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,
-	    FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,
-	    FALSE_,FALSE_,FALSE_,FALSE_,FALSE_ };
-    static integer tbfwrd[20] = { -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	    -1,-1,-1,-1,-1,-1 };
-    static integer tbhan[20] = { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 };
-    static integer tbmxad[60]	/* was [3][20] */ = { -1,-1,-1,-1,-1,-1,-1,-1,
-	    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	    -1,-1,-1,-1,-1,-1,-1,-1 };
-    static logical tbrdon[20] = { FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,
-	    FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,
-	    FALSE_,FALSE_,FALSE_,FALSE_,FALSE_ };
-    static integer tbsize[60]	/* was [3][20] */ = { -1,-1,-1,-1,-1,-1,-1,-1,
-	    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-	    -1,-1,-1,-1,-1,-1,-1,-1 };
     static integer prev[3] = { 3,1,2 };
     static integer nw[3] = { 1024,128,256 };
     static integer rngloc[3] = { 3,5,7 };
     static logical fast = FALSE_;
-    static integer fidx = 0;
     static logical known = FALSE_;
-    static integer nfiles = 0;
     static integer prvhan = 0;
 
     /* System generated locals */
@@ -58,13 +354,13 @@ static integer c__2 = 2;
 	    ftnlen, ftnlen);
 
     /* Local variables */
-    static integer free, nrec, i__, j, range[2];
+    static integer free, nrec, i__, range[2];
     extern /* Subroutine */ int chkin_(char *, ftnlen);
     static integer ncomc;
     static logical segok;
     static integer ncomr, ndirs;
     extern logical failed_(void);
-    static integer ub, hiaddr;
+    static integer hiaddr;
     extern /* Subroutine */ int dasham_(integer *, char *, ftnlen);
     static integer baserc;
     static char access[10];
@@ -73,7 +369,6 @@ static integer c__2 = 2;
 	    integer *, integer *, integer *, integer *, integer *, integer *);
     static logical samfil;
     static integer mxaddr;
-    extern integer isrchi_(integer *, integer *, integer *);
     static integer lstrec[3];
     extern /* Subroutine */ int errhan_(char *, integer *, ftnlen), sigerr_(
 	    char *, ftnlen);
@@ -336,6 +631,15 @@ static integer c__2 = 2;
 
 /* $ Version */
 
+/* -    SPICELIB Version 4.0.0, 16-OCT-2026 */
+
+/*        The file table is no longer limited to 20 files; entries are */
+/*        found by hashing and are removed when files are closed. For */
+/*        read-only files that are not segregated, a map of all */
+/*        clusters is built when the file is first seen, and addresses */
+/*        are found in it by binary search rather than by reading */
+/*        directory records. */
+
 /* -    SPICELIB Version 3.0.1, 12-AUG-2021 (JDR) */
 
 /*        Edited the header to comply with NAIF standard. Removed */
@@ -702,11 +1006,11 @@ static integer c__2 = 2;
 	if (samfil) {
 	    known = TRUE_;
 	} else {
-	    fidx = isrchi_(handle, &nfiles, tbhan);
+	    fidx = zzdasfnd(*handle);
 	    known = fidx > 0;
 	}
 	if (known) {
-	    fast = tbfast[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
+	    fast = tbfast[(i__1 = fidx - 1) < tbcap && 0 <= i__1 ? i__1 : s_rnge(
 		    "tbfast", i__1, "dasa2l_", (ftnlen)770)];
 	} else {
 
@@ -719,57 +1023,18 @@ static integer c__2 = 2;
 /*           Note that unused entries (those for which the DAS handle is */
 /*           0) will drop out of the list automatically. */
 
-	    ub = min(nfiles,19);
-	    for (i__ = ub; i__ >= 1; --i__) {
-		tbhan[(i__1 = i__) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbhan", 
-			i__1, "dasa2l_", (ftnlen)787)] = tbhan[(i__2 = i__ - 
-			1) < 20 && 0 <= i__2 ? i__2 : s_rnge("tbhan", i__2, 
-			"dasa2l_", (ftnlen)787)];
-		tbrdon[(i__1 = i__) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbrdon"
-			, i__1, "dasa2l_", (ftnlen)788)] = tbrdon[(i__2 = i__ 
-			- 1) < 20 && 0 <= i__2 ? i__2 : s_rnge("tbrdon", i__2,
-			 "dasa2l_", (ftnlen)788)];
-		tbfast[(i__1 = i__) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbfast"
-			, i__1, "dasa2l_", (ftnlen)789)] = tbfast[(i__2 = i__ 
-			- 1) < 20 && 0 <= i__2 ? i__2 : s_rnge("tbfast", i__2,
-			 "dasa2l_", (ftnlen)789)];
-		tbfwrd[(i__1 = i__) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbfwrd"
-			, i__1, "dasa2l_", (ftnlen)790)] = tbfwrd[(i__2 = i__ 
-			- 1) < 20 && 0 <= i__2 ? i__2 : s_rnge("tbfwrd", i__2,
-			 "dasa2l_", (ftnlen)790)];
-		for (j = 1; j <= 3; ++j) {
-		    tbbase[(i__1 = j + (i__ + 1) * 3 - 4) < 60 && 0 <= i__1 ? 
-			    i__1 : s_rnge("tbbase", i__1, "dasa2l_", (ftnlen)
-			    793)] = tbbase[(i__2 = j + i__ * 3 - 4) < 60 && 0 
-			    <= i__2 ? i__2 : s_rnge("tbbase", i__2, "dasa2l_",
-			     (ftnlen)793)];
-		    tbsize[(i__1 = j + (i__ + 1) * 3 - 4) < 60 && 0 <= i__1 ? 
-			    i__1 : s_rnge("tbsize", i__1, "dasa2l_", (ftnlen)
-			    794)] = tbsize[(i__2 = j + i__ * 3 - 4) < 60 && 0 
-			    <= i__2 ? i__2 : s_rnge("tbsize", i__2, "dasa2l_",
-			     (ftnlen)794)];
-		    tbmxad[(i__1 = j + (i__ + 1) * 3 - 4) < 60 && 0 <= i__1 ? 
-			    i__1 : s_rnge("tbmxad", i__1, "dasa2l_", (ftnlen)
-			    795)] = tbmxad[(i__2 = j + i__ * 3 - 4) < 60 && 0 
-			    <= i__2 ? i__2 : s_rnge("tbmxad", i__2, "dasa2l_",
-			     (ftnlen)795)];
-		}
+	    fidx = zzdasadd(*handle);
+	    if (fidx == 0) {
+		chkin_("DASA2L", (ftnlen)6);
+		setmsg_("Memory for the address map of DAS file # could not "
+			"be allocated.", (ftnlen)64);
+		errhan_("#", handle, (ftnlen)1);
+		sigerr_("SPICE(MALLOCFAILED)", (ftnlen)19);
+		chkout_("DASA2L", (ftnlen)6);
+		return 0;
 	    }
-
-/*           Insert the new table entry at index 1. */
-
-/* Computing MIN */
-	    i__1 = nfiles + 1;
-	    nfiles = min(i__1,20);
-	    fidx = 1;
-	    tbhan[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbhan",
-		     i__1, "dasa2l_", (ftnlen)804)] = *handle;
-
-/*           Set FAST to .FALSE. until we find out whether the file */
-/*           is read-only and segregated. */
-
 	    fast = FALSE_;
-	    tbfast[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbfa"
+	    tbfast[(i__1 = fidx - 1) < tbcap && 0 <= i__1 ? i__1 : s_rnge("tbfa"
 		    "st", i__1, "dasa2l_", (ftnlen)810)] = fast;
 
 /*           FIDX is now set whether or not the current file is known. */
@@ -787,14 +1052,13 @@ static integer c__2 = 2;
 /*              Make sure the current table entry won't be found */
 /*              on a subsequent search. */
 
-		tbhan[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
-			"tbhan", i__1, "dasa2l_", (ftnlen)828)] = 0;
+		zzdasrem(fidx);
 		return 0;
 	    }
 
 /*           TBRDON(FIDX) indicates whether the file is read-only. */
 
-	    tbrdon[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbrd"
+	    tbrdon[(i__1 = fidx - 1) < tbcap && 0 <= i__1 ? i__1 : s_rnge("tbrd"
 		    "on", i__1, "dasa2l_", (ftnlen)836)] = s_cmp(access, "READ"
 		    , (ftnlen)10, (ftnlen)4) == 0;
 	}
@@ -803,7 +1067,7 @@ static integer c__2 = 2;
 
 /*        Get the file summary if it isn't known already. */
 
-	if (! (known && tbrdon[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : 
+	if (! (known && tbrdon[(i__1 = fidx - 1) < tbcap && 0 <= i__1 ? i__1 : 
 		s_rnge("tbrdon", i__1, "dasa2l_", (ftnlen)845)])) {
 
 /*           The file is new or it's writable; in either case the */
@@ -811,21 +1075,20 @@ static integer c__2 = 2;
 /*           range for the file. */
 
 	    dashfs_(handle, &nresvr, &nresvc, &ncomr, &ncomc, &free, &tbmxad[(
-		    i__1 = fidx * 3 - 3) < 60 && 0 <= i__1 ? i__1 : s_rnge(
+		    i__1 = fidx * 3 - 3) < tbcap * 3 && 0 <= i__1 ? i__1 : s_rnge(
 		    "tbmxad", i__1, "dasa2l_", (ftnlen)851)], lstrec, lstwrd);
 	    if (failed_()) {
 
 /*              Make sure the current table entry won't be found */
 /*              on a subsequent search. */
 
-		tbhan[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
-			"tbhan", i__1, "dasa2l_", (ftnlen)866)] = 0;
+		zzdasrem(fidx);
 		return 0;
 	    }
 
 /*           Set the forward cluster pointer. */
 
-	    tbfwrd[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbfw"
+	    tbfwrd[(i__1 = fidx - 1) < tbcap && 0 <= i__1 ? i__1 : s_rnge("tbfw"
 		    "rd", i__1, "dasa2l_", (ftnlen)874)] = nresvr + ncomr + 2;
 	}
 
@@ -834,7 +1097,7 @@ static integer c__2 = 2;
 /*        If this is an unknown file and is read-only, determine */
 /*        whether the file is segregated */
 
-	if (! known && tbrdon[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : 
+	if (! known && tbrdon[(i__1 = fidx - 1) < tbcap && 0 <= i__1 ? i__1 : 
 		s_rnge("tbrdon", i__1, "dasa2l_", (ftnlen)884)]) {
 
 /*           The file is read-only; we need to know whether it is */
@@ -847,7 +1110,7 @@ static integer c__2 = 2;
 
 /*           NREC is the record number of the first directory record. */
 
-	    nrec = tbfwrd[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
+	    nrec = tbfwrd[(i__1 = fidx - 1) < tbcap && 0 <= i__1 ? i__1 : s_rnge(
 		    "tbfwrd", i__1, "dasa2l_", (ftnlen)896)];
 	    dasrri_(handle, &nrec, &c__1, &c__256, dirrec);
 	    nxtrec = dirrec[1];
@@ -862,7 +1125,7 @@ static integer c__2 = 2;
 
 		ntypes = 0;
 		for (i__ = 1; i__ <= 3; ++i__) {
-		    if (tbmxad[(i__1 = i__ + fidx * 3 - 4) < 60 && 0 <= i__1 ?
+		    if (tbmxad[(i__1 = i__ + fidx * 3 - 4) < tbcap * 3 && 0 <= i__1 ?
 			     i__1 : s_rnge("tbmxad", i__1, "dasa2l_", (ftnlen)
 			    915)] > 0) {
 			++ntypes;
@@ -893,21 +1156,21 @@ static integer c__2 = 2;
 				ftnlen)938)];
 		    }
 		    prvtyp = curtyp;
-		    tbbase[(i__1 = curtyp + fidx * 3 - 4) < 60 && 0 <= i__1 ? 
+		    tbbase[(i__1 = curtyp + fidx * 3 - 4) < tbcap * 3 && 0 <= i__1 ? 
 			    i__1 : s_rnge("tbbase", i__1, "dasa2l_", (ftnlen)
 			    942)] = baserc;
-		    tbsize[(i__1 = curtyp + fidx * 3 - 4) < 60 && 0 <= i__1 ? 
+		    tbsize[(i__1 = curtyp + fidx * 3 - 4) < tbcap * 3 && 0 <= i__1 ? 
 			    i__1 : s_rnge("tbsize", i__1, "dasa2l_", (ftnlen)
 			    943)] = (i__3 = dirrec[(i__2 = dscloc - 1) < 256 
 			    && 0 <= i__2 ? i__2 : s_rnge("dirrec", i__2, 
 			    "dasa2l_", (ftnlen)943)], abs(i__3));
-		    baserc += tbsize[(i__1 = curtyp + fidx * 3 - 4) < 60 && 0 
+		    baserc += tbsize[(i__1 = curtyp + fidx * 3 - 4) < tbcap * 3 && 0 
 			    <= i__1 ? i__1 : s_rnge("tbsize", i__1, "dasa2l_",
 			     (ftnlen)944)];
-		    segok = tbmxad[(i__1 = curtyp + fidx * 3 - 4) < 60 && 0 <=
+		    segok = tbmxad[(i__1 = curtyp + fidx * 3 - 4) < tbcap * 3 && 0 <=
 			     i__1 ? i__1 : s_rnge("tbmxad", i__1, "dasa2l_", (
 			    ftnlen)947)] <= tbsize[(i__2 = curtyp + fidx * 3 
-			    - 4) < 60 && 0 <= i__2 ? i__2 : s_rnge("tbsize", 
+			    - 4) < tbcap * 3 && 0 <= i__2 ? i__2 : s_rnge("tbsize", 
 			    i__2, "dasa2l_", (ftnlen)947)] * nw[(i__3 = 
 			    curtyp - 1) < 3 && 0 <= i__3 ? i__3 : s_rnge(
 			    "nw", i__3, "dasa2l_", (ftnlen)947)];
@@ -921,7 +1184,7 @@ static integer c__2 = 2;
 /*              Update FAST and TBFAST based on the segregation check. */
 
 		fast = segok;
-		tbfast[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
+		tbfast[(i__1 = fidx - 1) < tbcap && 0 <= i__1 ? i__1 : s_rnge(
 			"tbfast", i__1, "dasa2l_", (ftnlen)961)] = fast;
 
 /*              If the file is FAST, */
@@ -932,6 +1195,17 @@ static integer c__2 = 2;
 /*              have been updated as well. */
 
 	    }
+
+/*           If the file is not FAST, map all of its clusters, so that */
+/*           addresses can be found without reading its directories. */
+
+	    if (! fast) {
+		zzdasbld(handle, fidx, nrec);
+		if (failed_()) {
+		    zzdasrem(fidx);
+		    return 0;
+		}
+	    }
 	}
 
 /*        End of the segregation check. */
@@ -943,15 +1217,14 @@ static integer c__2 = 2;
 /*     At this point we have the logical address ranges for the */
 /*     file. Check the input address against them. */
 
-    mxaddr = tbmxad[(i__1 = *type__ + fidx * 3 - 4) < 60 && 0 <= i__1 ? i__1 :
+    mxaddr = tbmxad[(i__1 = *type__ + fidx * 3 - 4) < tbcap * 3 && 0 <= i__1 ? i__1 :
 	     s_rnge("tbmxad", i__1, "dasa2l_", (ftnlen)983)];
     if (*addrss < 1 || *addrss > mxaddr) {
 
 /*        Make sure the current table entry won't be found on a */
 /*        subsequent search. */
 
-	tbhan[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbhan", 
-		i__1, "dasa2l_", (ftnlen)990)] = 0;
+	zzdasrem(fidx);
 	chkin_("DASA2L", (ftnlen)6);
 	setmsg_("ADDRSS was #; valid range for type # is # to #.  File was #",
 		 (ftnlen)59);
@@ -969,17 +1242,23 @@ static integer c__2 = 2;
 /*     size. HIADDR is the highest address (not necessarily in use) in */
 /*     the cluster. */
 
-    if (tbfast[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbfast", 
+    if (tbfast[(i__1 = fidx - 1) < tbcap && 0 <= i__1 ? i__1 : s_rnge("tbfast", 
 	    i__1, "dasa2l_", (ftnlen)1011)]) {
 
 /*        The current file is "fast": read-only and segregated. */
 
-	*clbase = tbbase[(i__1 = *type__ + fidx * 3 - 4) < 60 && 0 <= i__1 ? 
+	*clbase = tbbase[(i__1 = *type__ + fidx * 3 - 4) < tbcap * 3 && 0 <= i__1 ? 
 		i__1 : s_rnge("tbbase", i__1, "dasa2l_", (ftnlen)1015)];
-	*clsize = tbsize[(i__1 = *type__ + fidx * 3 - 4) < 60 && 0 <= i__1 ? 
+	*clsize = tbsize[(i__1 = *type__ + fidx * 3 - 4) < tbcap * 3 && 0 <= i__1 ? 
 		i__1 : s_rnge("tbsize", i__1, "dasa2l_", (ftnlen)1016)];
 	hiaddr = *clsize * nw[(i__1 = *type__ - 1) < 3 && 0 <= i__1 ? i__1 : 
 		s_rnge("nw", i__1, "dasa2l_", (ftnlen)1017)];
+    } else if (zzdasmlk(fidx, *type__, *addrss, clbase, clsize, &hiaddr)) {
+
+/*        The current file is read-only but not segregated. The */
+/*        cluster containing the input address was found in its */
+/*        cluster map. */
+
     } else {
 
 /*        If we're not looking at a "fast" file, find the cluster */
@@ -995,7 +1274,7 @@ static integer c__2 = 2;
 /*        record that contains the address we're looking for, since */
 /*        we've already checked that the address is in range. */
 
-	nrec = tbfwrd[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
+	nrec = tbfwrd[(i__1 = fidx - 1) < tbcap && 0 <= i__1 ? i__1 : s_rnge(
 		"tbfwrd", i__1, "dasa2l_", (ftnlen)1034)];
 	ndirs = 1;
 	i__3 = rngloc[(i__2 = *type__ - 1) < 3 && 0 <= i__2 ? i__2 : s_rnge(
@@ -1023,8 +1302,7 @@ static integer c__2 = 2;
 /*              Make sure the current table entry won't be found */
 /*              on a subsequent search. */
 
-		tbhan[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
-			"tbhan", i__1, "dasa2l_", (ftnlen)1067)] = 0;
+		zzdasrem(fidx);
 		return 0;
 	    }
 	}
@@ -1045,8 +1323,7 @@ static integer c__2 = 2;
 /*           Make sure the current table entry won't be found on a */
 /*           subsequent search. */
 
-	    tbhan[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("tbhan",
-		     i__1, "dasa2l_", (ftnlen)1093)] = 0;
+	    zzdasrem(fidx);
 	    return 0;
 	}
 
@@ -1093,8 +1370,7 @@ static integer c__2 = 2;
 /*              Make sure the current table entry won't be found */
 /*              on a subsequent search. */
 
-		tbhan[(i__1 = fidx - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge(
-			"tbhan", i__1, "dasa2l_", (ftnlen)1144)] = 0;
+		zzdasrem(fidx);
 		chkin_("DASA2L", (ftnlen)6);
 		setmsg_("Directory record # in DAS file with handle # is pro"
 			"bably corrupted. No high cluster address at or above"
@@ -1208,3 +1484,18 @@ static integer c__2 = 2;
     return 0;
 } /* dasa2l_ */
 
+
+/* Remove the file table entry, if any, of the DAS file designated */
+/* by HANDLE. This is called when the file is closed. */
+
+/* Subroutine */ int zzdasa2c_(integer *handle)
+{
+    integer i__;
+
+    i__ = zzdasfnd(*handle);
+    if (i__ > 0) {
+	zzdasrem(i__);
+    }
+    return 0;
+} /* zzdasa2c_ */
+
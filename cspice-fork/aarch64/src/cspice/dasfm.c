@@ -661,7 +661,7 @@ static integer c__1 = 1;
     static integer last, pool[10012]	/* was [2][5006] */, type__;
     extern /* Subroutine */ int zzddhfnh_(char *, integer *, logical *, 
 	    ftnlen), zzddhcls_(integer *, char *, logical *, ftnlen), 
-	    zzddhhlu_(integer *, char *, logical *, integer *, ftnlen), 
+	    zzdasa2c_(integer *), zzddhhlu_(integer *, char *, logical *, integer *, ftnlen), 
 	    zzdasgri_(integer *, integer *, integer *), zzddhluh_(integer *, 
 	    integer *, logical *), zzddhopn_(char *, char *, char *, integer *
 	    , ftnlen, ftnlen, ftnlen), zzdasnfr_(integer *, char *, char *, 
@@ -5082,6 +5082,10 @@ L_dasllc:
 		chkout_("DASLLC", (ftnlen)6);
 		return 0;
 	    }
+
+/*           Discard the address map DASA2L holds for this file. */
+
+	    zzdasa2c_(handle);
 	    if (findex == fthead) {
 		fthead = lnknxt_(&findex, pool);
 	    }
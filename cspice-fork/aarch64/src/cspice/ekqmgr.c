@@ -3,15 +3,13 @@
 	-lf2c -lm   (in that order)
 */
 
+#include <stdlib.h>
+#include <string.h>
 #include "f2c.h"
 
 /* Table of constant values */
 
-static integer c__20 = 20;
-static integer c__200 = 200;
-static integer c__10000 = 10000;
 static integer c__500 = 500;
-static integer c__100 = 100;
 static integer c__24 = 24;
 static integer c__11 = 11;
 static integer c__10 = 10;
@@ -20,6 +18,265 @@ static integer c__1 = 1;
 static integer c__0 = 0;
 static integer c__11000 = 11000;
 
+/* Catalog tables.  Each table starts out with the size given by */
+/* the corresponding parameter (FTSIZE, STSIZE, the descriptor table */
+/* size, MXCLLD and MXTBLD) in statically allocated storage, and is */
+/* moved to larger dynamically allocated storage by ZZEKQGRW when */
+/* EKLEF runs out of room. TBFILS is dimensioned (FTSIZE, MXTBLD), so */
+/* it is rearranged whenever the file table grows. */
+
+
+#define FTTAB 1
+#define STTAB 2
+#define DTTAB 3
+#define CTTAB 4
+#define TBTAB 5
+
+static integer ftsize = 20;
+static integer stsize = 200;
+static integer dtsize = 10000;
+static integer ctsize = 500;
+static integer tbsize = 100;
+
+static integer fthan0[20], ftpool0[52], stpool0[412], sthan0[200], 
+	stsidx0[200], stdscs0[4800], stnrow0[200], stncol0[200], stdtpt0[
+	200], dtpool0[20012], dtdscs0[110000], ctpool0[1012], cttyps0[500]
+	, ctlens0[500], ctsizs0[500], ctclas0[500], tbpool0[212], tbstpt0[
+	100], tbncol0[100], tbctpt0[100], tbflsz0[100], tbfils0[2000];
+static logical ctfixd0[500], ctindx0[500], ctnull0[500];
+static char ctnams0[16000], tbnams0[6400];
+
+static integer *fthan = fthan0, *ftpool = ftpool0, *stpool = stpool0, *
+	sthan = sthan0, *stsidx = stsidx0, *stdscs = stdscs0, *stnrow = 
+	stnrow0, *stncol = stncol0, *stdtpt = stdtpt0, *dtpool = dtpool0, *
+	dtdscs = dtdscs0, *ctpool = ctpool0, *cttyps = cttyps0, *ctlens = 
+	ctlens0, *ctsizs = ctsizs0, *ctclas = ctclas0, *tbpool = tbpool0, *
+	tbstpt = tbstpt0, *tbncol = tbncol0, *tbctpt = tbctpt0, *tbflsz = 
+	tbflsz0, *tbfils = tbfils0;
+static logical *ctfixd = ctfixd0, *ctindx = ctindx0, *ctnull = ctnull0;
+static char *ctnams = ctnams0, *tbnams = tbnams0;
+
+/* Catalog generation. EKLEF and EKUEF advance it on every call, as */
+/* encoded queries refer to tables and columns by their positions in */
+/* the catalog. ZZEKQGEN returns it, so that queries compiled earlier */
+/* can tell whether those positions are still valid. */
+
+static integer ctgen = 0;
+
+
+/* Copy N bytes of OLD to a new zero-filled array of NEWSIZ bytes. */
+
+static void *zzekqcpy(void *old, size_t n, size_t newsiz)
+{
+    char *p;
+
+    p = (char *) malloc(newsiz);
+    if (p != 0) {
+	memcpy(p, old, n);
+	memset(p + n, 0, newsiz - n);
+    }
+    return p;
+}
+
+/* Release an array replaced by ZZEKQCPY, unless it is the initial */
+/* static array INIT. */
+
+static void zzekqrel(void *old, void *init)
+{
+    if (old != init) {
+	free(old);
+    }
+}
+
+/* Copy the linked list pool POOL of OLDSIZ nodes to a new pool of */
+/* NEWSIZ nodes. The new nodes are added to the head of the free */
+/* list. */
+
+static integer *zzekqpol(integer *pool, integer oldsiz, integer newsiz)
+{
+    integer *p, i__;
+
+    p = (integer *) malloc(((newsiz + 6) << 1) * sizeof(integer));
+    if (p == 0) {
+	return p;
+    }
+    memcpy(p, pool, ((oldsiz + 6) << 1) * sizeof(integer));
+    for (i__ = oldsiz + 1; i__ <= newsiz; ++i__) {
+	p[(i__ << 1) + 10] = i__ < newsiz ? i__ + 1 : pool[8];
+	p[(i__ << 1) + 11] = 0;
+    }
+    p[8] = oldsiz + 1;
+    p[10] = newsiz;
+    p[11] = pool[11] + newsiz - oldsiz;
+    return p;
+}
+
+/* Enlarge the catalog table TABLE so that at least NEED of its */
+/* entries are free. Return FALSE if memory for the enlarged table */
+/* could not be allocated, in which case the table is unchanged. */
+
+#define ZZEKQARR(ptr, type, n) \
+	((type *) zzekqcpy((ptr), (size_t)(oldsiz * (n)) * sizeof(type), \
+	(size_t)(newsiz * (n)) * sizeof(type)))
+
+static logical zzekqgrw(integer table, integer need)
+{
+    integer oldsiz, newsiz, nfree, i__, t;
+    integer *pool, *newpol = 0, *v1 = 0, *v2 = 0, *v3 = 0, *v4 = 0, *v5 = 
+	    0, *v6 = 0;
+    logical *l1 = 0, *l2 = 0, *l3 = 0;
+    char *c1 = 0;
+    logical ok;
+
+    switch (table) {
+	case FTTAB:  oldsiz = ftsize;  pool = ftpool;  break;
+	case STTAB:  oldsiz = stsize;  pool = stpool;  break;
+	case DTTAB:  oldsiz = dtsize;  pool = dtpool;  break;
+	case CTTAB:  oldsiz = ctsize;  pool = ctpool;  break;
+	default:     oldsiz = tbsize;  pool = tbpool;  break;
+    }
+    nfree = pool[11];
+    newsiz = oldsiz;
+    while (nfree + newsiz - oldsiz < need) {
+	newsiz <<= 1;
+    }
+    if (newsiz == oldsiz) {
+	return TRUE_;
+    }
+    newpol = zzekqpol(pool, oldsiz, newsiz);
+    switch (table) {
+	case FTTAB:
+	    v1 = ZZEKQARR(fthan, integer, 1);
+	    v2 = (integer *) calloc((size_t)(newsiz * tbsize), sizeof(integer)
+		    );
+	    ok = newpol && v1 && v2;
+	    if (ok) {
+		for (t = 0; t < tbsize; ++t) {
+		    for (i__ = 0; i__ < oldsiz; ++i__) {
+			v2[i__ + t * newsiz] = tbfils[i__ + t * oldsiz];
+		    }
+		}
+		zzekqrel(fthan, fthan0);
+		zzekqrel(tbfils, tbfils0);
+		zzekqrel(ftpool, ftpool0);
+		fthan = v1;
+		tbfils = v2;
+		ftpool = newpol;
+		ftsize = newsiz;
+	    }
+	    break;
+	case STTAB:
+	    v1 = ZZEKQARR(sthan, integer, 1);
+	    v2 = ZZEKQARR(stsidx, integer, 1);
+	    v3 = ZZEKQARR(stdscs, integer, 24);
+	    v4 = ZZEKQARR(stnrow, integer, 1);
+	    v5 = ZZEKQARR(stncol, integer, 1);
+	    v6 = ZZEKQARR(stdtpt, integer, 1);
+	    ok = newpol && v1 && v2 && v3 && v4 && v5 && v6;
+	    if (ok) {
+		zzekqrel(sthan, sthan0);
+		zzekqrel(stsidx, stsidx0);
+		zzekqrel(stdscs, stdscs0);
+		zzekqrel(stnrow, stnrow0);
+		zzekqrel(stncol, stncol0);
+		zzekqrel(stdtpt, stdtpt0);
+		zzekqrel(stpool, stpool0);
+		sthan = v1;
+		stsidx = v2;
+		stdscs = v3;
+		stnrow = v4;
+		stncol = v5;
+		stdtpt = v6;
+		stpool = newpol;
+		stsize = newsiz;
+	    }
+	    break;
+	case DTTAB:
+	    v1 = ZZEKQARR(dtdscs, integer, 11);
+	    ok = newpol && v1;
+	    if (ok) {
+		zzekqrel(dtdscs, dtdscs0);
+		zzekqrel(dtpool, dtpool0);
+		dtdscs = v1;
+		dtpool = newpol;
+		dtsize = newsiz;
+	    }
+	    break;
+	case CTTAB:
+	    c1 = ZZEKQARR(ctnams, char, 32);
+	    v1 = ZZEKQARR(cttyps, integer, 1);
+	    v2 = ZZEKQARR(ctlens, integer, 1);
+	    v3 = ZZEKQARR(ctsizs, integer, 1);
+	    v4 = ZZEKQARR(ctclas, integer, 1);
+	    l1 = ZZEKQARR(ctfixd, logical, 1);
+	    l2 = ZZEKQARR(ctindx, logical, 1);
+	    l3 = ZZEKQARR(ctnull, logical, 1);
+	    ok = newpol && c1 && v1 && v2 && v3 && v4 && l1 && l2 && l3;
+	    if (ok) {
+		zzekqrel(ctnams, ctnams0);
+		zzekqrel(cttyps, cttyps0);
+		zzekqrel(ctlens, ctlens0);
+		zzekqrel(ctsizs, ctsizs0);
+		zzekqrel(ctclas, ctclas0);
+		zzekqrel(ctfixd, ctfixd0);
+		zzekqrel(ctindx, ctindx0);
+		zzekqrel(ctnull, ctnull0);
+		zzekqrel(ctpool, ctpool0);
+		ctnams = c1;
+		cttyps = v1;
+		ctlens = v2;
+		ctsizs = v3;
+		ctclas = v4;
+		ctfixd = l1;
+		ctindx = l2;
+		ctnull = l3;
+		ctpool = newpol;
+		ctsize = newsiz;
+	    }
+	    break;
+	default:
+	    c1 = ZZEKQARR(tbnams, char, 64);
+	    v1 = ZZEKQARR(tbstpt, integer, 1);
+	    v2 = ZZEKQARR(tbncol, integer, 1);
+	    v3 = ZZEKQARR(tbctpt, integer, 1);
+	    v4 = ZZEKQARR(tbflsz, integer, 1);
+	    v5 = ZZEKQARR(tbfils, integer, ftsize);
+	    ok = newpol && c1 && v1 && v2 && v3 && v4 && v5;
+	    if (ok) {
+		zzekqrel(tbnams, tbnams0);
+		zzekqrel(tbstpt, tbstpt0);
+		zzekqrel(tbncol, tbncol0);
+		zzekqrel(tbctpt, tbctpt0);
+		zzekqrel(tbflsz, tbflsz0);
+		zzekqrel(tbfils, tbfils0);
+		zzekqrel(tbpool, tbpool0);
+		tbnams = c1;
+		tbstpt = v1;
+		tbncol = v2;
+		tbctpt = v3;
+		tbflsz = v4;
+		tbfils = v5;
+		tbpool = newpol;
+		tbsize = newsiz;
+	    }
+	    break;
+    }
+    if (! ok) {
+	free(newpol);
+	free(c1);
+	free(v1);
+	free(v2);
+	free(v3);
+	free(v4);
+	free(v5);
+	free(v6);
+	free(l1);
+	free(l2);
+	free(l3);
+    }
+    return ok;
+}
+
 /* $Procedure EKQMGR  ( EK, query manager ) */
 /* Subroutine */ int ekqmgr_0_(int n__, integer *cindex, integer *elment, 
 	char *eqryc, doublereal *eqryd, integer *eqryi, char *fname, integer *
@@ -170,13 +427,13 @@ static integer c__11000 = 11000;
     static integer k, cbegs[1000], cjend, l, r__, t, cends[1000];
     extern /* Subroutine */ int chkin_(char *, ftnlen);
     static logical cmtch;
-    static integer ubase[200], fthan[20];
+    static integer ubase[200];
     static char cnams[32*500];
     static integer lxbeg, lcidx[1000];
     extern /* Subroutine */ int ekcls_(integer *);
     static integer cvlen;
     static doublereal dvals[1000];
-    static integer lxend, nconj, sthan[200], ivals[1000], ncols;
+    static integer lxend, nconj, ivals[1000], ncols;
     static char state[80];
     static integer ctnew;
     extern integer lnktl_(integer *, integer *);
@@ -196,24 +453,10 @@ static integer c__11000 = 11000;
 	    , integer *, integer *, integer *, integer *, integer *, logical *
 	    , logical *);
     extern logical failed_(void);
-    static integer ctclas[500];
     extern integer isrchc_(char *, integer *, char *, ftnlen, ftnlen);
     extern logical return_(void);
     extern integer eknseg_(integer *), lnknxt_(integer *, integer *), lnknfn_(
 	    integer *);
-    static integer ftpool[52]	/* was [2][26] */, tbpool[212]	/* was [2][
-	    106] */, tbstpt[100], tbncol[100];
-    static char tbnams[64*100];
-    static integer tbctpt[100], tbfils[2000]	/* was [20][100] */, tbflsz[
-	    100], stpool[412]	/* was [2][206] */, stsidx[200], stdscs[4800]	
-	    /* was [24][200] */, stnrow[200], stncol[200], stdtpt[200], 
-	    dtpool[20012]	/* was [2][10006] */, dtdscs[110000]	/* 
-	    was [11][10000] */, ctpool[1012]	/* was [2][506] */;
-    static char ctnams[32*500];
-    static integer cttyps[500], ctlens[500];
-    static logical ctfixd[500];
-    static integer ctsizs[500];
-    static logical ctindx[500], ctnull[500];
     static char cnmset[32*506], colnam[32], frmals[64*10], frmtab[64*10], 
 	    lcname[32], ltname[64], problm[80], rcname[32], rtname[64], 
 	    tabnam[64], tabvec[64*16];
@@ -1393,23 +1636,21 @@ static integer c__11000 = 11000;
 
 /* $ Parameters */
 
-/*     FTSIZE   is the maximum number of EK files that may be */
-/*              loaded. Any other DAS files loaded by the calling */
-/*              program count against this limit. */
+/*     FTSIZE   is the initial size of the file table. The table is */
+/*              enlarged if more EK files are loaded. */
 
-/*     STSIZE   is the size of the segment table; this is the */
-/*              maximum number of segments that can be loaded at */
-/*              one time. */
+/*     STSIZE   is the initial size of the segment table. The table */
+/*              is enlarged if more segments are loaded. */
 
-/*     MXTBLD   is the maximum number of tables that can be loaded */
-/*              at any time. A table can consist of multiple */
-/*              segments. */
+/*     MXTBLD   is the initial size of the table list. A table can */
+/*              consist of multiple segments. The list is enlarged */
+/*              if more tables are loaded. */
 
-/*     MXCLLD   is the maximum number of columns that can be loaded */
-/*              at any time. A column may be spread across */
-/*              multiple segments; in this case, the portions of */
-/*              the column contained in each segment count against */
-/*              this limit. */
+/*     MXCLLD   is the initial size of the column attribute table. */
+/*              A column may be spread across multiple segments; in */
+/*              this case, the portions of the column contained in */
+/*              each segment count separately. The table is enlarged */
+/*              if more columns are loaded. */
 
 /*     ADSCSZ   is the size of column attribute descriptor. */
 /*              (Defined in ekattdsc.inc.) */
@@ -2194,9 +2435,9 @@ L_eklef:
 /*         routine in the call tree of this routine. HANDLE is undefined */
 /*         in this case. */
 
-/*     4)  If loading the input file would cause the maximum number of */
-/*         loaded EK files to be exceeded, the error */
-/*         SPICE(EKFILETABLEFULL) is signaled. HANDLE is undefined in */
+/*     4)  If the table of loaded EK files cannot be enlarged to */
+/*         accommodate the input file because memory cannot be */
+/*         allocated, the error SPICE(EKFILETABLEFULL) is signaled. HANDLE is undefined in */
 /*         this case. This routine will attempt to unload the file */
 /*         from the DAS system. */
 
@@ -2206,22 +2447,22 @@ L_eklef:
 /*         in this case. This routine will attempt to unload the file */
 /*         from the DAS system. */
 
-/*     6)  If loading the input file would cause the maximum number of */
-/*         segments allowed in loaded EK files to be exceeded, the error */
-/*         SPICE(EKSEGMENTTABLEFULL) is signaled. HANDLE is undefined in */
+/*     6)  If the table of segments in loaded EK files cannot be */
+/*         enlarged to accommodate the input file because memory cannot */
+/*         be allocated, the error SPICE(EKSEGMENTTABLEFULL) is signaled. HANDLE is undefined in */
 /*         this case. This routine will attempt to unload the file from */
 /*         the DAS system. */
 
-/*     7)  If loading the input file would cause the maximum number of */
-/*         columns allowed in loaded EK files to be exceeded, the error */
-/*         SPICE(EKCOLDESCTABLEFULL) is signaled. HANDLE is undefined in */
+/*     7)  If the table of columns in loaded EK files cannot be */
+/*         enlarged to accommodate the input file because memory cannot */
+/*         be allocated, the error SPICE(EKCOLDESCTABLEFULL) is signaled. HANDLE is undefined in */
 /*         this case. This routine will attempt to unload the file from */
 /*         the DAS system. */
 
-/*     8)  If loading the input file would cause the maximum allowed */
-/*         number of columns having distinct attributes in loaded EK */
-/*         files to be exceeded, the error SPICE(EKCOLATTRTABLEFULL) is */
-/*         signaled. HANDLE is undefined in this case. This routine will */
+/*     8)  If the table of columns having distinct attributes in loaded */
+/*         EK files cannot be enlarged to accommodate the input file */
+/*         because memory cannot be allocated, the error */
+/*         SPICE(EKCOLATTRTABLEFULL) is signaled. HANDLE is undefined in this case. This routine will */
 /*         attempt to unload the file from the DAS system. */
 
 /*     9)  If loading the input file would cause the maximum number of */
@@ -2514,6 +2755,12 @@ L_eklef:
 
 /* $ Version */
 
+/* -    SPICELIB Version 3.0.0, 16-OCT-2026 */
+
+/*        The file, segment, column descriptor, column attribute and */
+/*        table tables are now enlarged as needed, so the number of */
+/*        loaded EKs is limited only by available memory. */
+
 /* -    SPICELIB Version 2.2.0, 06-JUL-2021 (JDR) */
 
 /*        Added IMPLICIT NONE statement. */
@@ -2552,6 +2799,7 @@ L_eklef:
     } else {
 	chkin_("EKLEF", (ftnlen)5);
     }
+    ++ctgen;
 
 /*     Here's a brief overview of what follows: */
 
@@ -2605,11 +2853,11 @@ L_eklef:
 /*        Initialize the file table pool, segment table pool, column */
 /*        descriptor pool, column table pool, and table list pool. */
 
-	lnkini_(&c__20, ftpool);
-	lnkini_(&c__200, stpool);
-	lnkini_(&c__10000, dtpool);
-	lnkini_(&c__500, ctpool);
-	lnkini_(&c__100, tbpool);
+	lnkini_(&ftsize, ftpool);
+	lnkini_(&stsize, stpool);
+	lnkini_(&dtsize, dtpool);
+	lnkini_(&ctsize, ctpool);
+	lnkini_(&tbsize, tbpool);
 	fthead = 0;
 	tbhead = 0;
 	first = FALSE_;
@@ -2631,7 +2879,7 @@ L_eklef:
 
     i__ = fthead;
     while(i__ > 0) {
-	if (*handle == fthan[(i__1 = i__ - 1) < 20 && 0 <= i__1 ? i__1 : 
+	if (*handle == fthan[(i__1 = i__ - 1) < ftsize && 0 <= i__1 ? i__1 : 
 		s_rnge("fthan", i__1, "ekqmgr_", (ftnlen)1604)]) {
 
 /*           The last call we made to EKOPR added another link to */
@@ -2653,9 +2901,10 @@ L_eklef:
 /*     out.  We must have enough room to accommodate it in the file */
 /*     table, segment table, table list, and column table. */
 
-/*     Make sure there's enough room in the file table. */
+/*     Make sure there's enough room in the file table, enlarging it */
+/*     if necessary. */
 
-    if (lnknfn_(ftpool) == 0) {
+    if (lnknfn_(ftpool) == 0 && ! zzekqgrw(FTTAB, 1)) {
 
 /*        Sorry, there are no free file table entries left. */
 
@@ -2674,7 +2923,7 @@ L_eklef:
 /*     sure there's enough room in the segment table. */
 
     nseg = eknseg_(handle);
-    if (nseg > lnknfn_(stpool)) {
+    if (nseg > lnknfn_(stpool) && ! zzekqgrw(STTAB, nseg)) {
 
 /*        There are too many segments for the amount of space we've got */
 /*        left. */
@@ -2714,7 +2963,7 @@ L_eklef:
 	    lnkan_(ftpool, &new__);
 	    lnkilb_(&new__, &fthead, ftpool);
 	    fthead = new__;
-	    fthan[(i__1 = new__ - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("fthan"
+	    fthan[(i__1 = new__ - 1) < ftsize && 0 <= i__1 ? i__1 : s_rnge("fthan"
 		    , i__1, "ekqmgr_", (ftnlen)1707)] = *handle;
 	    s_copy(state, "SUMMARIZE_SEGMENT", (ftnlen)80, (ftnlen)17);
 	} else if (s_cmp(state, "SUMMARIZE_SEGMENT", (ftnlen)80, (ftnlen)17) 
@@ -2746,7 +2995,7 @@ L_eklef:
 	    tbcurr = tbhead;
 	    presnt = FALSE_;
 	    while(tbcurr > 0 && ! presnt) {
-		if (s_cmp(tabnam, tbnams + (((i__1 = tbcurr - 1) < 100 && 0 <=
+		if (s_cmp(tabnam, tbnams + (((i__1 = tbcurr - 1) < tbsize && 0 <=
 			 i__1 ? i__1 : s_rnge("tbnams", i__1, "ekqmgr_", (
 			ftnlen)1752)) << 6), (ftnlen)64, (ftnlen)64) == 0) {
 		    presnt = TRUE_;
@@ -2766,10 +3015,10 @@ L_eklef:
 /*              in the segment matches the number of columns in the */
 /*              parent table. */
 
-		if (ncols != tbncol[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? 
+		if (ncols != tbncol[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? 
 			i__1 : s_rnge("tbncol", i__1, "ekqmgr_", (ftnlen)1772)
 			]) {
-		    npcol = tbncol[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? 
+		    npcol = tbncol[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? 
 			    i__1 : s_rnge("tbncol", i__1, "ekqmgr_", (ftnlen)
 			    1774)];
 		    s_copy(state, "ABORT", (ftnlen)80, (ftnlen)5);
@@ -2780,12 +3029,12 @@ L_eklef:
 /*                 Add the current file to the list of files containing */
 /*                 the current table. */
 
-		    tbfils[(i__1 = tbcurr * 20 - 20) < 2000 && 0 <= i__1 ? 
+		    tbfils[(i__1 = tbcurr * ftsize - ftsize) < ftsize * tbsize && 0 <= i__1 ? 
 			    i__1 : s_rnge("tbfils", i__1, "ekqmgr_", (ftnlen)
 			    1783)] = *handle;
-		    tbflsz[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : 
+		    tbflsz[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : 
 			    s_rnge("tbflsz", i__1, "ekqmgr_", (ftnlen)1784)] =
-			     tbflsz[(i__2 = tbcurr - 1) < 100 && 0 <= i__2 ? 
+			     tbflsz[(i__2 = tbcurr - 1) < tbsize && 0 <= i__2 ? 
 			    i__2 : s_rnge("tbflsz", i__2, "ekqmgr_", (ftnlen)
 			    1784)] + 1;
 		    s_copy(state, "MAKE_SEGMENT_TABLE_ENTRY", (ftnlen)80, (
@@ -2803,7 +3052,7 @@ L_eklef:
 
 /*           Allocate a table list entry, if we can. */
 
-	    if (lnknfn_(tbpool) == 0) {
+	    if (lnknfn_(tbpool) == 0 && ! zzekqgrw(TBTAB, 1)) {
 
 /*              Oops, we're out of room. */
 
@@ -2827,27 +3076,27 @@ L_eklef:
 
 /*              Fill in the table name. */
 
-		s_copy(tbnams + (((i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? 
+		s_copy(tbnams + (((i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? 
 			i__1 : s_rnge("tbnams", i__1, "ekqmgr_", (ftnlen)1832)
 			) << 6), tabnam, (ftnlen)64, (ftnlen)64);
 
 /*              Since this table is new, the file list for this table */
 /*              contains only the handle of the current EK. */
 
-		tbfils[(i__1 = tbcurr * 20 - 20) < 2000 && 0 <= i__1 ? i__1 : 
+		tbfils[(i__1 = tbcurr * ftsize - ftsize) < ftsize * tbsize && 0 <= i__1 ? i__1 : 
 			s_rnge("tbfils", i__1, "ekqmgr_", (ftnlen)1837)] = *
 			handle;
-		tbflsz[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge(
+		tbflsz[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : s_rnge(
 			"tbflsz", i__1, "ekqmgr_", (ftnlen)1838)] = 1;
 
 /*              Initialize the column count, column table pointer, and */
 /*              segment list pointer for this table. */
 
-		tbncol[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge(
+		tbncol[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : s_rnge(
 			"tbncol", i__1, "ekqmgr_", (ftnlen)1844)] = ncols;
-		tbctpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge(
+		tbctpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : s_rnge(
 			"tbctpt", i__1, "ekqmgr_", (ftnlen)1845)] = 0;
-		tbstpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge(
+		tbstpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : s_rnge(
 			"tbstpt", i__1, "ekqmgr_", (ftnlen)1846)] = 0;
 
 /*              Go on to add a segment table entry for the current */
@@ -2871,12 +3120,12 @@ L_eklef:
 /*           list for the parent table, or, if the tail is NIL, just set */
 /*           the segment list pointer to the current segment node. */
 
-	    if (tbstpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge(
+	    if (tbstpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : s_rnge(
 		    "tbstpt", i__1, "ekqmgr_", (ftnlen)1872)] <= 0) {
-		tbstpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge(
+		tbstpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : s_rnge(
 			"tbstpt", i__1, "ekqmgr_", (ftnlen)1874)] = stnew;
 	    } else {
-		lnkilb_(&tbstpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 
+		lnkilb_(&tbstpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 
 			: s_rnge("tbstpt", i__1, "ekqmgr_", (ftnlen)1878)], &
 			stnew, stpool);
 	    }
@@ -2885,17 +3134,17 @@ L_eklef:
 /*           table entry except for the pointers into the column table */
 /*           and the column base addresses. */
 
-	    sthan[(i__1 = stnew - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge("sth"
+	    sthan[(i__1 = stnew - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge("sth"
 		    "an", i__1, "ekqmgr_", (ftnlen)1887)] = *handle;
-	    stsidx[(i__1 = stnew - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge(
+	    stsidx[(i__1 = stnew - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge(
 		    "stsidx", i__1, "ekqmgr_", (ftnlen)1888)] = seg;
-	    stnrow[(i__1 = stnew - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge(
+	    stnrow[(i__1 = stnew - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge(
 		    "stnrow", i__1, "ekqmgr_", (ftnlen)1889)] = segdsc[5];
-	    stncol[(i__1 = stnew - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge(
+	    stncol[(i__1 = stnew - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge(
 		    "stncol", i__1, "ekqmgr_", (ftnlen)1890)] = segdsc[4];
-	    stdtpt[(i__1 = stnew - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge(
+	    stdtpt[(i__1 = stnew - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge(
 		    "stdtpt", i__1, "ekqmgr_", (ftnlen)1891)] = 0;
-	    movei_(segdsc, &c__24, &stdscs[(i__1 = stnew * 24 - 24) < 4800 && 
+	    movei_(segdsc, &c__24, &stdscs[(i__1 = stnew * 24 - 24) < stsize * 24 && 
 		    0 <= i__1 ? i__1 : s_rnge("stdscs", i__1, "ekqmgr_", (
 		    ftnlen)1893)]);
 
@@ -2922,11 +3171,11 @@ L_eklef:
 /*              check the list of column names for the current segment, */
 /*              looking for a match. */
 
-		j = tbctpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : 
+		j = tbctpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : 
 			s_rnge("tbctpt", i__1, "ekqmgr_", (ftnlen)1922)];
 		while(j > 0 && s_cmp(state, "ABORT", (ftnlen)80, (ftnlen)5) !=
 			 0) {
-		    k = isrchc_(ctnams + (((i__1 = j - 1) < 500 && 0 <= i__1 ?
+		    k = isrchc_(ctnams + (((i__1 = j - 1) < ctsize && 0 <= i__1 ?
 			     i__1 : s_rnge("ctnams", i__1, "ekqmgr_", (ftnlen)
 			    1928)) << 5), &ncols, cnams, (ftnlen)32, (ftnlen)
 			    32);
@@ -2947,26 +3196,26 @@ L_eklef:
 			attmch = cdscrs[(i__1 = k * 11 - 11) < 5500 && 0 <= 
 				i__1 ? i__1 : s_rnge("cdscrs", i__1, "ekqmgr_"
 				, (ftnlen)1941)] == ctclas[(i__2 = j - 1) < 
-				500 && 0 <= i__2 ? i__2 : s_rnge("ctclas", 
+				ctsize && 0 <= i__2 ? i__2 : s_rnge("ctclas", 
 				i__2, "ekqmgr_", (ftnlen)1941)] && cdscrs[(
 				i__3 = k * 11 - 10) < 5500 && 0 <= i__3 ? 
 				i__3 : s_rnge("cdscrs", i__3, "ekqmgr_", (
-				ftnlen)1941)] == cttyps[(i__4 = j - 1) < 500 
+				ftnlen)1941)] == cttyps[(i__4 = j - 1) < ctsize 
 				&& 0 <= i__4 ? i__4 : s_rnge("cttyps", i__4, 
 				"ekqmgr_", (ftnlen)1941)] && cdscrs[(i__5 = k 
 				* 11 - 9) < 5500 && 0 <= i__5 ? i__5 : s_rnge(
 				"cdscrs", i__5, "ekqmgr_", (ftnlen)1941)] == 
-				ctlens[(i__6 = j - 1) < 500 && 0 <= i__6 ? 
+				ctlens[(i__6 = j - 1) < ctsize && 0 <= i__6 ? 
 				i__6 : s_rnge("ctlens", i__6, "ekqmgr_", (
 				ftnlen)1941)] && cdscrs[(i__7 = k * 11 - 8) < 
 				5500 && 0 <= i__7 ? i__7 : s_rnge("cdscrs", 
 				i__7, "ekqmgr_", (ftnlen)1941)] == ctsizs[(
-				i__8 = j - 1) < 500 && 0 <= i__8 ? i__8 : 
+				i__8 = j - 1) < ctsize && 0 <= i__8 ? i__8 : 
 				s_rnge("ctsizs", i__8, "ekqmgr_", (ftnlen)
 				1941)] && indexd == ctindx[(i__9 = j - 1) < 
-				500 && 0 <= i__9 ? i__9 : s_rnge("ctindx", 
+				ctsize && 0 <= i__9 ? i__9 : s_rnge("ctindx", 
 				i__9, "ekqmgr_", (ftnlen)1941)] && nulsok == 
-				ctnull[(i__10 = j - 1) < 500 && 0 <= i__10 ? 
+				ctnull[(i__10 = j - 1) < ctsize && 0 <= i__10 ? 
 				i__10 : s_rnge("ctnull", i__10, "ekqmgr_", (
 				ftnlen)1941)];
 			if (attmch) {
@@ -2983,7 +3232,8 @@ L_eklef:
 /*                       in the descriptor table.  We'll need to */
 /*                       allocate a descriptor table entry first. */
 
-			    if (lnknfn_(dtpool) == 0) {
+			    if (lnknfn_(dtpool) == 0 && ! zzekqgrw(DTTAB, 1)) 
+				    {
 
 /*                          No free nodes left in the descriptor table. */
 
@@ -2997,15 +3247,15 @@ L_eklef:
 /*                          the current segment. */
 
 				lnkan_(dtpool, &dtnew);
-				if (stdtpt[(i__1 = stnew - 1) < 200 && 0 <= 
+				if (stdtpt[(i__1 = stnew - 1) < stsize && 0 <= 
 					i__1 ? i__1 : s_rnge("stdtpt", i__1, 
 					"ekqmgr_", (ftnlen)1979)] <= 0) {
-				    stdtpt[(i__1 = stnew - 1) < 200 && 0 <= 
+				    stdtpt[(i__1 = stnew - 1) < stsize && 0 <= 
 					    i__1 ? i__1 : s_rnge("stdtpt", 
 					    i__1, "ekqmgr_", (ftnlen)1981)] = 
 					    dtnew;
 				} else {
-				    lnkilb_(&stdtpt[(i__1 = stnew - 1) < 200 
+				    lnkilb_(&stdtpt[(i__1 = stnew - 1) < stsize 
 					    && 0 <= i__1 ? i__1 : s_rnge(
 					    "stdtpt", i__1, "ekqmgr_", (
 					    ftnlen)1985)], &dtnew, dtpool);
@@ -3017,7 +3267,7 @@ L_eklef:
 					0 <= i__1 ? i__1 : s_rnge("cdscrs", 
 					i__1, "ekqmgr_", (ftnlen)1992)], &
 					c__11, &dtdscs[(i__2 = dtnew * 11 - 
-					11) < 110000 && 0 <= i__2 ? i__2 : 
+					11) < dtsize * 11 && 0 <= i__2 ? i__2 : 
 					s_rnge("dtdscs", i__2, "ekqmgr_", (
 					ftnlen)1992)]);
 			    }
@@ -3033,7 +3283,7 @@ L_eklef:
 /*                       loaded column of the same name in the */
 /*                       current table. */
 
-			    s_copy(colnam, ctnams + (((i__1 = j - 1) < 500 && 
+			    s_copy(colnam, ctnams + (((i__1 = j - 1) < ctsize && 
 				    0 <= i__1 ? i__1 : s_rnge("ctnams", i__1, 
 				    "ekqmgr_", (ftnlen)2010)) << 5), (ftnlen)
 				    32, (ftnlen)32);
@@ -3047,7 +3297,7 @@ L_eklef:
 /*                    table is not present in the segment we're looking */
 /*                    at. */
 
-			s_copy(colnam, ctnams + (((i__1 = j - 1) < 500 && 0 <=
+			s_copy(colnam, ctnams + (((i__1 = j - 1) < ctsize && 0 <=
 				 i__1 ? i__1 : s_rnge("ctnams", i__1, "ekqmg"
 				"r_", (ftnlen)2023)) << 5), (ftnlen)32, (
 				ftnlen)32);
@@ -3086,7 +3336,7 @@ L_eklef:
 /*                 current table.  If the column list is empty, update */
 /*                 the list head. */
 
-		    if (lnknfn_(ctpool) == 0) {
+		    if (lnknfn_(ctpool) == 0 && ! zzekqgrw(CTTAB, 1)) {
 
 /*                    There's no more space to store attribute */
 /*                    descriptors. */
@@ -3096,14 +3346,14 @@ L_eklef:
 				ftnlen)20);
 		    } else {
 			lnkan_(ctpool, &ctnew);
-			if (tbctpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? 
+			if (tbctpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? 
 				i__1 : s_rnge("tbctpt", i__1, "ekqmgr_", (
 				ftnlen)2074)] <= 0) {
-			    tbctpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? 
+			    tbctpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? 
 				    i__1 : s_rnge("tbctpt", i__1, "ekqmgr_", (
 				    ftnlen)2076)] = ctnew;
 			} else {
-			    lnkilb_(&tbctpt[(i__1 = tbcurr - 1) < 100 && 0 <= 
+			    lnkilb_(&tbctpt[(i__1 = tbcurr - 1) < tbsize && 0 <= 
 				    i__1 ? i__1 : s_rnge("tbctpt", i__1, 
 				    "ekqmgr_", (ftnlen)2080)], &ctnew, ctpool)
 				    ;
@@ -3112,43 +3362,43 @@ L_eklef:
 /*                    Fill in the new column attribute entry with the */
 /*                    attributes for this column. */
 
-			s_copy(ctnams + (((i__1 = ctnew - 1) < 500 && 0 <= 
+			s_copy(ctnams + (((i__1 = ctnew - 1) < ctsize && 0 <= 
 				i__1 ? i__1 : s_rnge("ctnams", i__1, "ekqmgr_"
 				, (ftnlen)2088)) << 5), cnams + (((i__2 = k - 
 				1) < 500 && 0 <= i__2 ? i__2 : s_rnge("cnams",
 				 i__2, "ekqmgr_", (ftnlen)2088)) << 5), (
 				ftnlen)32, (ftnlen)32);
-			ctclas[(i__1 = ctnew - 1) < 500 && 0 <= i__1 ? i__1 : 
+			ctclas[(i__1 = ctnew - 1) < ctsize && 0 <= i__1 ? i__1 : 
 				s_rnge("ctclas", i__1, "ekqmgr_", (ftnlen)
 				2089)] = cdscrs[(i__2 = k * 11 - 11) < 5500 &&
 				 0 <= i__2 ? i__2 : s_rnge("cdscrs", i__2, 
 				"ekqmgr_", (ftnlen)2089)];
-			cttyps[(i__1 = ctnew - 1) < 500 && 0 <= i__1 ? i__1 : 
+			cttyps[(i__1 = ctnew - 1) < ctsize && 0 <= i__1 ? i__1 : 
 				s_rnge("cttyps", i__1, "ekqmgr_", (ftnlen)
 				2090)] = cdscrs[(i__2 = k * 11 - 10) < 5500 &&
 				 0 <= i__2 ? i__2 : s_rnge("cdscrs", i__2, 
 				"ekqmgr_", (ftnlen)2090)];
-			ctlens[(i__1 = ctnew - 1) < 500 && 0 <= i__1 ? i__1 : 
+			ctlens[(i__1 = ctnew - 1) < ctsize && 0 <= i__1 ? i__1 : 
 				s_rnge("ctlens", i__1, "ekqmgr_", (ftnlen)
 				2091)] = cdscrs[(i__2 = k * 11 - 9) < 5500 && 
 				0 <= i__2 ? i__2 : s_rnge("cdscrs", i__2, 
 				"ekqmgr_", (ftnlen)2091)];
-			ctsizs[(i__1 = ctnew - 1) < 500 && 0 <= i__1 ? i__1 : 
+			ctsizs[(i__1 = ctnew - 1) < ctsize && 0 <= i__1 ? i__1 : 
 				s_rnge("ctsizs", i__1, "ekqmgr_", (ftnlen)
 				2092)] = cdscrs[(i__2 = k * 11 - 8) < 5500 && 
 				0 <= i__2 ? i__2 : s_rnge("cdscrs", i__2, 
 				"ekqmgr_", (ftnlen)2092)];
-			ctindx[(i__1 = ctnew - 1) < 500 && 0 <= i__1 ? i__1 : 
+			ctindx[(i__1 = ctnew - 1) < ctsize && 0 <= i__1 ? i__1 : 
 				s_rnge("ctindx", i__1, "ekqmgr_", (ftnlen)
 				2093)] = cdscrs[(i__2 = k * 11 - 6) < 5500 && 
 				0 <= i__2 ? i__2 : s_rnge("cdscrs", i__2, 
 				"ekqmgr_", (ftnlen)2093)] != -1;
-			ctfixd[(i__1 = ctnew - 1) < 500 && 0 <= i__1 ? i__1 : 
+			ctfixd[(i__1 = ctnew - 1) < ctsize && 0 <= i__1 ? i__1 : 
 				s_rnge("ctfixd", i__1, "ekqmgr_", (ftnlen)
 				2094)] = cdscrs[(i__2 = k * 11 - 8) < 5500 && 
 				0 <= i__2 ? i__2 : s_rnge("cdscrs", i__2, 
 				"ekqmgr_", (ftnlen)2094)] != -1;
-			ctnull[(i__1 = ctnew - 1) < 500 && 0 <= i__1 ? i__1 : 
+			ctnull[(i__1 = ctnew - 1) < ctsize && 0 <= i__1 ? i__1 : 
 				s_rnge("ctnull", i__1, "ekqmgr_", (ftnlen)
 				2095)] = cdscrs[(i__2 = k * 11 - 4) < 5500 && 
 				0 <= i__2 ? i__2 : s_rnge("cdscrs", i__2, 
@@ -3158,7 +3408,7 @@ L_eklef:
 /*                    in the descriptor table.  We'll need to */
 /*                    allocate a descriptor table entry first. */
 
-			if (lnknfn_(dtpool) == 0) {
+			if (lnknfn_(dtpool) == 0 && ! zzekqgrw(DTTAB, 1)) {
 
 /*                       No free nodes left in the descriptor table. */
 
@@ -3172,14 +3422,14 @@ L_eklef:
 /*                       segment. */
 
 			    lnkan_(dtpool, &dtnew);
-			    if (stdtpt[(i__1 = stnew - 1) < 200 && 0 <= i__1 ?
+			    if (stdtpt[(i__1 = stnew - 1) < stsize && 0 <= i__1 ?
 				     i__1 : s_rnge("stdtpt", i__1, "ekqmgr_", 
 				    (ftnlen)2117)] <= 0) {
-				stdtpt[(i__1 = stnew - 1) < 200 && 0 <= i__1 ?
+				stdtpt[(i__1 = stnew - 1) < stsize && 0 <= i__1 ?
 					 i__1 : s_rnge("stdtpt", i__1, "ekqm"
 					"gr_", (ftnlen)2119)] = dtnew;
 			    } else {
-				lnkilb_(&stdtpt[(i__1 = stnew - 1) < 200 && 0 
+				lnkilb_(&stdtpt[(i__1 = stnew - 1) < stsize && 0 
 					<= i__1 ? i__1 : s_rnge("stdtpt", 
 					i__1, "ekqmgr_", (ftnlen)2123)], &
 					dtnew, dtpool);
@@ -3190,7 +3440,7 @@ L_eklef:
 			    movei_(&cdscrs[(i__1 = k * 11 - 11) < 5500 && 0 <=
 				     i__1 ? i__1 : s_rnge("cdscrs", i__1, 
 				    "ekqmgr_", (ftnlen)2130)], &c__11, &
-				    dtdscs[(i__2 = dtnew * 11 - 11) < 110000 
+				    dtdscs[(i__2 = dtnew * 11 - 11) < dtsize * 11 
 				    && 0 <= i__2 ? i__2 : s_rnge("dtdscs", 
 				    i__2, "ekqmgr_", (ftnlen)2130)]);
 			}
@@ -3250,11 +3500,11 @@ L_eklef:
 
 /*              There are no files left.  Clean up the whole shebang. */
 
-		lnkini_(&c__20, ftpool);
-		lnkini_(&c__200, stpool);
-		lnkini_(&c__10000, dtpool);
-		lnkini_(&c__500, ctpool);
-		lnkini_(&c__100, tbpool);
+		lnkini_(&ftsize, ftpool);
+		lnkini_(&stsize, stpool);
+		lnkini_(&dtsize, dtpool);
+		lnkini_(&ctsize, ctpool);
+		lnkini_(&tbsize, tbpool);
 		fthead = 0;
 		tbhead = 0;
 	    } else {
@@ -3285,10 +3535,10 @@ L_eklef:
 /*                 unloading. */
 
 		    i__ = 1;
-		    while(i__ <= tbflsz[(i__1 = tbcurr - 1) < 100 && 0 <= 
+		    while(i__ <= tbflsz[(i__1 = tbcurr - 1) < tbsize && 0 <= 
 			    i__1 ? i__1 : s_rnge("tbflsz", i__1, "ekqmgr_", (
 			    ftnlen)2251)] && ! fnd) {
-			if (tbfils[(i__1 = i__ + tbcurr * 20 - 21) < 2000 && 
+			if (tbfils[(i__1 = i__ + tbcurr * ftsize - ftsize - 1) < ftsize * tbsize && 
 				0 <= i__1 ? i__1 : s_rnge("tbfils", i__1, 
 				"ekqmgr_", (ftnlen)2254)] == *handle) {
 
@@ -3311,31 +3561,31 @@ L_eklef:
 /*                    the list of file handles associated with this */
 /*                    table.  Compress this handle out of the list. */
 
-			i__2 = tbflsz[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ?
+			i__2 = tbflsz[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ?
 				 i__1 : s_rnge("tbflsz", i__1, "ekqmgr_", (
 				ftnlen)2280)] - 1;
 			for (j = i__; j <= i__2; ++j) {
-			    tbfils[(i__1 = j + tbcurr * 20 - 21) < 2000 && 0 
+			    tbfils[(i__1 = j + tbcurr * ftsize - ftsize - 1) < ftsize * tbsize && 0 
 				    <= i__1 ? i__1 : s_rnge("tbfils", i__1, 
 				    "ekqmgr_", (ftnlen)2282)] = tbfils[(i__3 =
-				     j + 1 + tbcurr * 20 - 21) < 2000 && 0 <= 
+				     j + 1 + tbcurr * ftsize - ftsize - 1) < ftsize * tbsize && 0 <= 
 				    i__3 ? i__3 : s_rnge("tbfils", i__3, 
 				    "ekqmgr_", (ftnlen)2282)];
 			}
-			tbflsz[(i__2 = tbcurr - 1) < 100 && 0 <= i__2 ? i__2 :
+			tbflsz[(i__2 = tbcurr - 1) < tbsize && 0 <= i__2 ? i__2 :
 				 s_rnge("tbflsz", i__2, "ekqmgr_", (ftnlen)
-				2286)] = tbflsz[(i__1 = tbcurr - 1) < 100 && 
+				2286)] = tbflsz[(i__1 = tbcurr - 1) < tbsize && 
 				0 <= i__1 ? i__1 : s_rnge("tbflsz", i__1, 
 				"ekqmgr_", (ftnlen)2286)] - 1;
 
 /*                    Traverse the segment list for this table, looking */
 /*                    for segments in the specified EK. */
 
-			delseg = tbstpt[(i__2 = tbcurr - 1) < 100 && 0 <= 
+			delseg = tbstpt[(i__2 = tbcurr - 1) < tbsize && 0 <= 
 				i__2 ? i__2 : s_rnge("tbstpt", i__2, "ekqmgr_"
 				, (ftnlen)2292)];
 			while(delseg > 0) {
-			    if (sthan[(i__2 = delseg - 1) < 200 && 0 <= i__2 ?
+			    if (sthan[(i__2 = delseg - 1) < stsize && 0 <= i__2 ?
 				     i__2 : s_rnge("sthan", i__2, "ekqmgr_", (
 				    ftnlen)2296)] == *handle) {
 
@@ -3346,7 +3596,7 @@ L_eklef:
 /*                          These descriptors are linked together, so we */
 /*                          can free all of them in one shot. */
 
-				j = stdtpt[(i__2 = delseg - 1) < 200 && 0 <= 
+				j = stdtpt[(i__2 = delseg - 1) < stsize && 0 <= 
 					i__2 ? i__2 : s_rnge("stdtpt", i__2, 
 					"ekqmgr_", (ftnlen)2305)];
 				if (j > 0) {
@@ -3360,10 +3610,10 @@ L_eklef:
 /*                          parent table's table list entry. */
 
 				if (delseg == tbstpt[(i__2 = tbcurr - 1) < 
-					100 && 0 <= i__2 ? i__2 : s_rnge(
+					tbsize && 0 <= i__2 ? i__2 : s_rnge(
 					"tbstpt", i__2, "ekqmgr_", (ftnlen)
 					2318)]) {
-				    tbstpt[(i__2 = tbcurr - 1) < 100 && 0 <= 
+				    tbstpt[(i__2 = tbcurr - 1) < tbsize && 0 <= 
 					    i__2 ? i__2 : s_rnge("tbstpt", 
 					    i__2, "ekqmgr_", (ftnlen)2320)] = 
 					    lnknxt_(&delseg, stpool);
@@ -3395,7 +3645,7 @@ L_eklef:
 /*                    may need to update the head-of-list pointer for the */
 /*                    table list. */
 
-			if (tbstpt[(i__2 = tbcurr - 1) < 100 && 0 <= i__2 ? 
+			if (tbstpt[(i__2 = tbcurr - 1) < tbsize && 0 <= i__2 ? 
 				i__2 : s_rnge("tbstpt", i__2, "ekqmgr_", (
 				ftnlen)2359)] <= 0) {
 
@@ -3410,7 +3660,7 @@ L_eklef:
 /*                       can free them in one shot.  Don't crash if the */
 /*                       column attribute list is empty. */
 
-			    j = tbctpt[(i__2 = tbcurr - 1) < 100 && 0 <= i__2 
+			    j = tbctpt[(i__2 = tbcurr - 1) < tbsize && 0 <= i__2 
 				    ? i__2 : s_rnge("tbctpt", i__2, "ekqmgr_",
 				     (ftnlen)2372)];
 			    if (j > 0) {
@@ -3817,6 +4067,7 @@ L_ekuef:
     } else {
 	chkin_("EKUEF", (ftnlen)5);
     }
+    ++ctgen;
 
 /*     On the first pass through this routine, initialize the tables, */
 /*     if it hasn't been done yet. */
@@ -3826,11 +4077,11 @@ L_ekuef:
 /*        Initialize the file table pool, segment table pool, column */
 /*        descriptor pool, column table pool, and table list pool. */
 
-	lnkini_(&c__20, ftpool);
-	lnkini_(&c__200, stpool);
-	lnkini_(&c__10000, dtpool);
-	lnkini_(&c__500, ctpool);
-	lnkini_(&c__100, tbpool);
+	lnkini_(&ftsize, ftpool);
+	lnkini_(&stsize, stpool);
+	lnkini_(&dtsize, dtpool);
+	lnkini_(&ctsize, ctpool);
+	lnkini_(&tbsize, tbpool);
 	fthead = 0;
 	tbhead = 0;
 	first = FALSE_;
@@ -3842,7 +4093,7 @@ L_ekuef:
     i__ = fthead;
     fnd = FALSE_;
     while(i__ > 0 && ! fnd) {
-	if (*handle == fthan[(i__2 = i__ - 1) < 20 && 0 <= i__2 ? i__2 : 
+	if (*handle == fthan[(i__2 = i__ - 1) < ftsize && 0 <= i__2 ? i__2 : 
 		s_rnge("fthan", i__2, "ekqmgr_", (ftnlen)2867)]) {
 	    fnd = TRUE_;
 	} else {
@@ -3870,11 +4121,11 @@ L_ekuef:
 
 /*           There are no files left.  Clean up the whole shebang. */
 
-	    lnkini_(&c__20, ftpool);
-	    lnkini_(&c__200, stpool);
-	    lnkini_(&c__10000, dtpool);
-	    lnkini_(&c__500, ctpool);
-	    lnkini_(&c__100, tbpool);
+	    lnkini_(&ftsize, ftpool);
+	    lnkini_(&stsize, stpool);
+	    lnkini_(&dtsize, dtpool);
+	    lnkini_(&ctsize, ctpool);
+	    lnkini_(&tbsize, tbpool);
 	    fthead = 0;
 	    tbhead = 0;
 
@@ -3910,9 +4161,9 @@ L_ekuef:
 /*        See whether the current table is in the file we're unloading. */
 
 	i__ = 1;
-	while(i__ <= tbflsz[(i__2 = tbcurr - 1) < 100 && 0 <= i__2 ? i__2 : 
+	while(i__ <= tbflsz[(i__2 = tbcurr - 1) < tbsize && 0 <= i__2 ? i__2 : 
 		s_rnge("tbflsz", i__2, "ekqmgr_", (ftnlen)2947)] && ! fnd) {
-	    if (tbfils[(i__2 = i__ + tbcurr * 20 - 21) < 2000 && 0 <= i__2 ? 
+	    if (tbfils[(i__2 = i__ + tbcurr * ftsize - ftsize - 1) < ftsize * tbsize && 0 <= i__2 ? 
 		    i__2 : s_rnge("tbfils", i__2, "ekqmgr_", (ftnlen)2949)] ==
 		     *handle) {
 
@@ -3935,27 +4186,27 @@ L_ekuef:
 /*           list of file handles associated with this table.  Compress */
 /*           this handle out of the list. */
 
-	    i__1 = tbflsz[(i__2 = tbcurr - 1) < 100 && 0 <= i__2 ? i__2 : 
+	    i__1 = tbflsz[(i__2 = tbcurr - 1) < tbsize && 0 <= i__2 ? i__2 : 
 		    s_rnge("tbflsz", i__2, "ekqmgr_", (ftnlen)2975)] - 1;
 	    for (j = i__; j <= i__1; ++j) {
-		tbfils[(i__2 = j + tbcurr * 20 - 21) < 2000 && 0 <= i__2 ? 
+		tbfils[(i__2 = j + tbcurr * ftsize - ftsize - 1) < ftsize * tbsize && 0 <= i__2 ? 
 			i__2 : s_rnge("tbfils", i__2, "ekqmgr_", (ftnlen)2977)
-			] = tbfils[(i__3 = j + 1 + tbcurr * 20 - 21) < 2000 &&
+			] = tbfils[(i__3 = j + 1 + tbcurr * ftsize - ftsize - 1) < ftsize * tbsize &&
 			 0 <= i__3 ? i__3 : s_rnge("tbfils", i__3, "ekqmgr_", 
 			(ftnlen)2977)];
 	    }
-	    tbflsz[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge(
+	    tbflsz[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : s_rnge(
 		    "tbflsz", i__1, "ekqmgr_", (ftnlen)2981)] = tbflsz[(i__2 =
-		     tbcurr - 1) < 100 && 0 <= i__2 ? i__2 : s_rnge("tbflsz", 
+		     tbcurr - 1) < tbsize && 0 <= i__2 ? i__2 : s_rnge("tbflsz", 
 		    i__2, "ekqmgr_", (ftnlen)2981)] - 1;
 
 /*           Traverse the segment list for this table, looking */
 /*           for segments in the specified EK. */
 
-	    seg = tbstpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : 
+	    seg = tbstpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : 
 		    s_rnge("tbstpt", i__1, "ekqmgr_", (ftnlen)2987)];
 	    while(seg > 0) {
-		if (sthan[(i__1 = seg - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge(
+		if (sthan[(i__1 = seg - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge(
 			"sthan", i__1, "ekqmgr_", (ftnlen)2991)] == *handle) {
 
 /*                 This segment is aboard the sinking ship.  Put it */
@@ -3966,7 +4217,7 @@ L_ekuef:
 /*                 all of them in one shot.  Don't crash if the column */
 /*                 descriptor list is empty. */
 
-		    j = stdtpt[(i__1 = seg - 1) < 200 && 0 <= i__1 ? i__1 : 
+		    j = stdtpt[(i__1 = seg - 1) < stsize && 0 <= i__1 ? i__1 : 
 			    s_rnge("stdtpt", i__1, "ekqmgr_", (ftnlen)3001)];
 		    if (j > 0) {
 			k = lnktl_(&j, dtpool);
@@ -3977,10 +4228,10 @@ L_ekuef:
 /*                 This deletion may necessitate updating the segment */
 /*                 list pointer in the parent table's table list entry. */
 
-		    if (seg == tbstpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ?
+		    if (seg == tbstpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ?
 			     i__1 : s_rnge("tbstpt", i__1, "ekqmgr_", (ftnlen)
 			    3013)]) {
-			tbstpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 :
+			tbstpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 :
 				 s_rnge("tbstpt", i__1, "ekqmgr_", (ftnlen)
 				3015)] = lnknxt_(&seg, stpool);
 		    }
@@ -4002,7 +4253,7 @@ L_ekuef:
 /*           not unloading the last loaded file.  However, we may need to */
 /*           update the head-of-list pointer for the table list. */
 
-	    if (tbstpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge(
+	    if (tbstpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : s_rnge(
 		    "tbstpt", i__1, "ekqmgr_", (ftnlen)3045)] <= 0) {
 
 /*              There are no loaded segments left for this table. */
@@ -4014,7 +4265,7 @@ L_ekuef:
 /*              The column attribute entries are linked, so we can free */
 /*              them in one shot. */
 
-		j = tbctpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : 
+		j = tbctpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : 
 			s_rnge("tbctpt", i__1, "ekqmgr_", (ftnlen)3056)];
 		if (j > 0) {
 		    k = lnktl_(&j, ctpool);
@@ -4265,11 +4516,11 @@ L_ekntab:
 /*        Initialize the file table pool, segment table pool, column */
 /*        descriptor pool, column table pool, and table list pool. */
 
-	lnkini_(&c__20, ftpool);
-	lnkini_(&c__200, stpool);
-	lnkini_(&c__10000, dtpool);
-	lnkini_(&c__500, ctpool);
-	lnkini_(&c__100, tbpool);
+	lnkini_(&ftsize, ftpool);
+	lnkini_(&stsize, stpool);
+	lnkini_(&dtsize, dtpool);
+	lnkini_(&ctsize, ctpool);
+	lnkini_(&tbsize, tbpool);
 	fthead = 0;
 	tbhead = 0;
 	first = FALSE_;
@@ -4277,7 +4528,7 @@ L_ekntab:
 
 /*     Return the number of loaded tables. */
 
-    *n = 100 - lnknfn_(tbpool);
+    *n = tbsize - lnknfn_(tbpool);
     return 0;
 /* $Procedure EKTNAM  ( EK, return name of loaded table ) */
 
@@ -4539,11 +4790,11 @@ L_ektnam:
 /*        Initialize the file table pool, segment table pool, column */
 /*        descriptor pool, column table pool, and table list pool. */
 
-	lnkini_(&c__20, ftpool);
-	lnkini_(&c__200, stpool);
-	lnkini_(&c__10000, dtpool);
-	lnkini_(&c__500, ctpool);
-	lnkini_(&c__100, tbpool);
+	lnkini_(&ftsize, ftpool);
+	lnkini_(&stsize, stpool);
+	lnkini_(&dtsize, dtpool);
+	lnkini_(&ctsize, ctpool);
+	lnkini_(&tbsize, tbpool);
 	fthead = 0;
 	tbhead = 0;
 	first = FALSE_;
@@ -4565,7 +4816,7 @@ L_ektnam:
 	++i__;
 	if (i__ == *n) {
 	    fnd = TRUE_;
-	    s_copy(table, tbnams + (((i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? 
+	    s_copy(table, tbnams + (((i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? 
 		    i__1 : s_rnge("tbnams", i__1, "ekqmgr_", (ftnlen)3657)) <<
 		     6), table_len, (ftnlen)64);
 	} else {
@@ -4984,11 +5235,11 @@ L_ekccnt:
 /*        Initialize the file table pool, segment table pool, column */
 /*        descriptor pool, column table pool, and table list pool. */
 
-	lnkini_(&c__20, ftpool);
-	lnkini_(&c__200, stpool);
-	lnkini_(&c__10000, dtpool);
-	lnkini_(&c__500, ctpool);
-	lnkini_(&c__100, tbpool);
+	lnkini_(&ftsize, ftpool);
+	lnkini_(&stsize, stpool);
+	lnkini_(&dtsize, dtpool);
+	lnkini_(&ctsize, ctpool);
+	lnkini_(&tbsize, tbpool);
 	fthead = 0;
 	tbhead = 0;
 	first = FALSE_;
@@ -5000,7 +5251,7 @@ L_ekccnt:
     tbcurr = tbhead;
     fnd = FALSE_;
     while(tbcurr > 0 && ! fnd) {
-	if (eqstr_(table, tbnams + (((i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? 
+	if (eqstr_(table, tbnams + (((i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? 
 		i__1 : s_rnge("tbnams", i__1, "ekqmgr_", (ftnlen)4116)) << 6),
 		 table_len, (ftnlen)64)) {
 	    fnd = TRUE_;
@@ -5020,7 +5271,7 @@ L_ekccnt:
 /*        Count the columns in the attribute table for the current table. */
 
 	*ccount = 0;
-	col = tbctpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge(
+	col = tbctpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : s_rnge(
 		"tbctpt", i__1, "ekqmgr_", (ftnlen)4139)];
 	while(col > 0) {
 	    ++(*ccount);
@@ -5463,11 +5714,11 @@ L_ekcii:
 /*        Initialize the file table pool, segment table pool, column */
 /*        descriptor pool, column table pool, and table list pool. */
 
-	lnkini_(&c__20, ftpool);
-	lnkini_(&c__200, stpool);
-	lnkini_(&c__10000, dtpool);
-	lnkini_(&c__500, ctpool);
-	lnkini_(&c__100, tbpool);
+	lnkini_(&ftsize, ftpool);
+	lnkini_(&stsize, stpool);
+	lnkini_(&dtsize, dtpool);
+	lnkini_(&ctsize, ctpool);
+	lnkini_(&tbsize, tbpool);
 	fthead = 0;
 	tbhead = 0;
 	first = FALSE_;
@@ -5479,7 +5730,7 @@ L_ekcii:
     tbcurr = tbhead;
     fnd = FALSE_;
     while(tbcurr > 0 && ! fnd) {
-	if (eqstr_(table, tbnams + (((i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? 
+	if (eqstr_(table, tbnams + (((i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? 
 		i__1 : s_rnge("tbnams", i__1, "ekqmgr_", (ftnlen)4620)) << 6),
 		 table_len, (ftnlen)64)) {
 	    fnd = TRUE_;
@@ -5498,7 +5749,7 @@ L_ekcii:
 /*     Locate the named column in the column attribute table. */
 
     i__ = 0;
-    col = tbctpt[(i__1 = tbcurr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge("tbc"
+    col = tbctpt[(i__1 = tbcurr - 1) < tbsize && 0 <= i__1 ? i__1 : s_rnge("tbc"
 	    "tpt", i__1, "ekqmgr_", (ftnlen)4644)];
     while(col > 0 && i__ < *cindex) {
 	++i__;
@@ -5507,24 +5758,24 @@ L_ekcii:
 /*           We've found the column.  Set the output arguments using */
 /*           its attributes. */
 
-	    s_copy(column, ctnams + (((i__1 = col - 1) < 500 && 0 <= i__1 ? 
+	    s_copy(column, ctnams + (((i__1 = col - 1) < ctsize && 0 <= i__1 ? 
 		    i__1 : s_rnge("ctnams", i__1, "ekqmgr_", (ftnlen)4655)) <<
 		     5), column_len, (ftnlen)32);
-	    attdsc[0] = ctclas[(i__1 = col - 1) < 500 && 0 <= i__1 ? i__1 : 
+	    attdsc[0] = ctclas[(i__1 = col - 1) < ctsize && 0 <= i__1 ? i__1 : 
 		    s_rnge("ctclas", i__1, "ekqmgr_", (ftnlen)4657)];
-	    attdsc[1] = cttyps[(i__1 = col - 1) < 500 && 0 <= i__1 ? i__1 : 
+	    attdsc[1] = cttyps[(i__1 = col - 1) < ctsize && 0 <= i__1 ? i__1 : 
 		    s_rnge("cttyps", i__1, "ekqmgr_", (ftnlen)4658)];
-	    attdsc[2] = ctlens[(i__1 = col - 1) < 500 && 0 <= i__1 ? i__1 : 
+	    attdsc[2] = ctlens[(i__1 = col - 1) < ctsize && 0 <= i__1 ? i__1 : 
 		    s_rnge("ctlens", i__1, "ekqmgr_", (ftnlen)4659)];
-	    attdsc[3] = ctsizs[(i__1 = col - 1) < 500 && 0 <= i__1 ? i__1 : 
+	    attdsc[3] = ctsizs[(i__1 = col - 1) < ctsize && 0 <= i__1 ? i__1 : 
 		    s_rnge("ctsizs", i__1, "ekqmgr_", (ftnlen)4660)];
-	    if (ctindx[(i__1 = col - 1) < 500 && 0 <= i__1 ? i__1 : s_rnge(
+	    if (ctindx[(i__1 = col - 1) < ctsize && 0 <= i__1 ? i__1 : s_rnge(
 		    "ctindx", i__1, "ekqmgr_", (ftnlen)4662)]) {
 		attdsc[4] = 1;
 	    } else {
 		attdsc[4] = -1;
 	    }
-	    if (ctnull[(i__1 = col - 1) < 500 && 0 <= i__1 ? i__1 : s_rnge(
+	    if (ctnull[(i__1 = col - 1) < ctsize && 0 <= i__1 ? i__1 : s_rnge(
 		    "ctnull", i__1, "ekqmgr_", (ftnlen)4668)]) {
 		attdsc[5] = 1;
 	    } else {
@@ -5756,11 +6007,11 @@ L_eksrch:
 /*        Initialize the file table pool, segment table pool, column */
 /*        descriptor pool, column table pool, and table list pool. */
 
-	lnkini_(&c__20, ftpool);
-	lnkini_(&c__200, stpool);
-	lnkini_(&c__10000, dtpool);
-	lnkini_(&c__500, ctpool);
-	lnkini_(&c__100, tbpool);
+	lnkini_(&ftsize, ftpool);
+	lnkini_(&stsize, stpool);
+	lnkini_(&dtsize, dtpool);
+	lnkini_(&ctsize, ctpool);
+	lnkini_(&tbsize, tbpool);
 	fthead = 0;
 	tbhead = 0;
 	first = FALSE_;
@@ -5803,7 +6054,7 @@ L_eksrch:
 	tbcurr = tbhead;
 	fnd = FALSE_;
 	while(tbcurr > 0 && ! fnd) {
-	    if (s_cmp(tbnams + (((i__2 = tbcurr - 1) < 100 && 0 <= i__2 ? 
+	    if (s_cmp(tbnams + (((i__2 = tbcurr - 1) < tbsize && 0 <= i__2 ? 
 		    i__2 : s_rnge("tbnams", i__2, "ekqmgr_", (ftnlen)4973)) <<
 		     6), frmtab + (((i__3 = i__ - 1) < 10 && 0 <= i__3 ? i__3 
 		    : s_rnge("frmtab", i__3, "ekqmgr_", (ftnlen)4973)) << 6), 
@@ -5938,7 +6189,7 @@ L_eksrch:
 
 	    tab = tptvec[(i__3 = t + 5) < 16 && 0 <= i__3 ? i__3 : s_rnge(
 		    "tptvec", i__3, "ekqmgr_", (ftnlen)5087)];
-	    i__ = tbstpt[(i__3 = tab - 1) < 100 && 0 <= i__3 ? i__3 : s_rnge(
+	    i__ = tbstpt[(i__3 = tab - 1) < tbsize && 0 <= i__3 ? i__3 : s_rnge(
 		    "tbstpt", i__3, "ekqmgr_", (ftnlen)5088)];
 	    nsv = 0;
 	    while(i__ > 0) {
@@ -5966,7 +6217,7 @@ L_eksrch:
 /*           Find the matching rows in the segments belonging to the */
 /*           current table. */
 
-	    seg = tbstpt[(i__3 = tab - 1) < 100 && 0 <= i__3 ? i__3 : s_rnge(
+	    seg = tbstpt[(i__3 = tab - 1) < tbsize && 0 <= i__3 ? i__3 : s_rnge(
 		    "tbstpt", i__3, "ekqmgr_", (ftnlen)5117)];
 	    nseg = 0;
 	    rtotal = 0;
@@ -6059,7 +6310,7 @@ L_eksrch:
 /*                     Look up the column descriptor for this */
 /*                     constraint. */
 
-			j = stdtpt[(i__4 = seg - 1) < 200 && 0 <= i__4 ? i__4 
+			j = stdtpt[(i__4 = seg - 1) < stsize && 0 <= i__4 ? i__4 
 				: s_rnge("stdtpt", i__4, "ekqmgr_", (ftnlen)
 				5197)];
 			i__5 = lcidx[(i__4 = i__ - 1) < 1000 && 0 <= i__4 ? 
@@ -6068,7 +6319,7 @@ L_eksrch:
 			for (k = 2; k <= i__5; ++k) {
 			    j = lnknxt_(&j, dtpool);
 			}
-			movei_(&dtdscs[(i__5 = j * 11 - 11) < 110000 && 0 <= 
+			movei_(&dtdscs[(i__5 = j * 11 - 11) < dtsize * 11 && 0 <= 
 				i__5 ? i__5 : s_rnge("dtdscs", i__5, "ekqmgr_"
 				, (ftnlen)5203)], &c__11, &ldscrs[(i__4 = i__ 
 				* 11 - 11) < 11000 && 0 <= i__4 ? i__4 : 
@@ -6076,11 +6327,11 @@ L_eksrch:
 				5203)]);
 		    }
 		}
-		zzekkey_(&sthan[(i__3 = seg - 1) < 200 && 0 <= i__3 ? i__3 : 
+		zzekkey_(&sthan[(i__3 = seg - 1) < stsize && 0 <= i__3 ? i__3 : 
 			s_rnge("sthan", i__3, "ekqmgr_", (ftnlen)5210)], &
-			stdscs[(i__5 = seg * 24 - 24) < 4800 && 0 <= i__5 ? 
+			stdscs[(i__5 = seg * 24 - 24) < stsize * 24 && 0 <= i__5 ? 
 			i__5 : s_rnge("stdscs", i__5, "ekqmgr_", (ftnlen)5210)
-			], &stnrow[(i__4 = seg - 1) < 200 && 0 <= i__4 ? i__4 
+			], &stnrow[(i__4 = seg - 1) < stsize && 0 <= i__4 ? i__4 
 			: s_rnge("stnrow", i__4, "ekqmgr_", (ftnlen)5210)], &
 			cjsize, lcidx, ldscrs, ops, dtype, eqryc, cbegs, 
 			cends, dvals, ivals, activv, &key, keydsc, &begidx, &
@@ -6100,7 +6351,7 @@ L_eksrch:
 
 		    indexd = FALSE_;
 		    begidx = 1;
-		    endidx = stnrow[(i__3 = seg - 1) < 200 && 0 <= i__3 ? 
+		    endidx = stnrow[(i__3 = seg - 1) < stsize && 0 <= i__3 ? 
 			    i__3 : s_rnge("stnrow", i__3, "ekqmgr_", (ftnlen)
 			    5238)];
 		}
@@ -6153,7 +6404,7 @@ L_eksrch:
 
 /*                       Look up the column descriptor for this */
 /*                       constraint. */
-			    j = stdtpt[(i__5 = seg - 1) < 200 && 0 <= i__5 ? 
+			    j = stdtpt[(i__5 = seg - 1) < stsize && 0 <= i__5 ? 
 				    i__5 : s_rnge("stdtpt", i__5, "ekqmgr_", (
 				    ftnlen)5286)];
 			    i__4 = lcidx[(i__5 = i__ - 1) < 1000 && 0 <= i__5 
@@ -6162,13 +6413,13 @@ L_eksrch:
 			    for (k = 2; k <= i__4; ++k) {
 				j = lnknxt_(&j, dtpool);
 			    }
-			    movei_(&dtdscs[(i__4 = j * 11 - 11) < 110000 && 0 
+			    movei_(&dtdscs[(i__4 = j * 11 - 11) < dtsize * 11 && 0 
 				    <= i__4 ? i__4 : s_rnge("dtdscs", i__4, 
 				    "ekqmgr_", (ftnlen)5292)], &c__11, &
 				    ldscrs[(i__5 = i__ * 11 - 11) < 11000 && 
 				    0 <= i__5 ? i__5 : s_rnge("ldscrs", i__5, 
 				    "ekqmgr_", (ftnlen)5292)]);
-			    j = stdtpt[(i__4 = seg - 1) < 200 && 0 <= i__4 ? 
+			    j = stdtpt[(i__4 = seg - 1) < stsize && 0 <= i__4 ? 
 				    i__4 : s_rnge("stdtpt", i__4, "ekqmgr_", (
 				    ftnlen)5295)];
 			    i__5 = rcidx[(i__4 = i__ - 1) < 1000 && 0 <= i__4 
@@ -6177,7 +6428,7 @@ L_eksrch:
 			    for (k = 2; k <= i__5; ++k) {
 				j = lnknxt_(&j, dtpool);
 			    }
-			    movei_(&dtdscs[(i__5 = j * 11 - 11) < 110000 && 0 
+			    movei_(&dtdscs[(i__5 = j * 11 - 11) < dtsize * 11 && 0 
 				    <= i__5 ? i__5 : s_rnge("dtdscs", i__5, 
 				    "ekqmgr_", (ftnlen)5301)], &c__11, &
 				    rdscrs[(i__4 = i__ * 11 - 11) < 11000 && 
@@ -6195,7 +6446,7 @@ L_eksrch:
 			i__3 = endidx;
 			for (r__ = begidx; r__ <= i__3; ++r__) {
 			    if (indexd) {
-				zzekixlk_(&sthan[(i__5 = seg - 1) < 200 && 0 
+				zzekixlk_(&sthan[(i__5 = seg - 1) < stsize && 0 
 					<= i__5 ? i__5 : s_rnge("sthan", i__5,
 					 "ekqmgr_", (ftnlen)5320)], keydsc, &
 					r__, &rowidx);
@@ -6203,10 +6454,10 @@ L_eksrch:
 
 /*                          Look up the record pointer for row R. */
 
-				zzekrplk_(&sthan[(i__5 = seg - 1) < 200 && 0 
+				zzekrplk_(&sthan[(i__5 = seg - 1) < stsize && 0 
 					<= i__5 ? i__5 : s_rnge("sthan", i__5,
 					 "ekqmgr_", (ftnlen)5328)], &stdscs[(
-					i__4 = seg * 24 - 24) < 4800 && 0 <= 
+					i__4 = seg * 24 - 24) < stsize * 24 && 0 <= 
 					i__4 ? i__4 : s_rnge("stdscs", i__4, 
 					"ekqmgr_", (ftnlen)5328)], &r__, &
 					rowidx);
@@ -6217,10 +6468,10 @@ L_eksrch:
 /*                       of default column entry element indices. */
 
 			    vmtch = zzekrmch_(&cjsize, activv, &sthan[(i__5 = 
-				    seg - 1) < 200 && 0 <= i__5 ? i__5 : 
+				    seg - 1) < stsize && 0 <= i__5 ? i__5 : 
 				    s_rnge("sthan", i__5, "ekqmgr_", (ftnlen)
 				    5339)], &stdscs[(i__4 = seg * 24 - 24) < 
-				    4800 && 0 <= i__4 ? i__4 : s_rnge("stdscs"
+				    stsize * 24 && 0 <= i__4 ? i__4 : s_rnge("stdscs"
 				    , i__4, "ekqmgr_", (ftnlen)5339)], ldscrs,
 				     &rowidx, lelts, ops, dtype, eqryc, cbegs,
 				     cends, dvals, ivals, eqryc_len);
@@ -6238,10 +6489,10 @@ L_eksrch:
 					i__4 = j - 1) < 1000 && 0 <= i__4 ? 
 					i__4 : s_rnge("activc", i__4, "ekqmg"
 					"r_", (ftnlen)5358)], &sthan[(i__6 = 
-					seg - 1) < 200 && 0 <= i__6 ? i__6 : 
+					seg - 1) < stsize && 0 <= i__6 ? i__6 : 
 					s_rnge("sthan", i__6, "ekqmgr_", (
 					ftnlen)5358)], &stdscs[(i__7 = seg * 
-					24 - 24) < 4800 && 0 <= i__7 ? i__7 : 
+					24 - 24) < stsize * 24 && 0 <= i__7 ? i__7 : 
 					s_rnge("stdscs", i__7, "ekqmgr_", (
 					ftnlen)5358)], &ldscrs[(i__8 = j * 11 
 					- 11) < 11000 && 0 <= i__8 ? i__8 : 
@@ -6250,10 +6501,10 @@ L_eksrch:
 					i__9 = j - 1) < 1000 && 0 <= i__9 ? 
 					i__9 : s_rnge("ops", i__9, "ekqmgr_", 
 					(ftnlen)5358)], &sthan[(i__10 = seg - 
-					1) < 200 && 0 <= i__10 ? i__10 : 
+					1) < stsize && 0 <= i__10 ? i__10 : 
 					s_rnge("sthan", i__10, "ekqmgr_", (
 					ftnlen)5358)], &stdscs[(i__11 = seg * 
-					24 - 24) < 4800 && 0 <= i__11 ? i__11 
+					24 - 24) < stsize * 24 && 0 <= i__11 ? i__11 
 					: s_rnge("stdscs", i__11, "ekqmgr_", (
 					ftnlen)5358)], &rdscrs[(i__12 = j * 
 					11 - 11) < 11000 && 0 <= i__12 ? 
@@ -6293,7 +6544,7 @@ L_eksrch:
 /*                          Look up the record pointer for row R */
 /*                          from the column index. */
 
-				zzekixlk_(&sthan[(i__5 = seg - 1) < 200 && 0 
+				zzekixlk_(&sthan[(i__5 = seg - 1) < stsize && 0 
 					<= i__5 ? i__5 : s_rnge("sthan", i__5,
 					 "ekqmgr_", (ftnlen)5411)], keydsc, &
 					r__, &rowidx);
@@ -6301,10 +6552,10 @@ L_eksrch:
 
 /*                          Look up the record pointer for row R. */
 
-				zzekrplk_(&sthan[(i__5 = seg - 1) < 200 && 0 
+				zzekrplk_(&sthan[(i__5 = seg - 1) < stsize && 0 
 					<= i__5 ? i__5 : s_rnge("sthan", i__5,
 					 "ekqmgr_", (ftnlen)5419)], &stdscs[(
-					i__4 = seg * 24 - 24) < 4800 && 0 <= 
+					i__4 = seg * 24 - 24) < stsize * 24 && 0 <= 
 					i__4 ? i__4 : s_rnge("stdscs", i__4, 
 					"ekqmgr_", (ftnlen)5419)], &r__, &
 					rowidx);
@@ -6465,13 +6716,13 @@ L_eksrch:
 
 	tab = tptvec[(i__2 = tabidx + 5) < 16 && 0 <= i__2 ? i__2 : s_rnge(
 		"tptvec", i__2, "ekqmgr_", (ftnlen)5587)];
-	j = tbctpt[(i__2 = tab - 1) < 100 && 0 <= i__2 ? i__2 : s_rnge("tbct"
+	j = tbctpt[(i__2 = tab - 1) < tbsize && 0 <= i__2 ? i__2 : s_rnge("tbct"
 		"pt", i__2, "ekqmgr_", (ftnlen)5588)];
 	col = 0;
 	fnd = FALSE_;
 	while(j > 0 && ! fnd) {
 	    ++col;
-	    if (s_cmp(ctnams + (((i__2 = j - 1) < 500 && 0 <= i__2 ? i__2 : 
+	    if (s_cmp(ctnams + (((i__2 = j - 1) < ctsize && 0 <= i__2 ? i__2 : 
 		    s_rnge("ctnams", i__2, "ekqmgr_", (ftnlen)5596)) << 5), 
 		    colnam, (ftnlen)32, (ftnlen)32) == 0) {
 		fnd = TRUE_;
@@ -7113,17 +7364,17 @@ L_eknelt:
 	    "ec", i__1, "ekqmgr_", (ftnlen)6250)];
     col = selcol[(i__1 = *selidx - 1) < 50 && 0 <= i__1 ? i__1 : s_rnge("sel"
 	    "col", i__1, "ekqmgr_", (ftnlen)6251)];
-    colptr = stdtpt[(i__1 = seg - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge("std"
+    colptr = stdtpt[(i__1 = seg - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge("std"
 	    "tpt", i__1, "ekqmgr_", (ftnlen)6253)];
     i__1 = col;
     for (i__ = 2; i__ <= i__1; ++i__) {
 	colptr = lnknxt_(&colptr, dtpool);
     }
-    *nelt = zzekesiz_(&sthan[(i__1 = seg - 1) < 200 && 0 <= i__1 ? i__1 : 
+    *nelt = zzekesiz_(&sthan[(i__1 = seg - 1) < stsize && 0 <= i__1 ? i__1 : 
 	    s_rnge("sthan", i__1, "ekqmgr_", (ftnlen)6259)], &stdscs[(i__2 = 
-	    seg * 24 - 24) < 4800 && 0 <= i__2 ? i__2 : s_rnge("stdscs", i__2,
+	    seg * 24 - 24) < stsize * 24 && 0 <= i__2 ? i__2 : s_rnge("stdscs", i__2,
 	     "ekqmgr_", (ftnlen)6259)], &dtdscs[(i__3 = colptr * 11 - 11) < 
-	    110000 && 0 <= i__3 ? i__3 : s_rnge("dtdscs", i__3, "ekqmgr_", (
+	    dtsize * 11 && 0 <= i__3 ? i__3 : s_rnge("dtdscs", i__3, "ekqmgr_", (
 	    ftnlen)6259)], &rowidx);
     return 0;
 /* $Procedure EKGC  ( EK, get event data, character ) */
@@ -7885,13 +8136,13 @@ L_ekgc:
 
 /*     Make sure the column has character type. */
 
-    if (cttyps[(i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 : s_rnge("cttyps"
+    if (cttyps[(i__1 = colptr - 1) < ctsize && 0 <= i__1 ? i__1 : s_rnge("cttyps"
 	    , i__1, "ekqmgr_", (ftnlen)7040)] != 1) {
 	setmsg_("Column # has data type #.", (ftnlen)25);
-	errch_("#", ctnams + (((i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 :
+	errch_("#", ctnams + (((i__1 = colptr - 1) < ctsize && 0 <= i__1 ? i__1 :
 		 s_rnge("ctnams", i__1, "ekqmgr_", (ftnlen)7043)) << 5), (
 		ftnlen)1, (ftnlen)32);
-	errch_("#", chtype + (((i__2 = cttyps[(i__1 = colptr - 1) < 500 && 0 
+	errch_("#", chtype + (((i__2 = cttyps[(i__1 = colptr - 1) < ctsize && 0 
 		<= i__1 ? i__1 : s_rnge("cttyps", i__1, "ekqmgr_", (ftnlen)
 		7044)] - 1) < 4 && 0 <= i__2 ? i__2 : s_rnge("chtype", i__2, 
 		"ekqmgr_", (ftnlen)7044)) << 2), (ftnlen)1, (ftnlen)4);
@@ -7934,7 +8185,7 @@ L_ekgc:
 	    "rowvec", i__1, "ekqmgr_", (ftnlen)7082)];
     seg = segvec[(i__1 = tabidx - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("segv"
 	    "ec", i__1, "ekqmgr_", (ftnlen)7083)];
-    j = stdtpt[(i__1 = seg - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge("stdtpt", 
+    j = stdtpt[(i__1 = seg - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge("stdtpt", 
 	    i__1, "ekqmgr_", (ftnlen)7085)];
     i__1 = col;
     for (i__ = 2; i__ <= i__1; ++i__) {
@@ -7943,10 +8194,10 @@ L_ekgc:
 
 /*     Look up the element. */
 
-    zzekrsc_(&sthan[(i__1 = seg - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge("sth"
+    zzekrsc_(&sthan[(i__1 = seg - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge("sth"
 	    "an", i__1, "ekqmgr_", (ftnlen)7094)], &stdscs[(i__2 = seg * 24 - 
-	    24) < 4800 && 0 <= i__2 ? i__2 : s_rnge("stdscs", i__2, "ekqmgr_",
-	     (ftnlen)7094)], &dtdscs[(i__3 = j * 11 - 11) < 110000 && 0 <= 
+	    24) < stsize * 24 && 0 <= i__2 ? i__2 : s_rnge("stdscs", i__2, "ekqmgr_",
+	     (ftnlen)7094)], &dtdscs[(i__3 = j * 11 - 11) < dtsize * 11 && 0 <= 
 	    i__3 ? i__3 : s_rnge("dtdscs", i__3, "ekqmgr_", (ftnlen)7094)], &
 	    rowidx, elment, &cvlen, cdata, null, found, cdata_len);
     chkout_("EKGC", (ftnlen)4);
@@ -8877,15 +9128,15 @@ L_ekgd:
 
 /*     Make sure the column has double precision or `time' type. */
 
-    if (cttyps[(i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 : s_rnge("cttyps"
+    if (cttyps[(i__1 = colptr - 1) < ctsize && 0 <= i__1 ? i__1 : s_rnge("cttyps"
 	    , i__1, "ekqmgr_", (ftnlen)8050)] != 2 && cttyps[(i__2 = colptr - 
-	    1) < 500 && 0 <= i__2 ? i__2 : s_rnge("cttyps", i__2, "ekqmgr_", (
+	    1) < ctsize && 0 <= i__2 ? i__2 : s_rnge("cttyps", i__2, "ekqmgr_", (
 	    ftnlen)8050)] != 4) {
 	setmsg_("Column # has data type #.", (ftnlen)25);
-	errch_("#", ctnams + (((i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 :
+	errch_("#", ctnams + (((i__1 = colptr - 1) < ctsize && 0 <= i__1 ? i__1 :
 		 s_rnge("ctnams", i__1, "ekqmgr_", (ftnlen)8054)) << 5), (
 		ftnlen)1, (ftnlen)32);
-	errch_("#", chtype + (((i__2 = cttyps[(i__1 = colptr - 1) < 500 && 0 
+	errch_("#", chtype + (((i__2 = cttyps[(i__1 = colptr - 1) < ctsize && 0 
 		<= i__1 ? i__1 : s_rnge("cttyps", i__1, "ekqmgr_", (ftnlen)
 		8055)] - 1) < 4 && 0 <= i__2 ? i__2 : s_rnge("chtype", i__2, 
 		"ekqmgr_", (ftnlen)8055)) << 2), (ftnlen)1, (ftnlen)4);
@@ -8928,7 +9179,7 @@ L_ekgd:
 	    "rowvec", i__1, "ekqmgr_", (ftnlen)8093)];
     seg = segvec[(i__1 = tabidx - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("segv"
 	    "ec", i__1, "ekqmgr_", (ftnlen)8094)];
-    j = stdtpt[(i__1 = seg - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge("stdtpt", 
+    j = stdtpt[(i__1 = seg - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge("stdtpt", 
 	    i__1, "ekqmgr_", (ftnlen)8096)];
     i__1 = col;
     for (i__ = 2; i__ <= i__1; ++i__) {
@@ -8937,10 +9188,10 @@ L_ekgd:
 
 /*     Look up the element. */
 
-    zzekrsd_(&sthan[(i__1 = seg - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge("sth"
+    zzekrsd_(&sthan[(i__1 = seg - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge("sth"
 	    "an", i__1, "ekqmgr_", (ftnlen)8105)], &stdscs[(i__2 = seg * 24 - 
-	    24) < 4800 && 0 <= i__2 ? i__2 : s_rnge("stdscs", i__2, "ekqmgr_",
-	     (ftnlen)8105)], &dtdscs[(i__3 = j * 11 - 11) < 110000 && 0 <= 
+	    24) < stsize * 24 && 0 <= i__2 ? i__2 : s_rnge("stdscs", i__2, "ekqmgr_",
+	     (ftnlen)8105)], &dtdscs[(i__3 = j * 11 - 11) < dtsize * 11 && 0 <= 
 	    i__3 ? i__3 : s_rnge("dtdscs", i__3, "ekqmgr_", (ftnlen)8105)], &
 	    rowidx, elment, ddata, null, found);
     chkout_("EKGD", (ftnlen)4);
@@ -9694,13 +9945,13 @@ L_ekgi:
 
 /*     Make sure the column has integer type. */
 
-    if (cttyps[(i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 : s_rnge("cttyps"
+    if (cttyps[(i__1 = colptr - 1) < ctsize && 0 <= i__1 ? i__1 : s_rnge("cttyps"
 	    , i__1, "ekqmgr_", (ftnlen)8883)] != 3) {
 	setmsg_("Column # has data type #.", (ftnlen)25);
-	errch_("#", ctnams + (((i__1 = colptr - 1) < 500 && 0 <= i__1 ? i__1 :
+	errch_("#", ctnams + (((i__1 = colptr - 1) < ctsize && 0 <= i__1 ? i__1 :
 		 s_rnge("ctnams", i__1, "ekqmgr_", (ftnlen)8886)) << 5), (
 		ftnlen)1, (ftnlen)32);
-	errch_("#", chtype + (((i__2 = cttyps[(i__1 = colptr - 1) < 500 && 0 
+	errch_("#", chtype + (((i__2 = cttyps[(i__1 = colptr - 1) < ctsize && 0 
 		<= i__1 ? i__1 : s_rnge("cttyps", i__1, "ekqmgr_", (ftnlen)
 		8887)] - 1) < 4 && 0 <= i__2 ? i__2 : s_rnge("chtype", i__2, 
 		"ekqmgr_", (ftnlen)8887)) << 2), (ftnlen)1, (ftnlen)4);
@@ -9743,7 +9994,7 @@ L_ekgi:
 	    "rowvec", i__1, "ekqmgr_", (ftnlen)8925)];
     seg = segvec[(i__1 = tabidx - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("segv"
 	    "ec", i__1, "ekqmgr_", (ftnlen)8926)];
-    j = stdtpt[(i__1 = seg - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge("stdtpt", 
+    j = stdtpt[(i__1 = seg - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge("stdtpt", 
 	    i__1, "ekqmgr_", (ftnlen)8928)];
     i__1 = col;
     for (i__ = 2; i__ <= i__1; ++i__) {
@@ -9752,10 +10003,10 @@ L_ekgi:
 
 /*     Look up the element. */
 
-    zzekrsi_(&sthan[(i__1 = seg - 1) < 200 && 0 <= i__1 ? i__1 : s_rnge("sth"
+    zzekrsi_(&sthan[(i__1 = seg - 1) < stsize && 0 <= i__1 ? i__1 : s_rnge("sth"
 	    "an", i__1, "ekqmgr_", (ftnlen)8937)], &stdscs[(i__2 = seg * 24 - 
-	    24) < 4800 && 0 <= i__2 ? i__2 : s_rnge("stdscs", i__2, "ekqmgr_",
-	     (ftnlen)8937)], &dtdscs[(i__3 = j * 11 - 11) < 110000 && 0 <= 
+	    24) < stsize * 24 && 0 <= i__2 ? i__2 : s_rnge("stdscs", i__2, "ekqmgr_",
+	     (ftnlen)8937)], &dtdscs[(i__3 = j * 11 - 11) < dtsize * 11 && 0 <= 
 	    i__3 ? i__3 : s_rnge("dtdscs", i__3, "ekqmgr_", (ftnlen)8937)], &
 	    rowidx, elment, idata, null, found);
     chkout_("EKGI", (ftnlen)4);
@@ -9893,3 +10144,11 @@ L_ekgi:
 	    ftnint)0, (ftnint)0, (ftnint)0);
     }
 
+/* Return the current catalog generation. */
+
+/* Subroutine */ int zzekqgen_(integer *gen)
+{
+    *gen = ctgen;
+    return 0;
+}
+
@@ -0,0 +1,200 @@
+/*
+
+-Procedure sgp4ev_c ( SGP4 evaluate element sets )
+
+-Abstract
+
+   Evaluate two-line element sets initialized by sgp4in_c at a set of
+   epochs.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   None.
+
+-Keywords
+
+   EPHEMERIS
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+
+
+   void sgp4ev_c ( SpiceInt            n,
+                   ConstSpiceDouble    recs   [][SPICE_SGP4_RECLEN],
+                   SpiceInt            nep,
+                   ConstSpiceDouble    ets    [],
+                   SpiceDouble         states [][6] )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   n          I   Number of element sets
+   recs       I   Initialized element sets
+   nep        I   Number of epochs
+   ets        I   Epochs in seconds past ephemeris epoch J2000
+   states     O   Evaluated states
+   SPICE_SGP4_RECLEN
+              P   Length of an initialized element set
+
+-Detailed_Input
+
+   n           is the number of element sets.
+
+   recs        is an array of `n' element sets initialized by
+               sgp4in_c.
+
+   nep         is the number of epochs.
+
+   ets         is an array of `nep' epochs in seconds past ephemeris
+               epoch J2000.
+
+-Detailed_Output
+
+   states      is an array of n*nep states. The state of element set
+               `i' at epoch `j' is
+
+                  states[ i*nep + j ]
+
+               Units are km and km/sec relative to the TEME reference
+               frame. Each state is exactly the state evsgp4_c would
+               produce from the same element set and epoch.
+
+-Parameters
+
+   SPICE_SGP4_RECLEN
+
+               is the length of each record. SPICE_SGP4_RECLEN is
+               declared in SpiceSPK.h.
+
+-Exceptions
+
+   1)  If `n' or `nep' is negative, the error SPICE(INVALIDCOUNT) is
+       signaled.
+
+   2)  If a problem occurs when evaluating an element set, an error
+       is signaled by a routine in the call tree of this routine. The
+       states of later element sets and epochs are not computed.
+
+-Files
+
+   None.
+
+-Particulars
+
+   See sgp4in_c.
+
+   Each evaluation starts from the state saved by sgp4in_c, so the
+   result for one element set and epoch does not depend on the order
+   of the evaluations.
+
+-Examples
+
+   See sgp4in_c.
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0, 16-OCT-2026
+
+-Index_Entries
+
+   evaluate two-line element sets at many epochs
+
+-&
+*/
+
+{ /* Begin sgp4ev_c */
+
+   /*
+   Local variables
+   */
+   SpiceDouble             t;
+   SpiceInt                i;
+   SpiceInt                j;
+
+
+   /*
+   Participate in error tracing.
+   */
+   chkin_c ( "sgp4ev_c" );
+
+   if ( ( n < 0 ) || ( nep < 0 ) )
+   {
+      setmsg_c ( "The numbers of element sets and epochs must be "
+                 "non-negative but were # and #."                  );
+      errint_c ( "#", n                                            );
+      errint_c ( "#", nep                                          );
+      sigerr_c ( "SPICE(INVALIDCOUNT)"                             );
+      chkout_c ( "sgp4ev_c"                                        );
+      return;
+   }
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      for ( j = 0;  j < nep;  j++ )
+      {
+         /*
+         XXSGP4E updates the saved state as it goes, so restore the
+         state before every evaluation. Compute the time from the
+         epoch of the elements in minutes as evsgp4_c does.
+         */
+         xxsgp4r_ ( ( doublereal * ) recs[i] + 1 );
+
+         t = ( ets[j] - recs[i][0] ) / 60.;
+
+         xxsgp4e_ ( ( doublereal * ) &t,
+                    ( doublereal * ) states[ i*nep + j ] );
+
+         if ( failed_c() )
+         {
+            chkout_c ( "sgp4ev_c" );
+            return;
+         }
+      }
+   }
+
+   chkout_c ( "sgp4ev_c" );
+
+} /* End sgp4ev_c */
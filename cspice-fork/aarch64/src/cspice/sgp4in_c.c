@@ -0,0 +1,194 @@
+/*
+
+-Procedure sgp4in_c ( SGP4 initialize element sets )
+
+-Abstract
+
+   Initialize two-line element sets for repeated evaluation with
+   sgp4ev_c.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   None.
+
+-Keywords
+
+   EPHEMERIS
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+
+
+   void sgp4in_c ( ConstSpiceDouble    geophs [8],
+                   SpiceInt            n,
+                   ConstSpiceDouble    elems  [][10],
+                   SpiceDouble         recs   [][SPICE_SGP4_RECLEN] )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   geophs     I   Geophysical constants
+   n          I   Number of element sets
+   elems      I   Two-line element data
+   recs       O   Initialized element sets
+   SPICE_SGP4_RECLEN
+              P   Length of an initialized element set
+
+-Detailed_Input
+
+   geophs      is a collection of 8 geophysical constants needed
+               for computing a state, as for evsgp4_c.
+
+   n           is the number of element sets.
+
+   elems       is an array of `n' element sets, each as for evsgp4_c.
+
+-Detailed_Output
+
+   recs        is an array of `n' records, each holding one of the
+               element sets initialized for evaluation by sgp4ev_c.
+               The records depend on `geophs' as well as on `elems'.
+
+-Parameters
+
+   SPICE_SGP4_RECLEN
+
+               is the length of each record. SPICE_SGP4_RECLEN is
+               declared in SpiceSPK.h.
+
+-Exceptions
+
+   1)  No checks are made on the reasonableness of the inputs.
+
+   2)  If `n' is negative, the error SPICE(INVALIDCOUNT) is signaled.
+
+   3)  If a problem occurs when initializing an element set, an
+       error is signaled by a routine in the call tree of this
+       routine. The remaining element sets are not initialized.
+
+-Files
+
+   None.
+
+-Particulars
+
+   evsgp4_c initializes its element set on every call, which includes
+   a time conversion and, for deep space orbits, the setup of the
+   resonance terms. This routine does that work once per element set,
+   so that many element sets can be evaluated at many epochs by
+   sgp4ev_c with no further initialization.
+
+-Examples
+
+   1)    /.
+         Evaluate `n' element sets at `m' epochs.
+         ./
+         sgp4in_c ( geophs, n, elems, recs );
+         sgp4ev_c ( n, recs, m, ets, states );
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0, 16-OCT-2026
+
+-Index_Entries
+
+   initialize two-line element sets for evaluation
+
+-&
+*/
+
+{ /* Begin sgp4in_c */
+
+   /*
+   Local constants
+   */
+   static integer          opmode = 1;
+
+   /*
+   Local variables
+   */
+   SpiceInt                i;
+
+
+   /*
+   Participate in error tracing.
+   */
+   chkin_c ( "sgp4in_c" );
+
+   if ( n < 0 )
+   {
+      setmsg_c ( "The number of element sets must be non-negative "
+                 "but was #."                                       );
+      errint_c ( "#", n                                             );
+      sigerr_c ( "SPICE(INVALIDCOUNT)"                              );
+      chkout_c ( "sgp4in_c"                                         );
+      return;
+   }
+
+   for ( i = 0;  i < n;  i++ )
+   {
+      xxsgp4i_ ( ( doublereal * ) geophs,
+                 ( doublereal * ) elems[i],
+                 ( integer    * ) &opmode   );
+
+      if ( failed_c() )
+      {
+         chkout_c ( "sgp4in_c" );
+         return;
+      }
+
+      /*
+      The first element of each record is the epoch of the elements;
+      the rest is the state of the SGP4 initializer.
+      */
+      recs[i][0] = elems[i][9];
+
+      xxsgp4s_ ( ( doublereal * ) recs[i] + 1 );
+   }
+
+   chkout_c ( "sgp4in_c" );
+
+} /* End sgp4in_c */
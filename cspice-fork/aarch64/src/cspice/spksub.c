@@ -9,6 +9,7 @@
 
 static integer c__2 = 2;
 static integer c__6 = 6;
+static integer c__16 = 16;
 
 /* $Procedure SPKSUB ( S/P Kernel, subset ) */
 /* Subroutine */ int spksub_(integer *handle, doublereal *descr, char *ident, 
@@ -45,6 +46,10 @@ static integer c__6 = 6;
     extern /* Subroutine */ int dafbna_(integer *, doublereal *, char *, 
 	    ftnlen);
     integer ic[6];
+    static integer suptyp[16] = { 1,2,3,5,8,9,10,12,13,14,15,17,18,19,20,
+	    21 };
+    extern integer isrchi_(integer *, integer *, integer *);
+    extern /* Subroutine */ int zzdafcpa_(integer *, integer *, integer *);
     extern /* Subroutine */ int dafena_(void), sigerr_(char *, ftnlen), 
 	    chkout_(char *, ftnlen), setmsg_(char *, ftnlen), errint_(char *, 
 	    integer *, ftnlen);
@@ -140,6 +145,10 @@ static integer c__6 = 6;
 /*     2)  If the segment type is not supported by the current version of */
 /*         SPKSUB, the error SPICE(SPKTYPENOTSUPP) is signaled. */
 
+/*     3)  If an error occurs while reading the source segment or */
+/*         writing the new one, the error is signaled by a routine in */
+/*         the call tree of this routine. */
+
 /* $ Files */
 
 /*     A new segment, which contains a subset of the data in the */
@@ -165,6 +174,11 @@ static integer c__6 = 6;
 /*     2)  The beginning and ending segment addresses (IC(5) and IC(6)) */
 /*         are changed to reflect the location of the new segment. */
 
+/*     When BEGIN and END are the initial and final epochs of the */
+/*     segment, the new segment is a copy of the original: its data */
+/*     are copied in bulk, without being interpreted by the */
+/*     type-specific subsetting routines. */
+
 /* $ Examples */
 
 /*     In the following code fragment, the descriptor for each segment */
@@ -216,6 +230,11 @@ static integer c__6 = 6;
 
 /* $ Version */
 
+/* -    SPICELIB Version 9.2.0, 16-OCT-2026 */
+
+/*        A subset covering the whole segment is now made by copying */
+/*        the segment's data with ZZDAFCPA. */
+
 /* -    SPICELIB Version 9.1.0, 14-APR-2021 (JDR) */
 
 /*        Added IMPLICIT NONE statement. */
@@ -320,9 +339,16 @@ static integer c__6 = 6;
     dc[1] = *end;
     dafps_(&c__2, &c__6, dc, ic, ndscr);
 
-/*     Let the type-specific (SPKSnn) routines decide what to move. */
+/*     A subset covering the whole segment of a supported type is the */
+/*     segment itself, so copy its data as they are. Otherwise let the */
+/*     type-specific (SPKSnn) routines decide what to move. */
 
-    if (type__ == 1) {
+    if (*begin == alpha && *end == omega && isrchi_(&type__, &c__16, 
+	    suptyp) > 0) {
+	dafbna_(newh, ndscr, ident, ident_len);
+	zzdafcpa_(handle, &baddr, &eaddr);
+	dafena_();
+    } else if (type__ == 1) {
 	dafbna_(newh, ndscr, ident, ident_len);
 	spks01_(handle, &baddr, &eaddr, begin, end);
 	dafena_();
@@ -0,0 +1,162 @@
+/*
+
+-Procedure trcmod_c  ( Set the trace mode )
+
+-Abstract
+
+   Select how the traceback is maintained as modules check in and out.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   ERROR
+
+-Keywords
+
+   ERROR
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+
+
+   void trcmod_c ( ConstSpiceChar  * mode )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   mode       I   "FULL", "LAZY" or "OFF".
+
+-Detailed_Input
+
+   mode        is the trace mode. Case and blanks are not significant.
+               The modes are:
+
+                  "FULL"   Each module name is copied onto the trace
+                           stack as the module checks in, and compared
+                           with the name given as it checks out. This
+                           is the default.
+
+                  "LAZY"   Only the address and length of each module
+                           name are recorded as the module checks in.
+                           The names are copied when a traceback is
+                           requested, so tracebacks are the same as in
+                           FULL mode.
+
+                  "OFF"    Checking in and out does nothing, and the
+                           traceback is empty.
+
+-Detailed_Output
+
+   None.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `mode' is not recognized, the error SPICE(INVALIDMODE) is
+       signaled by a routine in the call tree of this routine. The
+       trace mode is not changed.
+
+   2)  If the mode would change while modules are checked in, the
+       error SPICE(TRACEBACKACTIVE) is signaled by a routine in the
+       call tree of this routine. The trace mode is not changed.
+
+   3)  If the `mode' input string pointer is null, the error
+       SPICE(NULLPOINTER) is signaled.
+
+   4)  If the `mode' input string has zero length, the error
+       SPICE(EMPTYSTRING) is signaled.
+
+-Files
+
+   None.
+
+-Particulars
+
+   Unlike trcoff_c, this routine can be called again to restore full
+   tracing. It does not check in, so that it can be called when no
+   modules are checked in.
+
+-Examples
+
+   1)    /.
+               Record the traceback lazily:
+         ./
+               trcmod_c ( "LAZY" );
+
+-Restrictions
+
+   1)  In LAZY mode, module names passed to chkin_c must remain
+       valid until the matching call to chkout_c.
+
+   2)  This routine has no effect after trcoff_c has been called.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0, 16-OCT-2026
+
+-Index_Entries
+
+   select the traceback mode
+
+-&
+*/
+
+{ /* Begin trcmod_c */
+
+
+   /*
+   Check the input string to make sure the pointer is non-null
+   and the string length is non-zero. Check in only if an error
+   is detected.
+   */
+   CHKFSTR ( CHK_DISCOVER, "trcmod_c", mode );
+
+   /*
+   Call the f2c'd routine.
+   */
+   trcmod_ ( ( char   * ) mode,
+             ( ftnlen   ) strlen(mode) );
+
+
+} /* End trcmod_c */
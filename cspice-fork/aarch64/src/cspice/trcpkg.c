@@ -5,6 +5,34 @@
 
 #include "f2c.h"
 
+/*     TRCDFL is the trace mode in effect before TRCMOD is first */
+/*     called: 0 for FULL, 1 for LAZY and 2 for OFF. */
+
+#ifndef TRCDFL
+#define TRCDFL 0
+#endif
+
+/*     In LAZY mode, CHKIN records only the address and length of */
+/*     each module name; the names are copied into the stack when a */
+/*     traceback is actually needed. */
+
+static char *lzptr[100];
+static ftnlen lzlen[100];
+
+extern /* Subroutine */ int s_copy(char *, char *, ftnlen, ftnlen);
+
+/* $Procedure ZZTRCCPY ( Copy a lazily recorded module name ) */
+static void zztrccpy(char *dest, char *module, ftnlen module_len)
+{
+    ftnlen first;
+
+    first = 0;
+    while (first < module_len && module[first] == ' ') {
+	++first;
+    }
+    s_copy(dest, module + first, (ftnlen)32, module_len - first);
+}
+
 /* Table of constant values */
 
 static integer c__5 = 5;
@@ -25,6 +53,8 @@ static integer c__0 = 0;
     static integer maxdep = 0;
     static integer modcnt = 0;
     static integer ovrflw = 0;
+    static integer trmode = TRCDFL;
+    static integer lzdone = 0;
 
     /* System generated locals */
     address a__1[5], a__2[3];
@@ -55,6 +85,12 @@ static integer c__0 = 0;
 	    ftnlen);
     char string[11];
     extern /* Subroutine */ int intstr_(integer *, char *, ftnlen);
+    integer newmod;
+    extern logical eqstr_(char *, char *, ftnlen, ftnlen);
+    extern /* Subroutine */ int chkin_(char *, ftnlen), errch_(char *, char *,
+	     ftnlen, ftnlen), sigerr_(char *, ftnlen), chkout_(char *, 
+	    ftnlen), setmsg_(char *, ftnlen), errint_(char *, integer *, 
+	    ftnlen);
 
 /* $ Abstract */
 
@@ -147,6 +183,7 @@ static integer c__0 = 0;
 /*       QCKTRC */
 /*       FREEZE */
 /*       TRCOFF */
+/*       TRCMOD */
 
 /*     This routine serves as an umbrella that allows the entry */
 /*     points to share data. TRCPKG should never be called directly. */
@@ -157,7 +194,7 @@ static integer c__0 = 0;
 /* $ Examples */
 
 /*     See the entry points CHKIN, CHKOUT, TRCDEP, TRCMXD, TRCNAM, */
-/*     QCKTRC, FREEZE, and TRCOFF for examples. */
+/*     QCKTRC, FREEZE, TRCOFF, and TRCMOD for examples. */
 
 /* $ Restrictions */
 
@@ -178,6 +215,13 @@ static integer c__0 = 0;
 
 /* $ Version */
 
+/* -    SPICELIB Version 4.29.0, 16-OCT-2026 */
+
+/*        Added entry point TRCMOD, which selects the FULL, LAZY or */
+/*        OFF trace mode. In LAZY mode CHKIN and CHKOUT record module */
+/*        names by address and the names are copied only when a */
+/*        traceback is requested. */
+
 /* -    SPICELIB Version 4.28.0, 28-NOV-2021 (BVS) */
 
 /*        Updated for MAC-OSX-M1-64BIT-CLANG_C. */
@@ -478,6 +522,7 @@ static integer c__0 = 0;
 	case 6: goto L_qcktrc;
 	case 7: goto L_freeze;
 	case 8: goto L_trcoff;
+	case 9: goto L_trcmod;
 	}
 
 
@@ -774,6 +819,25 @@ L_chkin:
 	return 0;
     }
 
+/*     In OFF mode there is nothing to record. In LAZY mode, a */
+/*     non-blank name that fits on the stack is recorded by address; */
+/*     the remaining cases are handled below as in FULL mode. */
+
+    if (trmode == 2) {
+	return 0;
+    } else if (trmode == 1 && modcnt < 100) {
+	if (*(unsigned char *)module != ' ' || frstnb_(module, module_len) > 
+		0) {
+	    lzptr[modcnt] = module;
+	    lzlen[modcnt] = module_len;
+	    ++modcnt;
+	    if (modcnt + ovrflw > maxdep) {
+		maxdep = modcnt + ovrflw;
+	    }
+	    return 0;
+	}
+    }
+
 /*     Get the position of the first and last non-blank characters in */
 /*     input module name, and set the length of the module name. */
 
@@ -1126,6 +1190,30 @@ L_chkout:
 	return 0;
     }
 
+/*     In OFF mode there is nothing to remove. In LAZY mode, the name */
+/*     matches the top of the stack if it is the very string that was */
+/*     checked in. Otherwise the recorded names are copied into the */
+/*     stack and compared as in FULL mode. */
+
+    if (trmode == 2) {
+	return 0;
+    } else if (trmode == 1 && ovrflw == 0 && modcnt > 0) {
+	if (lzptr[modcnt - 1] == module && lzlen[modcnt - 1] == module_len) 
+		{
+	    --modcnt;
+	    if (lzdone > modcnt) {
+		lzdone = modcnt;
+	    }
+	    return 0;
+	}
+	i__1 = modcnt;
+	for (i__ = lzdone + 1; i__ <= i__1; ++i__) {
+	    zztrccpy(stack + ((i__ - 1) << 5), lzptr[i__ - 1], lzlen[i__ - 1]
+		    );
+	}
+	lzdone = modcnt;
+    }
+
 /*     Check to be sure we can remove a module name from the stack, */
 /*     i.e., that we have not overflowed. */
 
@@ -1187,6 +1275,9 @@ L_chkout:
 
 	--ovrflw;
     }
+    if (lzdone > modcnt) {
+	lzdone = modcnt;
+    }
 
 /*     Return to the caller. */
 
@@ -1908,6 +1999,19 @@ L_trcnam:
 
 /* -& */
 
+
+/*     In LAZY mode, copy the names recorded since the last traceback */
+/*     was requested into the stack. */
+
+    if (trmode == 1) {
+	i__1 = modcnt;
+	for (i__ = lzdone + 1; i__ <= i__1; ++i__) {
+	    zztrccpy(stack + ((i__ - 1) << 5), lzptr[i__ - 1], lzlen[i__ - 1]
+		    );
+	}
+	lzdone = modcnt;
+    }
+
 /*     Get the error handling mode. */
 
     getact_(&action);
@@ -2264,6 +2368,18 @@ L_qcktrc:
 
     s_copy(trace, " ", trace_len, (ftnlen)1);
 
+/*     In LAZY mode, copy the names recorded since the last traceback */
+/*     was requested into the stack. */
+
+    if (trmode == 1) {
+	i__1 = modcnt;
+	for (i__ = lzdone + 1; i__ <= i__1; ++i__) {
+	    zztrccpy(stack + ((i__ - 1) << 5), lzptr[i__ - 1], lzlen[i__ - 1]
+		    );
+	}
+	lzdone = modcnt;
+    }
+
 /*     Get the error handling mode. */
 
     getact_(&action);
@@ -2520,6 +2636,18 @@ L_freeze:
 /*     Create a frozen version of the traceback. To do this, we move */
 /*     the current traceback state into the freezer.. */
 
+/*     In LAZY mode, copy the names recorded since the last traceback */
+/*     was requested into the stack. */
+
+    if (trmode == 1) {
+	i__1 = modcnt;
+	for (i__ = lzdone + 1; i__ <= i__1; ++i__) {
+	    zztrccpy(stack + ((i__ - 1) << 5), lzptr[i__ - 1], lzlen[i__ - 1]
+		    );
+	}
+	lzdone = modcnt;
+    }
+
     frzcnt = modcnt;
     frzovr = ovrflw;
     i__1 = modcnt;
@@ -2716,6 +2844,138 @@ L_trcoff:
     modcnt = 0;
     ovrflw = 0;
     return 0;
+/* $Procedure TRCMOD ( Set the trace mode ) */
+
+L_trcmod:
+/* $ Abstract */
+
+/*     Select how CHKIN and CHKOUT maintain the traceback. */
+
+/* $ Declarations */
+
+/*     CHARACTER*(*)         MODE */
+
+/* $ Brief_I/O */
+
+/*     VARIABLE  I/O  DESCRIPTION */
+/*     --------  ---  -------------------------------------------------- */
+/*     MODE       I   'FULL', 'LAZY' or 'OFF'. */
+
+/* $ Detailed_Input */
+
+/*     MODE     is the trace mode. Case and blanks are not */
+/*              significant. The modes are: */
+
+/*                 'FULL'   CHKIN copies each module name onto the */
+/*                          trace stack and CHKOUT compares it with */
+/*                          the name being checked out. This is the */
+/*                          default, unless TRCPKG was compiled with */
+/*                          TRCDFL set to another mode. */
+
+/*                 'LAZY'   CHKIN records only the address and length */
+/*                          of each module name. CHKOUT compares */
+/*                          addresses, and compares the names only when */
+/*                          the addresses differ. The names are copied */
+/*                          when TRCNAM, QCKTRC or FREEZE needs them, */
+/*                          so tracebacks are the same as in FULL mode */
+/*                          as long as the names checked in remain */
+/*                          valid, as string literals do. */
+
+/*                 'OFF'    CHKIN and CHKOUT return immediately. The */
+/*                          traceback is empty. Unlike TRCOFF, this */
+/*                          can be undone by a later call to TRCMOD. */
+
+/* $ Detailed_Output */
+
+/*     None. */
+
+/* $ Parameters */
+
+/*     None. */
+
+/* $ Exceptions */
+
+/*     1)  If MODE is not recognized, the error SPICE(INVALIDMODE) is */
+/*         signaled. The trace mode is not changed. */
+
+/*     2)  If the mode would change while modules are checked in, the */
+/*         error SPICE(TRACEBACKACTIVE) is signaled. The trace mode is */
+/*         not changed. */
+
+/* $ Files */
+
+/*     None. */
+
+/* $ Particulars */
+
+/*     Most of the cost of CHKIN and CHKOUT in FULL mode is copying and */
+/*     comparing module names. LAZY mode removes that cost from calls */
+/*     that do not lead to an error, and OFF mode removes the calls' */
+/*     work altogether for programs that do not need tracebacks. */
+
+/*     The mode should be set from the main program, before or between */
+/*     calls to SPICELIB routines. */
+
+/* $ Examples */
+
+/*     1)  Record the traceback lazily: */
+
+/*            CALL TRCMOD ( 'LAZY' ) */
+
+/* $ Restrictions */
+
+/*     1)  In LAZY mode, the names passed to CHKIN must not be modified */
+/*         or deallocated before the matching call to CHKOUT. */
+
+/*     2)  TRCMOD has no effect after TRCOFF has been called. */
+
+/* $ Literature_References */
+
+/*     None. */
+
+/* $ Author_and_Institution */
+
+/*     None. */
+
+/* $ Version */
+
+/* -    SPICELIB Version 1.0.0, 16-OCT-2026 */
+
+/* -& */
+/* $ Index_Entries */
+
+/*     select the traceback mode */
+
+/* -& */
+
+    if (eqstr_(module, "FULL", module_len, (ftnlen)4)) {
+	newmod = 0;
+    } else if (eqstr_(module, "LAZY", module_len, (ftnlen)4)) {
+	newmod = 1;
+    } else if (eqstr_(module, "OFF", module_len, (ftnlen)3)) {
+	newmod = 2;
+    } else {
+	chkin_("TRCMOD", (ftnlen)6);
+	setmsg_("Trace mode # is not recognized. The mode must be FULL, LAZ"
+		"Y or OFF.", (ftnlen)67);
+	errch_("#", module, (ftnlen)1, module_len);
+	sigerr_("SPICE(INVALIDMODE)", (ftnlen)18);
+	chkout_("TRCMOD", (ftnlen)6);
+	return 0;
+    }
+    if (newmod != trmode && modcnt + ovrflw > 0) {
+	i__1 = modcnt + ovrflw;
+	chkin_("TRCMOD", (ftnlen)6);
+	setmsg_("The trace mode cannot be changed while # modules are check"
+		"ed in.", (ftnlen)64);
+	errint_("#", &i__1, (ftnlen)1);
+	sigerr_("SPICE(TRACEBACKACTIVE)", (ftnlen)22);
+	chkout_("TRCMOD", (ftnlen)6);
+	return 0;
+    }
+    trmode = newmod;
+    lzdone = 0;
+    return 0;
 } /* trcpkg_ */
 
 /* Subroutine */ int trcpkg_(integer *depth, integer *index, char *module, 
@@ -2774,3 +3034,9 @@ L_trcoff:
 	    char *)0, (ftnint)0, (ftnint)0, (ftnint)0);
     }
 
+/* Subroutine */ int trcmod_(char *mode, ftnlen mode_len)
+{
+    return trcpkg_0_(9, (integer *)0, (integer *)0, mode, (char *)0, (char *)
+	    0, mode_len, (ftnint)0, (ftnint)0);
+    }
+
@@ -36,6 +36,7 @@ static integer c__1 = 1;
     integer iostat;
     extern /* Subroutine */ int errint_(char *, integer *, ftnlen);
     extern logical return_(void);
+    extern integer zzxfrpt_(integer *, integer *, doublereal *, integer *);
 
 /* $ Abstract */
 
@@ -207,6 +208,12 @@ static integer c__1 = 1;
 
 /* $ Version */
 
+/* -    SPICELIB Version 1.4.0, 16-OCT-2026 */
+
+/*        The data are now encoded and written in blocks by ZZXFRPT */
+/*        when UNIT is a sequential formatted unit already being */
+/*        written. The output is unchanged. */
+
 /* -    SPICELIB Version 1.3.0, 13-AUG-2021 (JDR) */
 
 /*        Added IMPLICIT NONE statement. */
@@ -311,6 +318,21 @@ static integer c__1 = 1;
 	return 0;
     }
 
+/*     Write all of the data in blocks if the unit allows it. */
+
+    nitms = zzxfrpt_(unit, n, data, &iostat);
+    if (nitms == *n) {
+	chkout_("WRENCD", (ftnlen)6);
+	return 0;
+    } else if (nitms < 0) {
+	setmsg_("Error writing to logical unit #, IOSTAT = #.", (ftnlen)44);
+	errint_("#", unit, (ftnlen)1);
+	errint_("#", &iostat, (ftnlen)1);
+	sigerr_("SPICE(FILEWRITEFAILED)", (ftnlen)22);
+	chkout_("WRENCD", (ftnlen)6);
+	return 0;
+    }
+
 /*     Initialize the beginning location for the data items to be */
 /*     encoded. */
 
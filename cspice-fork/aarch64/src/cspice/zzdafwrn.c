@@ -0,0 +1,36 @@
+#include "f2c.h"
+#include "fio.h"
+
+/* Write NREC consecutive records, starting at record RECNO, to the
+   file connected for direct access to Unit, using a single write.
+   BUFFER holds the records one after another. The return value is
+   the number of complete records written; it is zero if the unit is
+   not connected for direct access, if the file has not yet been
+   opened for writing by the I/O library, or if the write fails. */
+
+ integer
+#ifdef KR_headers
+zzdafwrn_(Unit, recno, nrec, buffer) integer *Unit, *recno, *nrec; char *buffer;
+#else
+zzdafwrn_(integer *Unit, integer *recno, integer *nrec, char *buffer)
+#endif
+{
+	unit *u;
+	FILE *f;
+	size_t n;
+
+	if (*Unit >= MXUNIT || *Unit < 0 || *recno < 1 || *nrec < 1)
+		return 0;
+	u = &f__units[*Unit];
+	if ((f = u->ufd) == NULL || u->url <= 0 || !(u->urw & 2))
+		return 0;
+	if (fseek(f, (long)(*recno - 1) * u->url, SEEK_SET))
+		return 0;
+	u->uwrt = 1;
+	n = fwrite(buffer, (size_t)u->url, (size_t)*nrec, f);
+#ifdef ALWAYS_FLUSH
+	if (fflush(f))
+		return 0;
+#endif
+	return (integer)n;
+	}
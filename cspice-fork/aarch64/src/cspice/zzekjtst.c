@@ -29,6 +29,7 @@ static integer c__5 = 5;
 
     /* Builtin functions */
     integer s_rnge(char *, integer, char *, integer);
+    double log(doublereal);
 
     /* Local variables */
     static integer base, case__, ltab;
@@ -62,6 +63,15 @@ static integer c__5 = 5;
     static logical fnd, lsmall;
     extern /* Subroutine */ int sigerr_(char *, ftnlen), chkout_(char *, 
 	    ftnlen), zzeksrd_(integer *, integer *, integer *);
+    extern /* Subroutine */ int zzekjhin_(integer *, integer *, logical *), 
+	    zzekjhad_(integer *, integer *, integer *, integer *, integer *, 
+	    integer *, logical *), zzekjhpb_(integer *, integer *, integer *, 
+	    integer *, integer *), zzekjhnx_(logical *, integer *), 
+	    zzekjhcl_(void);
+    extern logical failed_(void);
+    static integer svtab1, svtab2, nact, prow, idx;
+    static logical hright, probng, hshok, lfirst;
+    static doublereal n1, n2, ncost, mcost, hcost;
 
 /* $ Abstract */
 
@@ -1388,6 +1398,12 @@ L_zzekjprp:
 
 /* $ Version */
 
+/* -    SPICELIB Version 3.0.0 */
+
+/*        Added the hash join method. The join method is now chosen */
+/*        by comparing estimated costs, so small join row sets are */
+/*        tested exhaustively rather than sorted. */
+
 /* -    SPICELIB Version 2.0.0, 20-JUL-1998 (NJB) */
 
 /*        Modified entry point to set CASE to EMPTY when either */
@@ -1478,6 +1494,17 @@ L_zzekjprp:
 /*            the operators NE, LIKE, or UNLIKE, none of which are */
 /*            helpful.  Test every row vector. */
 
+/*     Having found a helpful constraint, we estimate the cost of each */
+/*     join method available for it, and may instead choose to: */
+
+/*        5)  Hash the entries of the equi-join column of the smaller */
+/*            join row set, then look up the entries of the other join */
+/*            row set in the hash table.  Each input row vector is read */
+/*            only once, and no scratch area space is used. */
+
+/*        3)  Test every row vector, when there are so few that sorting */
+/*            or hashing would cost more than it saves. */
+
 
 /*     First step:  We try to find a pair of columns related by an */
 /*     equi-join constraint. */
@@ -1520,12 +1547,129 @@ L_zzekjprp:
 	}
     }
 
+/*     Estimate the cost of each join method, in units of column entry */
+/*     reads.  Testing every pair of row vectors reads two entries for */
+/*     each active constraint, plus the row vectors themselves. Sorting */
+/*     reads two entries per comparison, and writes the row pointers */
+/*     to the scratch area.  Hashing reads each entry once, after */
+/*     allocating the table. */
+
+    if (case__ != 3) {
+	n1 = (doublereal) (*nr1);
+	n2 = (doublereal) (*nr2);
+	nact = 0;
+	i__1 = *njcnst;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    if (active[i__ - 1]) {
+		++nact;
+	    }
+	}
+	ncost = (nact * 2. + 2.) * n1 * n2;
+	mcost = (n1 * log(n1) + n2 * log(n2)) * 2. / log(2.) + (n1 + n2) * 
+		6.;
+	hcost = (n1 + n2) * 2. + 64.;
+
+/*        Hashing applies to equi-joins of two character columns or two */
+/*        numeric or time columns. */
+
+	if (case__ == 1 && (ldscrs[cnstr * 11 - 10] == 1) == (rdscrs[cnstr * 
+		11 - 10] == 1) && hcost < mcost) {
+	    case__ = 5;
+	    mcost = hcost;
+	}
+	if (ncost <= mcost) {
+	    case__ = 3;
+	}
+    }
+
+/*     In the hash join case, build the hash table from the smaller join */
+/*     row set.  If there isn't enough memory, fall back to sorting. */
+
+    if (case__ == 5) {
+	ltab = cpidx1[cnstr - 1];
+	lelt = elts1[cnstr - 1];
+	if (ltab <= *nt1) {
+	    svbas1 = *jbase1;
+	    svnt1 = *nt1;
+	    svnr1 = *nr1;
+	    svrb1 = *rb1;
+	    svtab1 = ltab;
+	} else {
+	    svbas1 = *jbase2;
+	    svnt1 = *nt2;
+	    svnr1 = *nr2;
+	    svrb1 = *rb2;
+	    svtab1 = ltab - *nt1;
+	}
+	rtab = cpidx2[cnstr - 1];
+	relt = elts2[cnstr - 1];
+	if (rtab <= *nt1) {
+	    svbas2 = *jbase1;
+	    svnt2 = *nt1;
+	    svnr2 = *nr1;
+	    svrb2 = *rb1;
+	    svtab2 = rtab;
+	} else {
+	    svbas2 = *jbase2;
+	    svnt2 = *nt2;
+	    svnr2 = *nr2;
+	    svrb2 = *rb2;
+	    svtab2 = rtab - *nt1;
+	}
+
+/*        Entries are added in reverse order, so that matching row */
+/*        vectors are found in increasing order. */
+
+	lfirst = ltab <= *nt1;
+	hright = svnr2 <= svnr1;
+	if (hright) {
+	    zzekjhin_(&svnr2, &rdscrs[cnstr * 11 - 10], &hshok);
+	    i__ = svnr2;
+	    while(i__ >= 1 && hshok && ! failed_()) {
+		addrss = svbas2 + svrb2 + (i__ - 1) * (svnt2 + 1) + svtab2;
+		zzeksrd_(&addrss, &addrss, &prow);
+		zzekjhad_(&rhans[cnstr - 1], &rsdsc[cnstr * 24 - 24], &rdscrs[
+			cnstr * 11 - 11], &prow, &relt, &i__, &hshok);
+		--i__;
+	    }
+	} else {
+	    zzekjhin_(&svnr1, &ldscrs[cnstr * 11 - 10], &hshok);
+	    i__ = svnr1;
+	    while(i__ >= 1 && hshok && ! failed_()) {
+		addrss = svbas1 + svrb1 + (i__ - 1) * (svnt1 + 1) + svtab1;
+		zzeksrd_(&addrss, &addrss, &prow);
+		zzekjhad_(&lhans[cnstr - 1], &lsdsc[cnstr * 24 - 24], &ldscrs[
+			cnstr * 11 - 11], &prow, &lelt, &i__, &hshok);
+		--i__;
+	    }
+	}
+	if (failed_()) {
+	    zzekjhcl_();
+	    chkout_("ZZEKJPRP", (ftnlen)8);
+	    return 0;
+	}
+	if (hshok) {
+	    i__1 = *njcnst;
+	    for (i__ = 1; i__ <= i__1; ++i__) {
+		locact[(i__2 = i__ - 1) < 100 && 0 <= i__2 ? i__2 : s_rnge(
+			"locact", i__2, "zzekjtst_", (ftnlen)939)] = active[
+			i__ - 1];
+	    }
+	    locact[(i__1 = cnstr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge(
+		    "locact", i__1, "zzekjtst_", (ftnlen)942)] = FALSE_;
+	    probng = FALSE_;
+	} else {
+	    zzekjhcl_();
+	    case__ = 1;
+	}
+    }
+
 /*     At this point, we know which case we've got.  If we've picked */
-/*     a distinguished constraint, produce order vectors for each */
-/*     set of input rows vectors, using the keys defined by the */
+/*     a distinguished constraint to sort on, produce order vectors for */
+/*     each set of input rows vectors, using the keys defined by the */
 /*     join constraint. */
 
-    if (case__ != 3) {
+    if (case__ == 1 || case__ == 2) {
 
 /*        Produce an order vector for the column on the left side of */
 /*        the CNSTR constraint.  We'll do this by turning the set of */
@@ -1686,7 +1830,7 @@ L_zzekjprp:
 	}
 	locact[(i__1 = cnstr - 1) < 100 && 0 <= i__1 ? i__1 : s_rnge("locact",
 		 i__1, "zzekjtst_", (ftnlen)942)] = FALSE_;
-    } else {
+    } else if (case__ == 3) {
 
 /*        This is the `no luck' case.  Save all of the constraints. */
 
@@ -1871,6 +2015,10 @@ L_zzekjnxt:
 
 /* $ Version */
 
+/* -    SPICELIB Version 3.0.0 */
+
+/*        Added the hash join method. */
+
 /* -    SPICELIB Version 2.0.0, 20-JUL-1998 (NJB) */
 
 /*        Modified entry point ZZEKJNXT to set FOUND to .FALSE. on the */
@@ -2222,6 +2370,99 @@ L_zzekjnxt:
 
 	    }
 	}
+    } else if (case__ == 5) {
+	while(! done && ! (*found)) {
+
+/*           If no probe is in progress, look up the key entry of the */
+/*           next row vector from the join row set that wasn't hashed. */
+
+	    if (! probng) {
+		if (hright) {
+		    if (lptr > svnr1) {
+			done = TRUE_;
+		    } else {
+			addrss = svbas1 + svrb1 + (lptr - 1) * (svnt1 + 1) + 
+				svtab1;
+			zzeksrd_(&addrss, &addrss, &prow);
+			zzekjhpb_(&lhans[cnstr - 1], &lsdsc[cnstr * 24 - 24], 
+				&ldscrs[cnstr * 11 - 11], &prow, &lelt);
+		    }
+		} else {
+		    if (rptr > svnr2) {
+			done = TRUE_;
+		    } else {
+			addrss = svbas2 + svrb2 + (rptr - 1) * (svnt2 + 1) + 
+				svtab2;
+			zzeksrd_(&addrss, &addrss, &prow);
+			zzekjhpb_(&rhans[cnstr - 1], &rsdsc[cnstr * 24 - 24], 
+				&rdscrs[cnstr * 11 - 11], &prow, &relt);
+		    }
+		}
+		probng = ! done;
+	    }
+	    if (failed_()) {
+		done = TRUE_;
+	    }
+	    if (! done) {
+		zzekjhnx_(&fnd, &idx);
+		if (! fnd) {
+
+/*                 The probe is exhausted; move on to the next row */
+/*                 vector. */
+
+		    probng = FALSE_;
+		    if (hright) {
+			++lptr;
+		    } else {
+			++rptr;
+		    }
+		} else {
+
+/*                 The key entries are equal.  Form a composite row */
+/*                 vector and test it against the remaining active */
+/*                 constraints. */
+
+		    if (hright) {
+			lrvidx = lptr;
+			rrvidx = idx;
+		    } else {
+			lrvidx = idx;
+			rrvidx = rptr;
+		    }
+		    if (lfirst) {
+			j = 1;
+			k = svnt1 + 1;
+		    } else {
+			j = svnt2 + 1;
+			k = 1;
+		    }
+		    offset = svrb1 + (lrvidx - 1) * (svnt1 + 1);
+		    i__1 = svbas1 + offset + 1;
+		    i__2 = svbas1 + offset + svnt1;
+		    zzeksrd_(&i__1, &i__2, &rowvec[j - 1]);
+		    offset = svrb2 + (rrvidx - 1) * (svnt2 + 1);
+		    i__1 = svbas2 + offset + 1;
+		    i__2 = svbas2 + offset + svnt2;
+		    zzeksrd_(&i__1, &i__2, &rowvec[k - 1]);
+		    i__1 = svncon;
+		    for (j = 1; j <= i__1; ++j) {
+			if (locact[j - 1]) {
+			    lrows[j - 1] = rowvec[svcp1[j - 1] - 1];
+			    rrows[j - 1] = rowvec[svcp2[j - 1] - 1];
+			}
+		    }
+		    *found = zzekvmch_(&svncon, locact, lhans, lsdsc, ldscrs, 
+			    lrows, lelts, svops, rhans, rsdsc, rdscrs, rrows, 
+			    relts);
+		}
+	    }
+	}
+
+/*        Release the hash table once every row vector has been probed. */
+
+	if (done) {
+	    zzekjhcl_();
+	}
     } else {
 
 /*        We have no order vectors to help us out, so we just loop */
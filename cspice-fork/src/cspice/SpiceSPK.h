@@ -105,6 +105,10 @@
       
 -Version
 
+   -CSPICE Version 1.1.0, 16-OCT-2026
+
+      Added the parameter SPICE_SGP4_RECLEN.
+
    -CSPICE Version 1.0.0, 16-AUG-2002 (NJB)  
 
 */
@@ -123,6 +127,11 @@
    
 
    typedef enum _SpiceSPK18Subtype SpiceSPK18Subtype;
+
+   /*
+   Length of a two-line element set initialized by sgp4in_c:
+   */
+   #define SPICE_SGP4_RECLEN    98
  
 #endif
 
@@ -3,8 +3,87 @@
 	-lf2c -lm   (in that order)
 */
 
+#include <stdlib.h>
+#include <string.h>
 #include "f2c.h"
 
+/* Write buffers for DAFADA, one for each entry of the state table. */
+/* STBUF(P) holds the last STBN(P) words added to the array being */
+/* written to the DAF designated by STBHAN(P); they belong at the */
+/* addresses just below STBEND(P). STBCAP(P) is the capacity of the */
+/* buffer in words, and WBSIZE is the capacity, in records, set by */
+/* DAFWBS. */
+
+static doublereal *stbuf[20];
+static integer stbcap[20];
+static integer stbn[20];
+static integer stbhan[20];
+static integer stbend[20];
+static integer wbsize = 0;
+
+/* Write the contents of write buffer P to the file, and empty the */
+/* buffer. */
+
+static void dafflb(integer p)
+{
+    integer begin, end;
+    extern /* Subroutine */ int dafwda_(integer *, integer *, integer *, 
+	    doublereal *);
+
+    begin = stbend[p] - stbn[p];
+    end = stbend[p] - 1;
+    stbn[p] = 0;
+    dafwda_(&stbhan[p], &begin, &end, stbuf[p]);
+}
+
+/* Give the empty write buffer P the capacity set by DAFWBS. If the */
+/* memory cannot be allocated, the buffer is left with no capacity, */
+/* and data are written directly. */
+
+static void dafalb(integer p)
+{
+    if (stbcap[p] == wbsize << 7) {
+	return;
+    }
+    free(stbuf[p]);
+    stbuf[p] = NULL;
+    stbcap[p] = 0;
+    if (wbsize > 0) {
+	stbuf[p] = (doublereal *) malloc((size_t) (wbsize << 7) * sizeof(
+		doublereal));
+	if (stbuf[p] != NULL) {
+	    stbcap[p] = wbsize << 7;
+	}
+    }
+}
+
+/* Get the data at addresses BADDR through EADDR of the DAF designated */
+/* by HANDLE from a write buffer, for DAFGDA and DAFRDA. The function */
+/* returns TRUE if the buffer held all of them. If it held only some, */
+/* the buffer is written to the file, so that the caller can read */
+/* them all from there. */
+
+logical zzdafgbf_(integer *handle, integer *baddr, integer *eaddr, 
+	doublereal *data)
+{
+    integer p, begin;
+
+    for (p = 0; p < 20; ++p) {
+	if (stbn[p] > 0 && stbhan[p] == *handle) {
+	    begin = stbend[p] - stbn[p];
+	    if (*baddr >= begin && *eaddr < stbend[p]) {
+		memcpy(data, stbuf[p] + (*baddr - begin), (size_t) (*eaddr - *
+			baddr + 1) * sizeof(doublereal));
+		return TRUE_;
+	    } else if (*eaddr >= begin && *baddr < stbend[p]) {
+		dafflb(p);
+	    }
+	    return FALSE_;
+	}
+    }
+    return FALSE_;
+}
+
 /* Table of constant values */
 
 static integer c__5000 = 5000;
@@ -45,6 +124,7 @@ static integer c__128 = 128;
     static doublereal dc[124];
     static integer ic[250], nd;
     extern logical failed_(void);
+    extern integer intmax_(void);
     static char dafnam[255];
     static integer ni;
     extern /* Subroutine */ int dafhof_(integer *), dafhfn_(integer *, char *,
@@ -447,6 +527,7 @@ static integer c__128 = 128;
 /*        DAFADA         Add data to array. */
 /*        DAFCAD         Continue adding data. */
 /*        DAFENA         End new array. */
+/*        DAFWBS         Set write buffer size. */
 
 /*     The main function of these entry points is to simplify the */
 /*     addition of new arrays to existing DAFs. */
@@ -959,6 +1040,12 @@ static integer c__128 = 128;
 
 /* $ Version */
 
+/* -    SPICELIB Version 3.2.0, 16-OCT-2026 */
+
+/*        Added entry point DAFWBS. DAFADA can now hold the data of */
+/*        each array in a write buffer, which is written to the file */
+/*        in large runs of records. */
+
 /* -    SPICELIB Version 3.1.0, 13-AUG-2021 (JDR) */
 
 /*        Added IMPLICIT NONE statement. */
@@ -1227,6 +1314,7 @@ static integer c__128 = 128;
 	case 2: goto L_dafada;
 	case 3: goto L_dafena;
 	case 4: goto L_dafcad;
+	case 5: goto L_dafwbs;
 	}
 
 
@@ -1735,6 +1823,11 @@ L_dafbna:
     stfree[(i__1 = p - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("stfree", i__1, 
 	    "dafana_", (ftnlen)1511)] = free;
 
+/*     Any data still buffered for this entry belong to an array that */
+/*     was never ended, and are discarded. */
+
+    stbn[p - 1] = 0;
+
 /*     Find out how big the array summary is supposed to be. */
 
     dafhsf_(&stfh[(i__1 = p - 1) < 20 && 0 <= i__1 ? i__1 : s_rnge("stfh", 
@@ -1842,6 +1935,12 @@ L_dafada:
 /*     Data can be added to a DAF in chunks of any size, so long */
 /*     as the chunks are added in the proper order. */
 
+/*     If a write buffer size has been set by DAFWBS, the data are */
+/*     collected in memory and written to the file in large runs of */
+/*     records when the buffer fills, or when the array is ended by */
+/*     DAFENA. DAFGDA and DAFRDA read data still in the buffer from */
+/*     memory. */
+
 /* $ Examples */
 
 /*     See $Examples in DAFANA. */
@@ -1959,6 +2058,33 @@ L_dafada:
 /*     Start adding data at the first free address, then update that */
 /*     address to get ready for the next addition. */
 
+    } else if (*n >= 1 && (wbsize > 0 || stbn[p - 1] > 0)) {
+
+/*        The data go to the write buffer. Once the buffer cannot take */
+/*        them, its contents are written to the file. Data that would */
+/*        not fit in an empty buffer are written directly. */
+
+	if (stbn[p - 1] > 0 && stbn[p - 1] + *n > stbcap[p - 1]) {
+	    dafflb(p - 1);
+	    if (failed_()) {
+		chkout_("DAFADA", (ftnlen)6);
+		return 0;
+	    }
+	}
+	if (stbn[p - 1] == 0) {
+	    dafalb(p - 1);
+	}
+	if (*n <= stbcap[p - 1] - stbn[p - 1]) {
+	    memcpy(stbuf[p - 1] + stbn[p - 1], data, (size_t) (*n) * sizeof(
+		    doublereal));
+	    stbn[p - 1] += *n;
+	    stbhan[p - 1] = stfh[p - 1];
+	    stbend[p - 1] = stfree[p - 1] + *n;
+	} else {
+	    i__1 = stfree[p - 1] + *n - 1;
+	    dafwda_(&stfh[p - 1], &stfree[p - 1], &i__1, data);
+	}
+	stfree[p - 1] += *n;
     } else if (*n >= 1) {
 	i__4 = stfree[(i__3 = p - 1) < 20 && 0 <= i__3 ? i__3 : s_rnge("stfr"
 		"ee", i__3, "dafana_", (ftnlen)1757)] + *n - 1;
@@ -2056,6 +2182,10 @@ L_dafena:
 /*     DAF is closed before DAFENA is called, the last array will */
 /*     not be visible to the DAF reader routines. */
 
+/*     Data held in the write buffer set up by DAFWBS are written to */
+/*     the file before the summary of the array, so the summary never */
+/*     refers to data that have not been written. */
+
 /* $ Examples */
 
 /*     See $Examples in DAFANA. */
@@ -2184,6 +2314,17 @@ L_dafena:
 	return 0;
     }
 
+/*     Write out any buffered data before the summary that refers */
+/*     to them. */
+
+    if (stbn[p - 1] > 0) {
+	dafflb(p - 1);
+	if (failed_()) {
+	    chkout_("DAFENA", (ftnlen)6);
+	    return 0;
+	}
+    }
+
 /*     No more data. The array ends just before the next free */
 /*     address. The summary should be complete except for the */
 /*     initial and final addresses of the data, of which we */
@@ -2597,6 +2738,136 @@ L_dafcad:
     }
     chkout_("DAFCAD", (ftnlen)6);
     return 0;
+/* $Procedure DAFWBS ( DAF, set write buffer size ) */
+
+L_dafwbs:
+/* $ Abstract */
+
+/*     Set the size of the buffer in which DAFADA collects the data of */
+/*     each new array before writing them to the file. */
+
+/* $ Required_Reading */
+
+/*     DAF */
+
+/* $ Keywords */
+
+/*     FILES */
+
+/* $ Declarations */
+
+/*     INTEGER               N */
+
+/* $ Brief_I/O */
+
+/*     VARIABLE  I/O  DESCRIPTION */
+/*     --------  ---  -------------------------------------------------- */
+/*     N          I   Buffer size, in records. */
+
+/* $ Detailed_Input */
+
+/*     N        is the number of records of data that DAFADA may hold */
+/*              in memory for each array being written. Zero, the */
+/*              default, disables buffering. */
+
+/* $ Detailed_Output */
+
+/*     None. */
+
+/* $ Parameters */
+
+/*     None. */
+
+/* $ Exceptions */
+
+/*     1)  If N is negative, or greater than INTMAX()/128, so that the */
+/*         number of double precision numbers a buffer holds could not */
+/*         be represented as an integer, the error */
+/*         SPICE(VALUEOUTOFRANGE) is signaled. */
+
+/* $ Files */
+
+/*     None. */
+
+/* $ Particulars */
+
+/*     Segment writers add data through DAFADA, often a few words at a */
+/*     time. Without a buffer, each call reads and rewrites the records */
+/*     it touches. With a buffer of N records, the data of each array */
+/*     are collected in memory, and written in runs of up to N records */
+/*     with a single write each. */
+
+/*     Each array being written has its own buffer, of N records, */
+/*     allocated when data are first added to it. Buffers are written */
+/*     out when they fill and when their arrays are ended by DAFENA. */
+/*     If memory for a buffer cannot be allocated, data are written */
+/*     directly, as if N were zero. */
+
+/*     A new size applies to each buffer the next time it is empty. */
+
+/* $ Examples */
+
+/*     Reserve 1024 records, that is, 1 MiB, for each array being */
+/*     written: */
+
+/*        CALL DAFWBS ( 1024 ) */
+
+/* $ Restrictions */
+
+/*     1)  DAFGDA and DAFRDA return data still held in a buffer, but */
+/*         the record-level readers, such as DAFGDR, do not see them */
+/*         until they are written. Applications that read back the */
+/*         records of an array before ending it must not enable */
+/*         buffering. */
+
+/* $ Literature_References */
+
+/*     None. */
+
+/* $ Author_and_Institution */
+
+/*     None. */
+
+/* $ Version */
+
+/* -    SPICELIB Version 1.0.0, 16-OCT-2026 */
+
+/* -& */
+/* $ Index_Entries */
+
+/*     set DAF write buffer size */
+
+/* -& */
+    if (return_()) {
+	return 0;
+    } else {
+	chkin_("DAFWBS", (ftnlen)6);
+    }
+
+/*     The capacity of a buffer, in double precision numbers, must be */
+/*     representable as an integer. */
+
+    if (*n < 0 || *n > intmax_() / 128) {
+	setmsg_("The write buffer size must be in the range 0:#; it was #.", 
+		(ftnlen)57);
+	i__1 = intmax_() / 128;
+	errint_("#", &i__1, (ftnlen)1);
+	errint_("#", n, (ftnlen)1);
+	sigerr_("SPICE(VALUEOUTOFRANGE)", (ftnlen)22);
+	chkout_("DAFWBS", (ftnlen)6);
+	return 0;
+    }
+    wbsize = *n;
+
+/*     Release the empty buffers that are no longer the right size. */
+
+    for (i__ = 0; i__ < 20; ++i__) {
+	if (stbn[i__] == 0) {
+	    dafalb(i__);
+	}
+    }
+    chkout_("DAFWBS", (ftnlen)6);
+    return 0;
 } /* dafana_ */
 
 /* Subroutine */ int dafana_(integer *handle, doublereal *sum, char *name__, 
@@ -2624,6 +2895,12 @@ L_dafcad:
 	    *)0, (integer *)0, (ftnint)0);
     }
 
+/* Subroutine */ int dafwbs_(integer *n)
+{
+    return dafana_0_(5, (integer *)0, (doublereal *)0, (char *)0, (doublereal 
+	    *)0, n, (ftnint)0);
+    }
+
 /* Subroutine */ int dafcad_(integer *handle)
 {
     return dafana_0_(4, handle, (doublereal *)0, (char *)0, (doublereal *)0, (
@@ -31,7 +31,7 @@ static integer c__128 = 128;
     integer s_rnge(char *, integer, char *, integer);
 
     /* Local variables */
-    integer begr, begw, endr, endw, next, n;
+    integer begr, begw, endr, endw, next, nrec, n;
     extern /* Subroutine */ int chkin_(char *, ftnlen);
     integer recno;
     extern /* Subroutine */ int moved_(doublereal *, integer *, doublereal *);
@@ -40,7 +40,8 @@ static integer c__128 = 128;
     extern /* Subroutine */ int cleard_(integer *, doublereal *), dafrdr_(
 	    integer *, integer *, integer *, integer *, doublereal *, logical 
 	    *), dafarw_(integer *, integer *, integer *), dafwdr_(integer *, 
-	    integer *, doublereal *), sigerr_(char *, ftnlen), chkout_(char *,
+	    integer *, doublereal *), dafwdn_(integer *, integer *, integer *,
+	     doublereal *), sigerr_(char *, ftnlen), chkout_(char *,
 	     ftnlen), setmsg_(char *, ftnlen), errint_(char *, integer *, 
 	    ftnlen);
     extern logical return_(void);
@@ -139,6 +140,9 @@ static integer c__128 = 128;
 /*     (add new array) and its entry points, since these update */
 /*     the appropriate bookkeeping records automatically. */
 
+/*     Records lying wholly within the range of addresses are written */
+/*     together by DAFWDN, with a single write to the file. */
+
 /* $ Examples */
 
 /*     The following code fragment illustrates the use of DAFWDA */
@@ -181,6 +185,11 @@ static integer c__128 = 128;
 
 /* $ Version */
 
+/* -    SPICELIB Version 1.2.0, 16-OCT-2026 */
+
+/*        Records between the first and last records are now written */
+/*        with one call to DAFWDN instead of one call to DAFWDR each. */
+
 /* -    SPICELIB Version 1.1.0, 27-OCT-2021 (JDR) (NJB) */
 
 /*        Added IMPLICIT NONE statement. */
@@ -252,11 +261,19 @@ static integer c__128 = 128;
     dafarw_(end, &endr, &endw);
 
 /*     The first and last records may have to be read, updated, and */
-/*     rewritten. Any records in between may be written directly. */
+/*     rewritten. Any records in between may be written directly, */
+/*     all at once. */
 
     next = 1;
     i__1 = endr;
     for (recno = begr; recno <= i__1; ++recno) {
+	if (recno > begr && recno < endr) {
+	    nrec = endr - recno;
+	    dafwdn_(handle, &recno, &nrec, &data[next - 1]);
+	    next += nrec << 7;
+	    recno = endr - 1;
+	    continue;
+	}
 	if (recno == begr || recno == endr) {
 	    dafrdr_(handle, &recno, &c__1, &c__128, buffer, &found);
 	    if (! found) {
@@ -574,22 +574,17 @@ static integer c_b20 = 32000000;
 /*              section below). */
 
 /*     WORKSZ   is the second dimension of the workspace array WORK. */
-/*              WORKSZ must be at least as large as the greater of */
-
-/*                 - the number of fine voxel-plate associations */
-
-/*                   This number is equal to */
-
-/*                      NP * {average number of fine voxels */
-/*                            intersected by each plate} */
-
-/*                 - the number of vertex-plate associations, if */
-/*                   the vertex-plate mapping is constructed. */
+/*              WORKSZ must be at least NP+1 and, if the vertex-plate */
+/*              mapping is constructed, at least as large as the */
+/*              number of vertex-plate associations. */
 
 /*                   This number is equal to */
 
 /*                      NV + ( 3 * NP ) */
 
+/*              The fine voxel-plate associations are built in place */
+/*              in the spatial index and need no workspace. */
+
 /*     VOXPSZ   is the size of the fine voxel-plate pointer array. */
 /*              This array maps fine voxels to lists of plates that */
 /*              intersect those voxels. VOXPSZ must be at least as */
@@ -1177,6 +1172,11 @@ static integer c_b20 = 32000000;
 
 /* $ Version */
 
+/* -    SPICELIB Version 1.1.0, 16-OCT-2026 */
+
+/*        The voxel-plate mapping no longer uses the workspace WORK; */
+/*        updated the description of WORKSZ. */
+
 /* -    SPICELIB Version 1.0.1, 03-JUN-2021 (JDR) (BVS) */
 
 /*        Edited the header to comply with NAIF standard. Fixed I/O type */
@@ -0,0 +1,1047 @@
+/*
+
+-Procedure ekpqry_c ( EK, prepared queries )
+
+-Abstract
+
+   Compile an E-kernel query containing parameter placeholders once,
+   then bind values to the placeholders and execute the compiled
+   query any number of times.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   EK
+
+-Keywords
+
+   EK
+   PARSE
+   SEARCH
+
+*/
+
+   #include <stdlib.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZst.h"
+   #include "SpiceZmc.h"
+
+/*
+
+-Brief_I/O
+
+   ekpqry_c
+
+      VARIABLE  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      query      I   Query containing `?' parameter placeholders.
+      errmln     I   Declared length of output error message string.
+      qryhan     O   Handle of the prepared query.
+      nparms     O   Number of parameter placeholders in the query.
+      error      O   Flag indicating whether query parsed correctly.
+      errmsg     O   Parse error description.
+
+   ekpbdd_c
+
+      qryhan     I   Handle of a prepared query.
+      parm       I   Index of the parameter to bind.
+      value      I   Numeric or time (TDB seconds past J2000) value.
+
+   ekpbdc_c
+
+      qryhan     I   Handle of a prepared query.
+      parm       I   Index of the parameter to bind.
+      value      I   Character value.
+
+   ekpfnd_c
+
+      qryhan     I   Handle of a prepared query.
+      errmln     I   Declared length of output error message string.
+      nmrows     O   Number of matching rows.
+      error      O   Flag indicating whether the query was executed.
+      errmsg     O   Error description.
+
+   ekpcls_c
+
+      qryhan     I   Handle of a prepared query to release.
+
+-Detailed_Input
+
+   query       is an EK query, as accepted by ekfind_c, in which any
+               of the values on the right hand side of the constraints
+               of the WHERE clause may be replaced by the placeholder
+               character `?'. For example
+
+                  SELECT EVENT_TYPE FROM EVENTS
+                  WHERE TIME BETWEEN ? AND ? AND INSTRUMENT_ID = ?
+
+               Placeholders are numbered from zero in order of
+               appearance. A `?' inside a quoted string is not a
+               placeholder.
+
+   qryhan      is the handle of a query prepared by ekpqry_c.
+
+   parm        is the zero-based index of a placeholder.
+
+   value       is the value to bind to a placeholder. Values for
+               columns of type TIME are given as TDB seconds past
+               J2000, values for INTEGER and DOUBLE PRECISION columns
+               as double precision numbers, and values for CHARACTER
+               columns as strings.
+
+-Detailed_Output
+
+   qryhan      is the handle of the prepared query.
+
+   nparms      is the number of placeholders in the query.
+
+   nmrows      is the number of rows matching the query with the values
+               currently bound to its placeholders. The matching data
+               are retrievable via ekgc_c, ekgd_c and ekgi_c, as after
+               a call to ekfind_c.
+
+   error       is SPICETRUE if the query could not be prepared or
+               executed, in which case errmsg describes the problem.
+
+-Particulars
+
+   ekfind_c scans, parses, resolves names and time values in, and
+   checks the semantics of its query every time it is called, before
+   searching the loaded EKs. When the same query is issued repeatedly
+   with different constraint values, these steps can take longer than
+   the search itself.
+
+   ekpqry_c performs these steps once and stores the resulting encoded
+   query. Binding a value overwrites the value in the encoded query,
+   and ekpfnd_c passes the encoded query directly to the EK search
+   engine. The choice of key column for each segment is still made by
+   the search engine, as it depends on the segments being searched.
+
+   The column names in an encoded query refer to the tables of the EKs
+   loaded when the query was prepared. If EKs are loaded or unloaded
+   afterwards, ekpfnd_c signals an error, and the query must be
+   prepared again.
+
+-Exceptions
+
+   1)  If all query slots are in use, the error SPICE(TOOMANYQUERIES)
+       is signaled by ekpqry_c.
+
+   2)  If the query has more than SPICE_EK_MAXQPRM placeholders, or a
+       placeholder is not the value of a constraint, the error flag is
+       set and errmsg describes the problem.
+
+   3)  If qryhan does not refer to a prepared query, the error
+       SPICE(INVALIDHANDLE) is signaled.
+
+   4)  If parm is out of range, the error SPICE(INVALIDINDEX) is
+       signaled.
+
+   5)  If the type of a bound value does not match the type of the
+       column it is compared with, the error SPICE(INVALIDTYPE) is
+       signaled.
+
+   6)  If ekpfnd_c is called before all parameters have been bound,
+       the error SPICE(UNBOUNDPARAMETER) is signaled.
+
+   7)  Errors found while parsing the query are reported as by
+       ekfind_c. Messages refer to the query with placeholders
+       replaced by values of the appropriate type.
+
+   8)  If EKs have been loaded or unloaded since the query was
+       prepared, the error SPICE(STALEQUERY) is signaled by ekpfnd_c.
+
+-Restrictions
+
+   1)  The restrictions of ekfind_c apply.
+
+   2)  A prepared query cannot be executed after EKs are loaded or
+       unloaded. It must be closed and prepared again.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0
+
+-Index_Entries
+
+   prepare EK query
+   bind EK query parameters
+   execute prepared EK query
+
+-&
+*/
+
+/*
+Encoded query dimensions, as used by ekfind_.
+*/
+#define  EQISIZ            27869
+#define  EQCTRL            6
+#define  EQDSIZ            SPICE_EK_MAXQNUM
+#define  EQCLEN            SPICE_EK_MAXQCLN
+#define  MAXCON            SPICE_EK_MAXQCON
+
+/*
+Scanner limits, as used by ekfind_.
+*/
+#define  MAXTOK            SPICE_EK_MAXQTOK
+#define  MAXNUM            SPICE_EK_MAXQNUM
+
+/*
+Size of a column attribute descriptor.
+*/
+#define  ADSCSZ            6
+
+/*
+Maximum number of queries that may be prepared at once.
+*/
+#define  MAXPQ             20
+
+/*
+Data type codes from ektype.inc.
+*/
+#define  CHR               1
+#define  TIME              4
+
+/*
+Constraint descriptor layout, relative to the base address of the
+descriptor in the integer portion of the encoded query.
+*/
+#define  CNSBAS(ntab,i)    ( (ntab)*12 + 19 + ((i)-1)*26 )
+#define  CNSTYP            6
+#define  LHSTAB            12
+#define  LHSCOL            18
+#define  OPCODE            19
+#define  VALTYP            20
+#define  VALLXB            21
+#define  VALBEG            23
+#define  VALEND            24
+
+#define  CNSVAL            2
+#define  ISNULL            9
+#define  NOTNUL            10
+
+
+typedef struct
+{
+   integer                 eqryi  [ EQISIZ + EQCTRL ];
+   doublereal              eqryd  [ EQDSIZ ];
+   char                    eqryc  [ EQCLEN ];
+
+   integer                 ntab;
+   integer                 ncns;
+   integer                 chrfre;
+   integer                 gen;
+
+   SpiceInt                nparms;
+   SpiceInt                ptypes [ SPICE_EK_MAXQPRM ];
+   SpiceBoolean            bound  [ SPICE_EK_MAXQPRM ];
+   SpiceChar             * cvals  [ SPICE_EK_MAXQPRM ];
+
+   SpiceInt                cnsprm [ MAXCON ];
+
+} PreparedQuery;
+
+
+static PreparedQuery     * queries [ MAXPQ ];
+
+
+
+/*
+Replace the placeholders in a query with literals of the given types.
+The begin and end positions (1-based) of each literal in the output
+are returned in pbegs and pends. The caller frees the returned string.
+*/
+static SpiceChar * substitute ( ConstSpiceChar  * query,
+                                SpiceInt          nparms,
+                                const SpiceInt  * ptypes,
+                                SpiceInt        * pbegs,
+                                SpiceInt        * pends  )
+{
+   static ConstSpiceChar * numlit = "0";
+   static ConstSpiceChar * chrlit = "'?'";
+
+   ConstSpiceChar        * lit;
+   SpiceChar             * out;
+   SpiceChar               quote = 0;
+   SpiceInt                i;
+   SpiceInt                n;
+   SpiceInt                p = 0;
+
+   out = ( SpiceChar * ) malloc (  strlen(query)
+                                 + nparms * strlen(chrlit) + 1 );
+   if ( out == 0 )
+   {
+      return 0;
+   }
+
+   n = 0;
+
+   for ( i = 0;  query[i] != NULLCHAR;  i++ )
+   {
+      if ( quote )
+      {
+         if ( query[i] == quote )
+         {
+            quote = 0;
+         }
+         out[n++] = query[i];
+      }
+      else if (  ( query[i] == '\'' )  ||  ( query[i] == '"' )  )
+      {
+         quote    = query[i];
+         out[n++] = query[i];
+      }
+      else if (  ( query[i] == '?' )  &&  ( p < nparms )  )
+      {
+         if ( ptypes[p] == CHR )
+         {
+            lit = chrlit;
+         }
+         else
+         {
+            lit = numlit;
+         }
+
+         pbegs[p] = n + 1;
+         strcpy ( out + n, lit );
+         n += strlen(lit);
+         pends[p] = n;
+         p++;
+      }
+      else
+      {
+         out[n++] = query[i];
+      }
+   }
+
+   out[n] = NULLCHAR;
+
+   return out;
+}
+
+
+/*
+Count the placeholders in a query.
+*/
+static SpiceInt countParms ( ConstSpiceChar * query )
+{
+   SpiceChar               quote = 0;
+   SpiceInt                i;
+   SpiceInt                n = 0;
+
+   for ( i = 0;  query[i] != NULLCHAR;  i++ )
+   {
+      if ( quote )
+      {
+         if ( query[i] == quote )
+         {
+            quote = 0;
+         }
+      }
+      else if (  ( query[i] == '\'' )  ||  ( query[i] == '"' )  )
+      {
+         quote = query[i];
+      }
+      else if ( query[i] == '?' )
+      {
+         n++;
+      }
+   }
+
+   return n;
+}
+
+
+/*
+Scan and parse a query and resolve its table and column names.
+*/
+static void compile ( SpiceChar       * query,
+                      PreparedQuery   * pq,
+                      logical         * error,
+                      SpiceChar       * errmsg,
+                      ftnlen            errlen  )
+{
+   static integer          isize = EQISIZ;
+   static integer          dsize = EQDSIZ;
+   static integer          maxtok = MAXTOK;
+   static integer          maxnum = MAXNUM;
+
+   char                    chrbuf [ EQCLEN ];
+   doublereal              numvls [ MAXNUM ];
+   integer                 chbegs [ MAXTOK ];
+   integer                 chends [ MAXTOK ];
+   integer                 errptr;
+   integer                 lxbegs [ MAXTOK ];
+   integer                 lxends [ MAXTOK ];
+   integer                 ntoken;
+   integer                 tokens [ MAXTOK ];
+   integer                 values [ MAXTOK ];
+   ftnlen                  qlen = strlen(query);
+
+   zzekqini_ ( &isize, &dsize, pq->eqryi, pq->eqryc, pq->eqryd, EQCLEN );
+
+   zzekscan_ ( query,  &maxtok, &maxnum, &ntoken, tokens, lxbegs,
+               lxends, values,  numvls,  chrbuf,  chbegs, chends,
+               error,  errmsg,  qlen,    EQCLEN,  errlen          );
+   if ( *error || failed_c() )
+   {
+      return;
+   }
+
+   zzekpars_ ( query,  &ntoken, lxbegs,    lxends,    tokens,
+               values, numvls,  chrbuf,    chbegs,    chends,
+               pq->eqryi,       pq->eqryc, pq->eqryd, error,
+               errmsg, qlen,    EQCLEN,    EQCLEN,    errlen   );
+   if ( *error || failed_c() )
+   {
+      return;
+   }
+
+   zzeknres_ ( query, pq->eqryi, pq->eqryc, error, errmsg, &errptr,
+               qlen,  EQCLEN,    errlen                              );
+}
+
+
+/*
+Resolve the time values of a compiled query and check its semantics,
+leaving the encoded query ready for eksrch_.
+
+Placeholders for time values are compiled as numbers, since a time
+string could not be converted without a leapseconds kernel. Their
+constraints are hidden from zzektres_ and their values marked as times
+afterwards; bound values are already ephemeris times.
+*/
+static void resolve ( SpiceChar       * query,
+                      PreparedQuery   * pq,
+                      logical         * error,
+                      SpiceChar       * errmsg,
+                      ftnlen            errlen  )
+{
+   integer                 base;
+   integer                 errptr;
+   integer                 i;
+   ftnlen                  qlen = strlen(query);
+
+   for ( i = 1;  i <= pq->ncns;  i++ )
+   {
+      if (    pq->cnsprm[i-1]
+           && ( pq->ptypes[ pq->cnsprm[i-1] - 1 ] == TIME ) )
+      {
+         pq->eqryi[ CNSBAS(pq->ntab,i) + CNSTYP ] = 0;
+      }
+   }
+
+   zzektres_ ( query, pq->eqryi, pq->eqryc, pq->eqryd, error, errmsg,
+               &errptr, qlen, EQCLEN, errlen                          );
+
+   for ( i = 1;  i <= pq->ncns;  i++ )
+   {
+      if (    pq->cnsprm[i-1]
+           && ( pq->ptypes[ pq->cnsprm[i-1] - 1 ] == TIME ) )
+      {
+         base                      =  CNSBAS ( pq->ntab, i );
+         pq->eqryi[base + CNSTYP]  =  CNSVAL;
+         pq->eqryi[base + VALTYP]  =  TIME;
+      }
+   }
+
+   if ( *error || failed_c() )
+   {
+      return;
+   }
+
+   zzeksemc_ ( query, pq->eqryi, pq->eqryc, error, errmsg, &errptr,
+               qlen,  EQCLEN,    errlen                              );
+}
+
+
+/*
+Map each constraint of an encoded query to the placeholder providing
+its value, if any. Returns the index of a placeholder that does not
+provide the value of any constraint, or -1 if there is none.
+*/
+static SpiceInt mapParms ( PreparedQuery   * pq,
+                           const SpiceInt  * pbegs,
+                           const SpiceInt  * pends,
+                           SpiceBoolean      settyp )
+{
+   char                    alias  [ 64 ];
+   char                    colnam [ 32 ];
+   char                    table  [ 64 ];
+   integer                 attdsc [ ADSCSZ ];
+   integer                 base;
+   integer                 colidx;
+   integer                 i;
+   integer                 lxb;
+   integer                 opcode;
+   integer                 tabidx;
+   SpiceBoolean            used   [ SPICE_EK_MAXQPRM ];
+   SpiceInt                p;
+
+   zzekreqi_ ( pq->eqryi, "NUM_TABLES",      &pq->ntab, 10 );
+   zzekreqi_ ( pq->eqryi, "NUM_CONSTRAINTS", &pq->ncns, 15 );
+
+   for ( p = 0;  p < pq->nparms;  p++ )
+   {
+      used[p] = SPICEFALSE;
+   }
+
+   for ( i = 1;  i <= pq->ncns;  i++ )
+   {
+      base              =  CNSBAS ( pq->ntab, i );
+      opcode            =  pq->eqryi[ base + OPCODE ];
+      pq->cnsprm[i-1]   =  0;
+
+      if (    ( pq->eqryi[ base + CNSTYP ] != CNSVAL )
+           || ( opcode == ISNULL )
+           || ( opcode == NOTNUL )                     )
+      {
+         continue;
+      }
+
+      lxb = pq->eqryi[ base + VALLXB ];
+
+      for ( p = 0;  p < pq->nparms;  p++ )
+      {
+         if (  ( lxb >= pbegs[p] )  &&  ( lxb <= pends[p] )  )
+         {
+            pq->cnsprm[i-1] = p + 1;
+            used[p]         = SPICETRUE;
+
+            if ( settyp )
+            {
+               tabidx = pq->eqryi[ base + LHSTAB ];
+               colidx = pq->eqryi[ base + LHSCOL ];
+
+               zzekqtab_ ( pq->eqryi, pq->eqryc, &tabidx, table, alias,
+                           EQCLEN,    64,        64                      );
+               ekcii_    ( table, &colidx, colnam, attdsc, 64, 32 );
+
+               pq->ptypes[p] = attdsc[1];
+            }
+            break;
+         }
+      }
+   }
+
+   for ( p = 0;  p < pq->nparms;  p++ )
+   {
+      if ( !used[p] )
+      {
+         return p;
+      }
+   }
+
+   return -1;
+}
+
+
+/*
+Look up a prepared query, signaling an error if the handle is invalid.
+*/
+static PreparedQuery * lookup ( SpiceInt          qryhan,
+                                ConstSpiceChar  * caller )
+{
+   if (  ( qryhan < 0 )  ||  ( qryhan >= MAXPQ )  ||  !queries[qryhan]  )
+   {
+      setmsg_c ( "Query handle # does not refer to a prepared query." );
+      errint_c ( "#", qryhan                                         );
+      sigerr_c ( "SPICE(INVALIDHANDLE)"                              );
+      chkout_c ( caller                                              );
+      return 0;
+   }
+
+   return queries[qryhan];
+}
+
+
+static void releaseQuery ( SpiceInt qryhan )
+{
+   SpiceInt                p;
+
+   for ( p = 0;  p < queries[qryhan]->nparms;  p++ )
+   {
+      free ( queries[qryhan]->cvals[p] );
+   }
+
+   free ( queries[qryhan] );
+   queries[qryhan] = 0;
+}
+
+
+
+   void ekpqry_c ( ConstSpiceChar    * query,
+                   SpiceInt            errmln,
+                   SpiceInt          * qryhan,
+                   SpiceInt          * nparms,
+                   SpiceBoolean      * error,
+                   SpiceChar         * errmsg )
+
+{ /* Begin ekpqry_c */
+
+   /*
+   Local variables
+   */
+   logical                 fError = 0;
+
+   PreparedQuery         * pq;
+
+   SpiceChar             * text;
+
+   SpiceInt                h;
+   SpiceInt                p;
+   SpiceInt                pbegs  [ SPICE_EK_MAXQPRM ];
+   SpiceInt                pends  [ SPICE_EK_MAXQPRM ];
+   SpiceInt                pass;
+
+
+   chkin_c ( "ekpqry_c" );
+
+   CHKFSTR ( CHK_STANDARD, "ekpqry_c", query );
+   CHKOSTR ( CHK_STANDARD, "ekpqry_c", errmsg, errmln );
+
+   *error    = SPICEFALSE;
+   errmsg[0] = NULLCHAR;
+
+   for ( h = 0;  ( h < MAXPQ ) && queries[h];  h++ )
+   {
+   }
+
+   if ( h == MAXPQ )
+   {
+      setmsg_c ( "All # prepared query slots are in use. Release "
+                 "queries that are no longer needed with ekpcls_c." );
+      errint_c ( "#", MAXPQ                                         );
+      sigerr_c ( "SPICE(TOOMANYQUERIES)"                            );
+      chkout_c ( "ekpqry_c"                                         );
+      return;
+   }
+
+   pq = ( PreparedQuery * ) calloc ( 1, sizeof(PreparedQuery) );
+
+   if ( pq == 0 )
+   {
+      setmsg_c ( "Failure on malloc call to create prepared query." );
+      sigerr_c ( "SPICE(MALLOCFAILED)"                              );
+      chkout_c ( "ekpqry_c"                                         );
+      return;
+   }
+
+   pq->nparms = countParms ( query );
+
+   if ( pq->nparms > SPICE_EK_MAXQPRM )
+   {
+      free ( pq );
+
+      *error = SPICETRUE;
+      strncpy ( errmsg, "Too many parameter placeholders in query.",
+                errmln-1                                              );
+      errmsg[errmln-1] = NULLCHAR;
+
+      chkout_c ( "ekpqry_c" );
+      return;
+   }
+
+   queries[h] = pq;
+
+   /*
+   The literal substituted for a placeholder must have the type of the
+   column it is compared with. In the first pass, all placeholders are
+   replaced with numbers, which is enough to resolve the column names.
+   The second pass substitutes literals of the resolved types, and the
+   query is then resolved and checked completely.
+   */
+   for ( pass = 0;  pass < 2;  pass++ )
+   {
+      text = substitute ( query, pq->nparms, pq->ptypes, pbegs, pends );
+
+      if ( text == 0 )
+      {
+         releaseQuery ( h );
+
+         setmsg_c ( "Failure on malloc call to create query string." );
+         sigerr_c ( "SPICE(MALLOCFAILED)"                            );
+         chkout_c ( "ekpqry_c"                                       );
+         return;
+      }
+
+      compile ( text, pq, &fError, errmsg, errmln-1 );
+
+      if ( fError || failed_c() )
+      {
+         free ( text );
+         break;
+      }
+
+      p = mapParms ( pq, pbegs, pends, pass == 0 );
+
+      if ( failed_c() )
+      {
+         free ( text );
+         break;
+      }
+
+      if ( p >= 0 )
+      {
+         free ( text );
+         releaseQuery ( h );
+
+         *error = SPICETRUE;
+         strncpy ( errmsg, "Parameter placeholder is not the value "
+                   "of a constraint.", errmln-1                      );
+         errmsg[errmln-1] = NULLCHAR;
+
+         chkout_c ( "ekpqry_c" );
+         return;
+      }
+
+      if ( pass == 1 )
+      {
+         resolve ( text, pq, &fError, errmsg, errmln-1 );
+      }
+
+      free ( text );
+   }
+
+   if ( fError || failed_c() )
+   {
+      releaseQuery ( h );
+
+      if ( fError )
+      {
+         F2C_ConvertStr ( errmln, errmsg );
+         *error = SPICETRUE;
+      }
+
+      chkout_c ( "ekpqry_c" );
+      return;
+   }
+
+   /*
+   Bound character values are appended to the character buffer of the
+   encoded query each time the query is executed, starting here.
+   */
+   zzekreqi_ ( pq->eqryi, "FREE_CHR", &pq->chrfre, 8 );
+
+   /*
+   Record the EK catalog the table and column references were resolved
+   against.
+   */
+   zzekqgen_ ( &pq->gen );
+
+   *qryhan = h;
+   *nparms = pq->nparms;
+
+   chkout_c ( "ekpqry_c" );
+
+} /* End ekpqry_c */
+
+
+
+   void ekpbdd_c ( SpiceInt            qryhan,
+                   SpiceInt            parm,
+                   SpiceDouble         value  )
+
+{ /* Begin ekpbdd_c */
+
+   /*
+   Local variables
+   */
+   PreparedQuery         * pq;
+
+   integer                 base;
+   integer                 i;
+
+
+   chkin_c ( "ekpbdd_c" );
+
+   pq = lookup ( qryhan, "ekpbdd_c" );
+
+   if ( pq == 0 )
+   {
+      return;
+   }
+
+   if (  ( parm < 0 )  ||  ( parm >= pq->nparms )  )
+   {
+      setmsg_c ( "Parameter index # is out of range 0:#." );
+      errint_c ( "#", parm                                );
+      errint_c ( "#", pq->nparms - 1                      );
+      sigerr_c ( "SPICE(INVALIDINDEX)"                    );
+      chkout_c ( "ekpbdd_c"                               );
+      return;
+   }
+
+   if ( pq->ptypes[parm] == CHR )
+   {
+      setmsg_c ( "Parameter # is compared with a character column "
+                 "and must be bound with ekpbdc_c."                 );
+      errint_c ( "#", parm                                          );
+      sigerr_c ( "SPICE(INVALIDTYPE)"                               );
+      chkout_c ( "ekpbdd_c"                                         );
+      return;
+   }
+
+   for ( i = 1;  i <= pq->ncns;  i++ )
+   {
+      if ( pq->cnsprm[i-1] == parm + 1 )
+      {
+         base = CNSBAS ( pq->ntab, i );
+
+         pq->eqryd[ pq->eqryi[ base + VALBEG ] - 1 ] = value;
+      }
+   }
+
+   pq->bound[parm] = SPICETRUE;
+
+   chkout_c ( "ekpbdd_c" );
+
+} /* End ekpbdd_c */
+
+
+
+   void ekpbdc_c ( SpiceInt            qryhan,
+                   SpiceInt            parm,
+                   ConstSpiceChar    * value  )
+
+{ /* Begin ekpbdc_c */
+
+   /*
+   Local variables
+   */
+   PreparedQuery         * pq;
+
+   SpiceChar             * copy;
+
+
+   chkin_c ( "ekpbdc_c" );
+
+   CHKPTR ( CHK_STANDARD, "ekpbdc_c", value );
+
+   pq = lookup ( qryhan, "ekpbdc_c" );
+
+   if ( pq == 0 )
+   {
+      return;
+   }
+
+   if (  ( parm < 0 )  ||  ( parm >= pq->nparms )  )
+   {
+      setmsg_c ( "Parameter index # is out of range 0:#." );
+      errint_c ( "#", parm                                );
+      errint_c ( "#", pq->nparms - 1                      );
+      sigerr_c ( "SPICE(INVALIDINDEX)"                    );
+      chkout_c ( "ekpbdc_c"                               );
+      return;
+   }
+
+   if ( pq->ptypes[parm] != CHR )
+   {
+      setmsg_c ( "Parameter # is compared with a numeric or time "
+                 "column and must be bound with ekpbdd_c."         );
+      errint_c ( "#", parm                                         );
+      sigerr_c ( "SPICE(INVALIDTYPE)"                              );
+      chkout_c ( "ekpbdc_c"                                        );
+      return;
+   }
+
+   copy = ( SpiceChar * ) malloc ( strlen(value) + 1 );
+
+   if ( copy == 0 )
+   {
+      setmsg_c ( "Failure on malloc call to copy parameter value." );
+      sigerr_c ( "SPICE(MALLOCFAILED)"                             );
+      chkout_c ( "ekpbdc_c"                                        );
+      return;
+   }
+
+   strcpy ( copy, value );
+
+   free ( pq->cvals[parm] );
+
+   pq->cvals[parm] = copy;
+   pq->bound[parm] = SPICETRUE;
+
+   chkout_c ( "ekpbdc_c" );
+
+} /* End ekpbdc_c */
+
+
+
+   void ekpfnd_c ( SpiceInt            qryhan,
+                   SpiceInt            errmln,
+                   SpiceInt          * nmrows,
+                   SpiceBoolean      * error,
+                   SpiceChar         * errmsg )
+
+{ /* Begin ekpfnd_c */
+
+   /*
+   Local variables
+   */
+   logical                 fError;
+
+   PreparedQuery         * pq;
+
+   SpiceChar             * cval;
+
+   integer                 base;
+   integer                 descr  [ ADSCSZ ];
+   integer                 gen;
+   integer                 i;
+   integer                 len;
+   integer                 nolex = 0;
+
+   SpiceInt                p;
+
+
+   chkin_c ( "ekpfnd_c" );
+
+   CHKOSTR ( CHK_STANDARD, "ekpfnd_c", errmsg, errmln );
+
+   pq = lookup ( qryhan, "ekpfnd_c" );
+
+   if ( pq == 0 )
+   {
+      return;
+   }
+
+   zzekqgen_ ( &gen );
+
+   if ( gen != pq->gen )
+   {
+      setmsg_c ( "EKs have been loaded or unloaded since query # was "
+                 "prepared. The query must be prepared again."        );
+      errint_c ( "#", qryhan                                          );
+      sigerr_c ( "SPICE(STALEQUERY)"                                  );
+      chkout_c ( "ekpfnd_c"                                           );
+      return;
+   }
+
+   for ( p = 0;  p < pq->nparms;  p++ )
+   {
+      if ( !pq->bound[p] )
+      {
+         setmsg_c ( "No value has been bound to parameter #." );
+         errint_c ( "#", p                                   );
+         sigerr_c ( "SPICE(UNBOUNDPARAMETER)"                );
+         chkout_c ( "ekpfnd_c"                               );
+         return;
+      }
+   }
+
+   /*
+   Store the character values in the encoded query and point the
+   constraints that use them at the stored strings. Empty strings are
+   stored as a single blank, which compares equal in EK queries.
+   */
+   zzekweqi_ ( "FREE_CHR", &pq->chrfre, pq->eqryi, 8 );
+
+   for ( p = 0;  p < pq->nparms;  p++ )
+   {
+      if ( pq->ptypes[p] != CHR )
+      {
+         continue;
+      }
+
+      cval = pq->cvals[p];
+      len  = strlen ( cval );
+
+      if ( len == 0 )
+      {
+         cval = " ";
+         len  = 1;
+      }
+
+      zzekinqc_ ( cval,   &len,      &nolex,    &nolex, pq->eqryi,
+                  pq->eqryc,         descr,     len,   EQCLEN     );
+
+      if ( failed_c() )
+      {
+         chkout_c ( "ekpfnd_c" );
+         return;
+      }
+
+      for ( i = 1;  i <= pq->ncns;  i++ )
+      {
+         if ( pq->cnsprm[i-1] == p + 1 )
+         {
+            base = CNSBAS ( pq->ntab, i );
+
+            pq->eqryi[ base + VALBEG ] = descr[3];
+            pq->eqryi[ base + VALEND ] = descr[4];
+         }
+      }
+   }
+
+   eksrch_ ( pq->eqryi,             pq->eqryc,    pq->eqryd,
+             ( integer * ) nmrows,  &fError,      errmsg,
+             EQCLEN,                errmln-1                  );
+
+   if ( fError )
+   {
+      F2C_ConvertStr ( errmln, errmsg );
+   }
+   else
+   {
+      errmsg[0] = NULLCHAR;
+   }
+
+   *error = fError;
+
+   chkout_c ( "ekpfnd_c" );
+
+} /* End ekpfnd_c */
+
+
+
+   void ekpcls_c ( SpiceInt            qryhan )
+
+{ /* Begin ekpcls_c */
+
+   chkin_c ( "ekpcls_c" );
+
+   if ( lookup ( qryhan, "ekpcls_c" ) == 0 )
+   {
+      return;
+   }
+
+   releaseQuery ( qryhan );
+
+   chkout_c ( "ekpcls_c" );
+
+} /* End ekpcls_c */
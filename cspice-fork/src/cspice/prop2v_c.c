@@ -0,0 +1,231 @@
+/*
+
+-Procedure prop2v_c ( Propagate many two-body states )
+
+-Abstract
+
+   Propagate many states relative to one central mass under two-body
+   motion, by the same time offset.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   None.
+
+-Keywords
+
+   CONIC
+   EPHEMERIS
+   UTILITY
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+   #include "SpiceZmc.h"
+
+
+   void prop2v_c ( SpiceDouble         gm,
+                   SpiceInt            n,
+                   ConstSpiceDouble    pvinit [],
+                   SpiceDouble         dt,
+                   SpiceDouble         pvprop [] )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   gm         I   Gravity of the central mass
+   n          I   Number of states
+   pvinit     I   Initial states, as six arrays of `n' components
+   dt         I   Time offset
+   pvprop     O   Propagated states, as six arrays of `n' components
+
+-Detailed_Input
+
+   gm          is the gravitational parameter of the central mass,
+               in km**3/sec**2, as for prop2b_c.
+
+   n           is the number of states.
+
+   pvinit      is an array of 6*n components of states relative to
+               the central mass, stored as a structure of arrays:
+               component `k' (0 to 5, for x, y, z, dx/dt, dy/dt and
+               dz/dt) of state `i' is
+
+                  pvinit[ k*n + i ]
+
+   dt          is the time offset in seconds from the initial states
+               to the propagated states.
+
+-Detailed_Output
+
+   pvprop      is an array of 6*n components of the propagated
+               states, laid out as `pvinit'. Each state is exactly the
+               state prop2b_c would produce from the corresponding
+               initial state.
+
+               `pvprop' must not overlap `pvinit'.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `n' is negative, the error SPICE(INVALIDCOUNT) is
+       signaled.
+
+   2)  If `gm' is not positive, the error SPICE(NONPOSITIVEMASS) is
+       signaled.
+
+   3)  If the position or velocity of a state is the zero vector,
+       the error SPICE(ZEROPOSITION) or SPICE(ZEROVELOCITY) is
+       signaled.
+
+   4)  If the position and velocity of a state are parallel, the
+       error SPICE(NONCONICMOTION) is signaled.
+
+   5)  If `dt' is beyond the range for which a state can be
+       propagated reliably, the error SPICE(DTOUTOFRANGE) is
+       signaled.
+
+   In cases 3 to 5 the error is signaled for the first such state,
+   after all the other states have been propagated.
+
+-Files
+
+   None.
+
+-Particulars
+
+   prop2b_c searches a small buffer of recently used initial states
+   and participates in error tracing on every call. This routine
+   propagates the states in blocks, finding the universal variable of
+   all the states of a block in lock step with the convergence
+   criteria of prop2b_c, in loops the compiler can vectorize. It is
+   intended for propagating large numbers of states, such as the
+   samples of a Monte Carlo analysis.
+
+-Examples
+
+   1)    /.
+         Propagate `n' states stored as a structure of arrays.
+         ./
+         prop2v_c ( gm, n, pvinit, dt, pvprop );
+
+         /.
+         The x velocity of state `i' after `dt' seconds is
+         ./
+         vx = pvprop[ 3*n + i ];
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0, 16-OCT-2026
+
+-Index_Entries
+
+   propagate many states using two-body force model
+
+-&
+*/
+
+{ /* Begin prop2v_c */
+
+   /*
+   Local constants
+   */
+   static integer          single = 0;
+
+   /*
+   Local variables
+   */
+   integer                 code;
+   integer                 fail;
+   integer                 nn;
+
+
+   /*
+   Participate in error tracing.
+   */
+   chkin_c ( "prop2v_c" );
+
+   if ( n < 0 )
+   {
+      setmsg_c ( "The number of states must be non-negative but "
+                 "was #."                                         );
+      errint_c ( "#", n                                           );
+      sigerr_c ( "SPICE(INVALIDCOUNT)"                            );
+      chkout_c ( "prop2v_c"                                       );
+      return;
+   }
+
+   if ( gm <= 0. )
+   {
+      setmsg_c ( "The gravitational parameter must be positive but "
+                 "was #."                                            );
+      errdp_c  ( "#", gm                                             );
+      sigerr_c ( "SPICE(NONPOSITIVEMASS)"                            );
+      chkout_c ( "prop2v_c"                                          );
+      return;
+   }
+
+   nn = n;
+
+   zzprop2v_ ( &nn,
+               &nn,
+               ( doublereal * ) &gm,
+               &single,
+               ( doublereal * ) pvinit,
+               ( doublereal * ) &dt,
+               &single,
+               ( doublereal * ) pvprop,
+               &fail,
+               &code                    );
+
+   if ( fail != 0 )
+   {
+      zzp2verr_ ( &fail, &code );
+   }
+
+   chkout_c ( "prop2v_c" );
+
+} /* End prop2v_c */
@@ -36,6 +36,9 @@ static integer c__1 = 1;
     integer iostat;
     extern /* Subroutine */ int errint_(char *, integer *, ftnlen);
     extern logical return_(void);
+    extern integer zzxfrgt_(integer *, integer *, char *, ftnlen);
+    extern logical zzhx2dp_(char *, doublereal *, ftnlen);
+    integer nread;
 
     /* Fortran I/O blocks */
     static cilist io___4 = { 1, 0, 1, 0, 0 };
@@ -195,6 +198,12 @@ static integer c__1 = 1;
 
 /* $ Version */
 
+/* -    SPICELIB Version 1.3.0, 16-OCT-2026 */
+
+/*        Encoded numbers in the form WRENCD writes them are now read */
+/*        by ZZXFRGT and decoded by ZZHX2DP, falling back to the list */
+/*        directed read and HX2DP for anything else. */
+
 /* -    SPICELIB Version 1.2.0, 03-JUN-2021 (JDR) */
 
 /*        Added IMPLICIT NONE statement. */
@@ -276,15 +285,25 @@ static integer c__1 = 1;
 	i__1 = 64, i__2 = *n - itmbeg + 1;
 	nitms = min(i__1,i__2);
 
-/*        Read in a block of data items to be decoded. */
+/*        Read in a block of data items to be decoded. Items in the */
+/*        form WRENCD writes are read directly by ZZXFRGT; a list */
+/*        directed read handles any that follow in another form. */
 
+	nread = zzxfrgt_(unit, &nitms, work, (ftnlen)64);
+	if (nread == nitms) {
+	    iostat = 0;
+	    goto L100001;
+	} else if (nread == -2) {
+	    iostat = -1;
+	    goto L100001;
+	}
 	io___4.ciunit = *unit;
 	iostat = s_rsle(&io___4);
 	if (iostat != 0) {
 	    goto L100001;
 	}
 	i__1 = nitms;
-	for (i__ = 1; i__ <= i__1; ++i__) {
+	for (i__ = max(nread,0) + 1; i__ <= i__1; ++i__) {
 	    iostat = do_lio(&c__9, &c__1, work + (((i__2 = i__ - 1) < 64 && 0 
 		    <= i__2 ? i__2 : s_rnge("work", i__2, "rdencd_", (ftnlen)
 		    274)) << 6), (ftnlen)64);
@@ -315,10 +334,15 @@ L100001:
 
 	i__2 = nitms;
 	for (i__ = 1; i__ <= i__2; ++i__) {
-	    hx2dp_(work + (((i__1 = i__ - 1) < 64 && 0 <= i__1 ? i__1 : 
-		    s_rnge("work", i__1, "rdencd_", (ftnlen)298)) << 6), &
-		    data[itmbeg + i__ - 2], &error, errmsg, (ftnlen)64, (
-		    ftnlen)80);
+	    error = FALSE_;
+	    if (! zzhx2dp_(work + (((i__1 = i__ - 1) < 64 && 0 <= i__1 ? 
+		    i__1 : s_rnge("work", i__1, "rdencd_", (ftnlen)298)) << 6)
+		    , &data[itmbeg + i__ - 2], (ftnlen)64)) {
+		hx2dp_(work + (((i__1 = i__ - 1) < 64 && 0 <= i__1 ? i__1 : 
+			s_rnge("work", i__1, "rdencd_", (ftnlen)298)) << 6), &
+			data[itmbeg + i__ - 2], &error, errmsg, (ftnlen)64, (
+			ftnlen)80);
+	    }
 	    if (error) {
 		setmsg_("Decoding error occurred while attempting to decode "
 			"item #: #. #", (ftnlen)63);
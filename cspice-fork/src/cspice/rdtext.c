@@ -5,10 +5,6 @@
 
 #include "f2c.h"
 
-/* Table of constant values */
-
-static integer c__1 = 1;
-
 /* $Procedure RDTEXT ( Read a line from a text file ) */
 /* Subroutine */ int rdtext_0_(int n__, char *file, char *line, logical *eof, 
 	ftnlen file_len, ftnlen line_len)
@@ -24,7 +20,6 @@ static integer c__1 = 1;
 
     /* System generated locals */
     integer i__1, i__2, i__3;
-    cilist ci__1;
     olist o__1;
     cllist cl__1;
     inlist ioin__1;
@@ -33,8 +28,7 @@ static integer c__1 = 1;
     integer s_cmp(char *, char *, ftnlen, ftnlen), f_inqu(inlist *), f_open(
 	    olist *), s_rnge(char *, integer, char *, integer);
     /* Subroutine */ int s_copy(char *, char *, ftnlen, ftnlen);
-    integer s_rsfe(cilist *), do_fio(integer *, char *, ftnlen), e_rsfe(void),
-	     f_clos(cllist *);
+    integer f_clos(cllist *);
 
     /* Local variables */
     logical same;
@@ -42,7 +36,8 @@ static integer c__1 = 1;
     extern /* Subroutine */ int chkin_(char *, ftnlen), errch_(char *, char *,
 	     ftnlen, ftnlen);
     static integer index, units[96];
-    extern integer isrchi_(integer *, integer *, integer *);
+    extern integer isrchi_(integer *, integer *, integer *), zzrdlin_(
+	    integer *, char *, ftnlen);
     integer number;
     extern /* Subroutine */ int sigerr_(char *, ftnlen), chkout_(char *, 
 	    ftnlen), getlun_(integer *);
@@ -292,6 +287,10 @@ static integer c__1 = 1;
 
 /* $ Version */
 
+/* -    SPICELIB Version 6.28.0, 16-OCT-2026 */
+
+/*        Lines are read by ZZRDLIN rather than by a formatted READ. */
+
 /* -    SPICELIB Version 6.27.0, 28-NOV-2021 (BVS) */
 
 /*        Updated for MAC-OSX-M1-64BIT-CLANG_C. */
@@ -698,22 +697,11 @@ static integer c__1 = 1;
 		"units", i__1, "rdtext_", (ftnlen)681)];
     }
 
-/*     This is the easy part. Read the next line from the file. */
+/*     This is the easy part. Read the next line from the file. ZZRDLIN */
+/*     reads the line as READ with format (A) would, without */
+/*     interpreting the format for each line. */
 
-    ci__1.cierr = 1;
-    ci__1.ciend = 1;
-    ci__1.ciunit = lstunt;
-    ci__1.cifmt = "(A)";
-    iostat = s_rsfe(&ci__1);
-    if (iostat != 0) {
-	goto L100001;
-    }
-    iostat = do_fio(&c__1, line, line_len);
-    if (iostat != 0) {
-	goto L100001;
-    }
-    iostat = e_rsfe();
-L100001:
+    iostat = zzrdlin_(&lstunt, line, line_len);
 
 /*     Well, what happened? An end-of-file condition is indicated by */
 /*     a negative value for IOSTAT. Any other non-zero value indicates */
@@ -3,8 +3,57 @@
 	-lf2c -lm   (in that order)
 */
 
+#include <string.h>
 #include "f2c.h"
 
+/*     NBCNAM is the number of slots of the ZZBODN2C name cache. Each */
+/*     slot holds a name exactly as it was passed to ZZBODN2C, along */
+/*     with the result of the lookup and the value of the ZZBODTRN */
+/*     state counter at the time. A slot is valid only while the state */
+/*     counter is unchanged, so any change to the name-code mappings */
+/*     invalidates the whole cache. */
+
+#ifndef NBCNAM
+#define NBCNAM 64
+#endif
+
+static char bcnam[NBCNAM][36];
+static ftnlen bclen[NBCNAM];
+static integer bccod[NBCNAM];
+static logical bcfnd[NBCNAM];
+static integer bcctr[NBCNAM][2];
+
+/* $Procedure ZZBCSLOT ( Name cache slot of a body name ) */
+static integer zzbcslot(char *name__, ftnlen name_len)
+{
+    unsigned long h;
+    ftnlen i__;
+
+    h = 2166136261UL;
+    for (i__ = 0; i__ < name_len; ++i__) {
+	h = ((h ^ (unsigned char)name__[i__]) * 16777619UL) & 0xffffffffUL;
+    }
+    return (integer) (h % NBCNAM);
+}
+
+/* $Procedure ZZBCSAVE ( Save a body name lookup in the name cache ) */
+static void zzbcsave(char *name__, ftnlen name_len, integer *subctr, 
+	integer code, logical found)
+{
+    integer slot;
+
+    if (name_len > 36) {
+	return;
+    }
+    slot = zzbcslot(name__, name_len);
+    memcpy(bcnam[slot], name__, (size_t)name_len);
+    bclen[slot] = name_len;
+    bccod[slot] = code;
+    bcfnd[slot] = found;
+    bcctr[slot][0] = subctr[0];
+    bcctr[slot][1] = subctr[1];
+}
+
 /* Table of constant values */
 
 static integer c__853 = 853;
@@ -63,6 +112,8 @@ static integer c__1 = 1;
     static integer dnmlst[853], knmpol[14989];
     static char knmnms[36*14983];
     static integer subctr[2], kersiz, knmlst[14983], pulctr[2];
+    integer slot;
+    ftnlen rawlen;
     extern /* Subroutine */ int sigerr_(char *, ftnlen), chkout_(char *, 
 	    ftnlen), ljucrs_(integer *, char *, char *, ftnlen, ftnlen), 
 	    setmsg_(char *, ftnlen);
@@ -1131,6 +1182,12 @@ L_zzbodn2c:
 
 /* $ Version */
 
+/* -    SPICELIB Version 5.1.0, 16-OCT-2026 */
+
+/*        Names are looked up, exactly as given, in a cache of recent */
+/*        lookups before being normalized. The cache is invalidated */
+/*        whenever the ZZBODTRN state counter changes. */
+
 /* -    SPICELIB Version 5.0.0, 16-SEP-2013 (BVS) */
 
 /*        Changed to use name-based hashes instead of the order arrays. */
@@ -1303,6 +1360,26 @@ L_zzbodn2c:
 	nodata = FALSE_;
     }
 
+/*     Look for the name, exactly as given, in the name cache. A hit */
+/*     avoids normalizing the name and searching the hashes. Trailing */
+/*     blanks are not significant. */
+
+    rawlen = name_len;
+    while (rawlen > 0 && name__[rawlen - 1] == ' ') {
+	--rawlen;
+    }
+    if (rawlen <= 36) {
+	slot = zzbcslot(name__, rawlen);
+	if (bclen[slot] == rawlen && bcctr[slot][0] == subctr[0] && bcctr[
+		slot][1] == subctr[1] && memcmp(bcnam[slot], name__, (size_t)
+		rawlen) == 0) {
+	    *code = bccod[slot];
+	    *found = bcfnd[slot];
+	    chkout_("ZZBODN2C", (ftnlen)8);
+	    return 0;
+	}
+    }
+
 /*     Normalize the input argument NAME. We will look this normalized */
 /*     name up in the built-in and kernel pool names hashes. */
 
@@ -1323,6 +1400,7 @@ L_zzbodn2c:
 		    1196)] - 1) < 14983 && 0 <= i__2 ? i__2 : s_rnge("kercod",
 		     i__2, "zzbodtrn_", (ftnlen)1196)];
 	    *found = TRUE_;
+	    zzbcsave(name__, rawlen, subctr, *code, *found);
 	    chkout_("ZZBODN2C", (ftnlen)8);
 	    return 0;
 	}
@@ -1339,6 +1417,7 @@ L_zzbodn2c:
 		"n_", (ftnlen)1212)];
 	*found = TRUE_;
     }
+    zzbcsave(name__, rawlen, subctr, *code, *found);
     chkout_("ZZBODN2C", (ftnlen)8);
     return 0;
 /* $Procedure ZZBODC2N ( Private --- Body code to name ) */
@@ -0,0 +1,538 @@
+/*
+
+-Procedure zzekjhsh ( EK, join hash table )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Build and probe a hash table of column entries, used by the EK
+   query system to perform equi-joins.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   EK
+
+-Keywords
+
+   EK
+   PRIVATE
+
+*/
+
+   #include <stdlib.h>
+   #include <string.h>
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+   /*
+   Column entry data types.
+   */
+   #define CHR             1
+
+   /*
+   Maximum length of a character column entry compared by the EK
+   query system.
+   */
+   #define MAXSTR          1024
+
+   /*
+   Initial size of the character value buffer.
+   */
+   #define INICHR          4096
+
+   /*
+   Element of the index of the column descriptor containing the
+   data type.
+   */
+   #define TYPIDX          1
+
+   /*
+   A table entry. Numeric and time values are compared as double
+   precision numbers, as they are by zzekecmp_; character values
+   are stored in a separate buffer.
+   */
+   typedef struct
+   {
+      doublereal           dval;
+      unsigned long        hash;
+      long                 coff;
+      integer              clen;
+      integer              rvidx;
+      integer              next;
+      logical              isnull;
+   }  HashEntry;
+
+   /*
+   The table under construction or being probed. Only one table
+   exists at a time.
+   */
+   static HashEntry      * entries = 0;
+   static integer        * buckets = 0;
+   static SpiceChar      * chrbuf  = 0;
+   static long             chrsiz  = 0;
+   static long             chrfre  = 0;
+   static integer          nbuckt  = 0;
+   static integer          maxent  = 0;
+   static integer          nentry  = 0;
+   static integer          keytyp  = 0;
+
+   /*
+   The probe in progress.
+   */
+   static HashEntry        probe;
+   static SpiceChar        prbchr [ MAXSTR ];
+   static integer          cursor  = 0;
+
+
+/*
+Read a column entry and compute its hash value. Character values
+are written to cval; trailing blanks are not significant.
+*/
+static void readKey ( integer         * handle,
+                      integer         * segdsc,
+                      integer         * coldsc,
+                      integer         * row,
+                      integer         * elt,
+                      HashEntry       * entry,
+                      SpiceChar       * cval    )
+{
+   logical                 found;
+   integer                 cvlen;
+   integer                 i;
+   integer                 ival;
+   unsigned long           h = 2166136261UL;
+   unsigned char         * bytes;
+
+   entry->dval = 0.;
+   entry->clen = 0;
+
+   if ( coldsc[TYPIDX] == CHR )
+   {
+      zzekrsc_ ( handle, segdsc, coldsc, row, elt, &cvlen, cval,
+                 &entry->isnull, &found, MAXSTR                    );
+
+      if ( found && !entry->isnull )
+      {
+         entry->clen = ( cvlen < MAXSTR ) ? cvlen : MAXSTR;
+
+         while (  ( entry->clen > 0 )  &&  ( cval[entry->clen-1] == ' ' )  )
+         {
+            entry->clen--;
+         }
+
+         for ( i = 0;  i < entry->clen;  i++ )
+         {
+            h = ( h ^ (unsigned char) cval[i] ) * 16777619UL;
+         }
+      }
+   }
+   else if ( coldsc[TYPIDX] == 3 )
+   {
+      zzekrsi_ ( handle, segdsc, coldsc, row, elt, &ival,
+                 &entry->isnull, &found                   );
+
+      entry->dval = (doublereal) ival;
+   }
+   else
+   {
+      zzekrsd_ ( handle, segdsc, coldsc, row, elt, &entry->dval,
+                 &entry->isnull, &found                         );
+   }
+
+   if ( !found )
+   {
+      chkin_c  ( "zzekjhsh_"                                       );
+      setmsg_c ( "EK = #; COLIDX = #; ROW = #; ELTIDX = #. Column "
+                 "entry element was not found."                     );
+      errhan_  ( "#", handle, 1                                     );
+      errint_c ( "#", coldsc[8]                                     );
+      errint_c ( "#", *row                                          );
+      errint_c ( "#", *elt                                          );
+      sigerr_c ( "SPICE(INVALIDINDEX)"                              );
+      chkout_c ( "zzekjhsh_"                                        );
+      return;
+   }
+
+   if ( coldsc[TYPIDX] != CHR )
+   {
+      /*
+      Zero compares equal to negative zero.
+      */
+      if ( entry->dval == 0. )
+      {
+         entry->dval = 0.;
+      }
+
+      bytes = (unsigned char *) &entry->dval;
+
+      for ( i = 0;  i < (integer) sizeof(doublereal);  i++ )
+      {
+         h = ( h ^ bytes[i] ) * 16777619UL;
+      }
+   }
+
+   /*
+   Null values are equal to each other; see zzekecmp_.
+   */
+   entry->hash = entry->isnull ? 0UL : h;
+}
+
+
+/*
+Return true if two entries have equal keys. The character value
+of the first entry is given by cval.
+*/
+static SpiceBoolean keysEqual ( HashEntry       * a,
+                                ConstSpiceChar  * cval,
+                                HashEntry       * b     )
+{
+   if ( a->isnull || b->isnull )
+   {
+      return (  a->isnull && b->isnull  );
+   }
+
+   if ( a->hash != b->hash )
+   {
+      return SPICEFALSE;
+   }
+
+   if ( keytyp == CHR )
+   {
+      return (    ( a->clen == b->clen )
+               && ( memcmp ( cval, chrbuf + b->coff, a->clen ) == 0 )  );
+   }
+
+   return ( a->dval == b->dval );
+}
+
+
+/*
+-Brief_I/O
+
+   VARIABLE  I/O  ENTRY POINT
+   --------  ---  --------------------------------------------------
+   nrows      I   zzekjhin_
+   coltyp     I   zzekjhin_
+   ok         O   zzekjhin_, zzekjhad_
+   handle     I   zzekjhad_, zzekjhpb_
+   segdsc     I   zzekjhad_, zzekjhpb_
+   coldsc     I   zzekjhad_, zzekjhpb_
+   row        I   zzekjhad_, zzekjhpb_
+   elt        I   zzekjhad_, zzekjhpb_
+   rvidx     I/O  zzekjhad_, zzekjhnx_
+   found      O   zzekjhnx_
+
+-Detailed_Input
+
+   nrows          is the number of column entries to be added to the
+                  table.
+
+   coltyp         is the data type of the column entries to be added
+                  to the table.
+
+   handle,
+   segdsc,
+   coldsc,
+   row,
+   elt            are, respectively, the handle of an EK, a segment
+                  descriptor, a column descriptor, a row pointer and
+                  an element index identifying a column entry
+                  element.
+
+   rvidx          is the index of the row vector containing a column
+                  entry added to the table.
+
+-Detailed_Output
+
+   ok             is SPICETRUE if memory for the table could be
+                  allocated. If not, the caller should use another
+                  join method.
+
+   rvidx          is the index of the row vector containing a column
+                  entry matching the probe.
+
+   found          is SPICETRUE if another matching entry was found.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If a column entry element cannot be found, the error
+       SPICE(INVALIDINDEX) is signaled.
+
+   2)  Failure to allocate memory is reported through the ok
+       argument rather than signaled, so that the caller can fall
+       back to a join method that uses no additional memory.
+
+-Files
+
+   None.
+
+-Particulars
+
+   These routines support the hash join method of zzekjprp_ and
+   zzekjnxt_. The column entries of one of the join row sets are
+   added to the table with zzekjhad_. Then, for each column entry of
+   the other join row set, zzekjhpb_ starts a probe and zzekjhnx_
+   returns the indices of the row vectors with equal entries, in the
+   order opposite to that in which they were added.
+
+   Entries are equal when zzekecmp_ would find them equal: numeric
+   and time values are compared as double precision numbers, trailing
+   blanks in character values are not significant, and null values
+   are equal to each other.
+
+   Each join row set is read once, so a join of row sets of sizes N
+   and M requires O(N+M) column entry reads, compared with
+   O(N log N + M log M) for the sort-merge method and O(N*M) for
+   exhaustive comparison.
+
+-Examples
+
+   See zzekjtst_.
+
+-Restrictions
+
+   1)  Only one table exists at a time.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0
+
+-Index_Entries
+
+   EK join hash table
+
+-&
+*/
+
+
+   int zzekjhin_ ( integer  * nrows,
+                   integer  * coltyp,
+                   logical  * ok     )
+
+{ /* Begin zzekjhin_ */
+
+   integer                 i;
+
+   zzekjhcl_();
+
+   *ok     = 0;
+   keytyp  = *coltyp;
+   maxent  = ( *nrows > 0 ) ? *nrows : 1;
+
+   nbuckt = 1;
+
+   while ( nbuckt < 2 * maxent )
+   {
+      nbuckt *= 2;
+   }
+
+   entries = (HashEntry *) malloc ( maxent * sizeof(HashEntry) );
+   buckets = (integer   *) malloc ( nbuckt * sizeof(integer)   );
+
+   if ( keytyp == CHR )
+   {
+      chrsiz = INICHR;
+      chrbuf = (SpiceChar *) malloc ( chrsiz );
+   }
+
+   if (    ( entries == 0 )
+        || ( buckets == 0 )
+        || ( ( keytyp == CHR ) && ( chrbuf == 0 ) ) )
+   {
+      zzekjhcl_();
+      return 0;
+   }
+
+   for ( i = 0;  i < nbuckt;  i++ )
+   {
+      buckets[i] = -1;
+   }
+
+   *ok = 1;
+
+   return 0;
+
+} /* End zzekjhin_ */
+
+
+
+   int zzekjhad_ ( integer  * handle,
+                   integer  * segdsc,
+                   integer  * coldsc,
+                   integer  * row,
+                   integer  * elt,
+                   integer  * rvidx,
+                   logical  * ok     )
+
+{ /* Begin zzekjhad_ */
+
+   HashEntry             * entry;
+   SpiceChar             * newbuf;
+   long                    newsiz;
+   integer                 b;
+
+   *ok = 0;
+
+   if (  ( entries == 0 )  ||  ( nentry == maxent )  )
+   {
+      return 0;
+   }
+
+   entry = entries + nentry;
+
+   readKey ( handle, segdsc, coldsc, row, elt, entry, prbchr );
+
+   if ( failed_c() )
+   {
+      return 0;
+   }
+
+   if ( keytyp == CHR )
+   {
+      if ( chrfre + entry->clen > chrsiz )
+      {
+         newsiz = 2 * chrsiz + entry->clen;
+         newbuf = (SpiceChar *) realloc ( chrbuf, newsiz );
+
+         if ( newbuf == 0 )
+         {
+            return 0;
+         }
+
+         chrbuf = newbuf;
+         chrsiz = newsiz;
+      }
+
+      memcpy ( chrbuf + chrfre, prbchr, entry->clen );
+      entry->coff  = chrfre;
+      chrfre      += entry->clen;
+   }
+
+   b            = (integer) ( entry->hash & (unsigned long)(nbuckt - 1) );
+   entry->rvidx = *rvidx;
+   entry->next  = buckets[b];
+   buckets[b]   = nentry;
+
+   nentry++;
+
+   *ok = 1;
+
+   return 0;
+
+} /* End zzekjhad_ */
+
+
+
+   int zzekjhpb_ ( integer  * handle,
+                   integer  * segdsc,
+                   integer  * coldsc,
+                   integer  * row,
+                   integer  * elt     )
+
+{ /* Begin zzekjhpb_ */
+
+   cursor = -1;
+
+   readKey ( handle, segdsc, coldsc, row, elt, &probe, prbchr );
+
+   if (  failed_c()  ||  ( buckets == 0 )  )
+   {
+      return 0;
+   }
+
+   cursor = buckets[ probe.hash & (unsigned long)(nbuckt - 1) ];
+
+   return 0;
+
+} /* End zzekjhpb_ */
+
+
+
+   int zzekjhnx_ ( logical  * found,
+                   integer  * rvidx  )
+
+{ /* Begin zzekjhnx_ */
+
+   *found = 0;
+
+   while ( cursor >= 0 )
+   {
+      if ( keysEqual ( &probe, prbchr, entries + cursor ) )
+      {
+         *found = 1;
+         *rvidx = entries[cursor].rvidx;
+         cursor = entries[cursor].next;
+
+         return 0;
+      }
+
+      cursor = entries[cursor].next;
+   }
+
+   return 0;
+
+} /* End zzekjhnx_ */
+
+
+
+   int zzekjhcl_ ( void )
+
+{ /* Begin zzekjhcl_ */
+
+   free ( entries );
+   free ( buckets );
+   free ( chrbuf  );
+
+   entries = 0;
+   buckets = 0;
+   chrbuf  = 0;
+   chrsiz  = 0;
+   chrfre  = 0;
+   nbuckt  = 0;
+   maxent  = 0;
+   nentry  = 0;
+   cursor  = -1;
+
+   return 0;
+
+} /* End zzekjhcl_ */
@@ -21,7 +21,7 @@ static integer c_b53 = 100000;
 	*cgrptr)
 {
     /* System generated locals */
-    integer i__1, i__2, i__3, i__4;
+    integer i__1, i__2, i__3, i__4, i__5, i__6;
     doublereal d__1, d__2, d__3;
 
     /* Builtin functions */
@@ -31,21 +31,15 @@ static integer c_b53 = 100000;
     double pow_dd(doublereal *, doublereal *);
 
     /* Local variables */
-    static integer cvid, npcg;
+    static integer cvid, npcg, pass;
     static doublereal vmod[3], xmin, ymin, xmax;
-    extern integer zzvox2id_(integer *, integer *);
+    static integer aval;
     static doublereal ymax, zmax, zmin;
-    extern /* Subroutine */ int zzaddlnk_(integer *, integer *, integer *, 
-	    integer *, integer *, integer *, integer *), zzinilnk_(integer *, 
-	    integer *, integer *, integer *, integer *);
-    static integer i__, j;
-    extern /* Subroutine */ int zzuntngl_(integer *, integer *, integer *, 
-	    integer *, integer *, integer *, integer *), zzgetvox_(doublereal 
-	    *, doublereal *, integer *, doublereal *, logical *, integer *);
+    static integer i__, j, k, n;
+    extern /* Subroutine */ int zzgetvox_(doublereal *, doublereal *, 
+	    integer *, doublereal *, logical *, integer *);
     static integer q, r__, cgoff[3];
-    extern /* Subroutine */ int zzvoxcvo_(integer *, integer *, integer *, 
-	    integer *, integer *, integer *), chkin_(char *, ftnlen);
-    static integer ncell;
+    extern /* Subroutine */ int chkin_(char *, ftnlen);
     extern /* Subroutine */ int vpack_(doublereal *, doublereal *, doublereal 
 	    *, doublereal *);
     extern doublereal dpmin_(void), dpmax_(void);
@@ -56,8 +50,7 @@ static integer c_b53 = 100000;
     static logical inbox;
     extern /* Subroutine */ int errdp_(char *, doublereal *, ftnlen);
     static doublereal xvmin, yvmin, xvmax, yvmax, zvmax, zvmin;
-    static integer cgof1d, cgxyz[3], ixptr, vixyz[3];
-    extern logical failed_(void);
+    static integer cgof1d, cgxyz[3], ixptr, ptrdex;
     extern /* Subroutine */ int cleari_(integer *, integer *);
     static integer ncgflg, ix, iy, iz, to, cgrdim[3], nx;
     static doublereal xp[3];
@@ -419,18 +412,19 @@ static integer c_b53 = 100000;
 /*                list of voxel pointers. */
 
 /*     MXCELL     is the number of cells in the input cell array. */
-/*                This is the second dimension of the array. */
+/*                This is the second dimension of the array. MXCELL */
+/*                is not used. */
 
 /*     MAXVXL     is the maximum number of elements in the output */
 /*                voxel-plate list. */
 
-/*     CELLS      workspace array used to construct the voxel-plate */
-/*                mapping. */
+/*     CELLS      workspace array formerly used to construct the */
+/*                voxel-plate mapping. CELLS is not used; the mapping */
+/*                is built in place in VXPTR and VXLIST. */
 
 /* $ Detailed_Output */
 
-/*     CELLS      workspace array used to construct the voxel-plate */
-/*                mapping. */
+/*     CELLS      is not modified. */
 
 /*     NVOX       Dimensions of the voxel grid in voxel units. */
 
@@ -492,14 +486,13 @@ static integer c_b53 = 100000;
 /*         fine voxel count evenly, the error SPICE(INCOMPATIBLESCALE) */
 /*         will be signaled. */
 
-/*     7)  If the workspace overflows while this routine accumulates */
-/*         voxel-plate associations, the error will be signaled by */
-/*         a routine in the call tree of this routine. */
+/*     7)  If the voxel pointer array size MAXPTR is too small to hold */
+/*         the pointers of all non-empty coarse voxels, the error */
+/*         SPICE(AVALOUTOFRANGE) is signaled. */
 
-/*     8)  If the voxel-plate association list array overflows while */
-/*         this routine accumulates voxel-plate associations, the error */
-/*         will be signaled by a routine in the call tree of this */
-/*         routine. */
+/*     8)  If the voxel-plate list size MAXVXL is too small to hold */
+/*         the voxel-plate associations, the error */
+/*         SPICE(BARRAYTOOSMALL) is signaled. */
 
 /* $ Files */
 
@@ -531,6 +524,15 @@ static integer c_b53 = 100000;
 
 /* $ Version */
 
+/* -    SPICELIB Version 2.0.0, 16-OCT-2026 */
+
+/*        The voxel-plate mapping is now built in place, in two */
+/*        passes over the plates: the first counts the plates of each */
+/*        fine voxel, the second stores them in the lists. The linked */
+/*        list workspace CELLS is no longer used, and the computations */
+/*        of ZZVOXCVO and ZZVOX2ID are done in line. The resulting */
+/*        spatial index is unchanged. */
+
 /* -    SPICELIB Version 1.0.0, 17-FEB-2017 (NJB) */
 
 /*        Added new error checks. */
@@ -893,7 +895,17 @@ static integer c_b53 = 100000;
 
 /*     Enumerate all voxels that each plate might intersect. */
 
-    zzinilnk_(maxptr, mxcell, &ncell, vxptr, cells);
+/*     This is done in two passes over the plates, so that the */
+/*     voxel-plate list can be built in place without workspace. */
+/*     The first pass allocates pointers for the coarse voxels, in */
+/*     order of first use, and counts the plates associated with */
+/*     each fine voxel; the counts are accumulated in VXPTR. The */
+/*     counts give the location of each voxel's list in VXLIST. The */
+/*     second pass stores the plate IDs in those lists. */
+
+/*     Each list holds its plate IDs in decreasing order, as did the */
+/*     lists built by earlier versions of this routine, so the */
+/*     spatial index is unchanged. */
 
 /*     Set the dimensions of the coarse grid. */
 
@@ -905,13 +917,14 @@ static integer c_b53 = 100000;
 /*     TO points to the first free location in the VXPTR array. */
 
     to = 1;
-    i__1 = *np;
-    for (i__ = 1; i__ <= i__1; ++i__) {
+    for (pass = 1; pass <= 2; ++pass) {
+	i__1 = *np;
+	for (i__ = 1; i__ <= i__1; ++i__) {
 
-/*        Find the extents of the Ith plate, where the extents */
-/*        are expanded by TOL in each direction. We truncate */
-/*        the expanded box at a distance of MDLTOL beyond the */
-/*        extents of the vertex set, if necessary. */
+/*           Find the extents of the Ith plate, where the extents */
+/*           are expanded by TOL in each direction. We truncate */
+/*           the expanded box at a distance of MDLTOL beyond the */
+/*           extents of the vertex set, if necessary. */
 
 	xp[0] = vrtces[plates[i__ * 3 - 3] * 3 - 3];
 	xp[1] = vrtces[plates[i__ * 3 - 2] * 3 - 3];
@@ -947,18 +960,19 @@ static integer c_b53 = 100000;
 	d__1 = max(d__2,zp[2]) + mdltol;
 	bzmax = brcktd_(&d__1, &xextnt[4], &xextnt[5]);
 
-/*        Find the range of voxel coordinates that contain the bounding */
-/*        box of the plate. All we need look at are the coordinates */
-/*        of the two corners having minimum and maximum coordinates. */
+/*           Find the range of voxel coordinates that contain the */
+/*           bounding box of the plate. All we need look at are the */
+/*           coordinates of the two corners having minimum and maximum */
+/*           coordinates. */
 
-/*        Start with the corner having minimum coordinates: */
+/*           Start with the corner having minimum coordinates: */
 
 	vpack_(&bxmin, &bymin, &bzmin, vmod);
 	zzgetvox_(voxsiz, voxori, nvox, vmod, &inbox, vcoord);
 	if (! inbox) {
 
-/*           A corner of the bounding box lies outside the voxel grid. */
-/*           This should never occur. */
+/*              A corner of the bounding box lies outside the voxel */
+/*              grid. This should never occur. */
 
 	    setmsg_("BUG: bounding box of plate is outside of voxel grid. In"
 		    "put coordinates were (#, #, #). Plate ID = #.", (ftnlen)
@@ -972,20 +986,20 @@ static integer c_b53 = 100000;
 	    return 0;
 	}
 
-/*        Unpack minimum voxel coordinates from VCOORD. */
+/*           Unpack minimum voxel coordinates from VCOORD. */
 
 	gxmin = vcoord[0];
 	gymin = vcoord[1];
 	gzmin = vcoord[2];
 
-/*        Now handle the corner having maximum coordinates: */
+/*           Now handle the corner having maximum coordinates: */
 
 	vpack_(&bxmax, &bymax, &bzmax, vmod);
 	zzgetvox_(voxsiz, voxori, nvox, vmod, &inbox, vcoord);
 	if (! inbox) {
 
-/*           A corner of the bounding box lies outside the voxel grid. */
-/*           This should never occur. */
+/*              A corner of the bounding box lies outside the voxel */
+/*              grid. This should never occur. */
 
 	    setmsg_("BUG: bounding box of plate is outside of voxel grid. In"
 		    "put coordinates were (#, #, #). Plate ID = #.", (ftnlen)
@@ -999,69 +1013,143 @@ static integer c_b53 = 100000;
 	    return 0;
 	}
 
-/*        Unpack maximum voxel coordinates from VCOORD. */
+/*           Unpack maximum voxel coordinates from VCOORD. */
 
 	gxmax = vcoord[0];
 	gymax = vcoord[1];
 	gzmax = vcoord[2];
 
-/*        Determine voxels that the bounding box of the plate */
-/*        intersects. */
-
-	i__2 = gzmax;
-	for (iz = gzmin; iz <= i__2; ++iz) {
-	    i__3 = gymax;
-	    for (iy = gymin; iy <= i__3; ++iy) {
-		i__4 = gxmax;
-		for (ix = gxmin; ix <= i__4; ++ix) {
-		    vixyz[0] = ix;
-		    vixyz[1] = iy;
-		    vixyz[2] = iz;
-
-/*                   Find the coarse voxel containing this voxel, and */
-/*                   compute the offset of this voxel within the coarse */
-/*                   voxel. The output CGXYZ contains the 3-dimensional */
-/*                   coordinates of the coarse voxel within the coarse */
-/*                   grid. The output CGOF1D is the 1-based, */
-/*                   1-dimensional offset of the current voxel (having */
-/*                   coordinates VIXYZ) from the start of the coarse */
-/*                   voxel. */
-
-		    zzvoxcvo_(vixyz, nvox, cgscal, cgxyz, cgoff, &cgof1d);
-		    if (failed_()) {
-			chkout_("ZZMKSPIN", (ftnlen)8);
-			return 0;
-		    }
-		    cvid = zzvox2id_(cgxyz, cgrdim);
-		    if (cgrptr[cvid - 1] == 0) {
-
-/*                      The coarse voxel at index CVID is empty so far. */
-/*                      Allocate CGSCAL pointers for it in the VXPTR */
-/*                      array; make the coarse voxel point to the first */
-/*                      element of this sub-array. */
-
-			cgrptr[cvid - 1] = to;
-			to += npcg;
+/*           Determine voxels that the bounding box of the plate */
+/*           intersects. */
+
+	    i__2 = gzmax;
+	    for (iz = gzmin; iz <= i__2; ++iz) {
+		i__3 = gymax;
+		for (iy = gymin; iy <= i__3; ++iy) {
+		    i__4 = gxmax;
+		    for (ix = gxmin; ix <= i__4; ++ix) {
+
+/*                    Find the coarse voxel containing this voxel, and */
+/*                    compute the 1-based, 1-dimensional offset CGOF1D */
+/*                    of this voxel from the start of the coarse voxel. */
+/*                    This is the computation of ZZVOXCVO; the voxel */
+/*                    coordinates are known to be valid here. */
+
+			cgxyz[0] = (ix - 1) / *cgscal + 1;
+			cgxyz[1] = (iy - 1) / *cgscal + 1;
+			cgxyz[2] = (iz - 1) / *cgscal + 1;
+			cgoff[0] = ix - *cgscal * (cgxyz[0] - 1);
+			cgoff[1] = iy - *cgscal * (cgxyz[1] - 1);
+			cgoff[2] = iz - *cgscal * (cgxyz[2] - 1);
+			cgof1d = (cgoff[2] - 1) * *cgscal * *cgscal + (cgoff[
+				1] - 1) * *cgscal + cgoff[0];
+			cvid = cgxyz[0] + cgrdim[0] * (cgxyz[1] - 1 + (cgxyz[
+				2] - 1) * cgrdim[1]);
+			if (pass == 1) {
+			    if (cgrptr[cvid - 1] == 0) {
+
+/*                          The coarse voxel at index CVID is empty so */
+/*                          far. Allocate NPCG pointers for it in the */
+/*                          VXPTR array, with zero plate counts; make */
+/*                          the coarse voxel point to the first element */
+/*                          of this sub-array. */
+
+				cgrptr[cvid - 1] = to;
+/* Computing MIN */
+				i__5 = npcg, i__6 = *maxptr - to + 1;
+				n = min(i__5,i__6);
+				if (n > 0) {
+				    cleari_(&n, &vxptr[to - 1]);
+				}
+				to += npcg;
+			    }
+			}
+
+/*                    Let IXPTR be the index in the VXPTR array of */
+/*                    the pointer for the current voxel. */
+
+			ixptr = cgrptr[cvid - 1] - 1 + cgof1d;
+			if (pass == 1) {
+			    if (ixptr > *maxptr) {
+				setmsg_("Index AVAL is out of range. AVAL = "
+					"#1; valid range is 1:#2.", (ftnlen)
+					59);
+				errint_("#1", &ixptr, (ftnlen)2);
+				errint_("#2", maxptr, (ftnlen)2);
+				sigerr_("SPICE(AVALOUTOFRANGE)", (ftnlen)21);
+				chkout_("ZZMKSPIN", (ftnlen)8);
+				return 0;
+			    }
+			    ++vxptr[ixptr - 1];
+			} else {
+
+/*                       VXLIST(J) holds the number of IDs still to */
+/*                       be stored in this voxel's list. Store the ID */
+/*                       in the last free element of the list. */
+
+			    j = vxptr[ixptr - 1];
+			    k = vxlist[j - 1];
+			    vxlist[j + k - 1] = i__;
+			    vxlist[j - 1] = k - 1;
+			}
 		    }
+		}
+	    }
+	}
+	if (pass == 1) {
+	    *nvxptr = to - 1;
+
+/*           Make sure the voxel-plate list fits in VXLIST. Each */
+/*           non-empty voxel needs one element for its plate count */
+/*           and one for each of its plates. */
+
+	    *nvxlst = 0;
+	    i__1 = *nvxptr;
+	    for (aval = 1; aval <= i__1; ++aval) {
+		if (vxptr[aval - 1] > 0) {
+		    *nvxlst = *nvxlst + 1 + vxptr[aval - 1];
+		}
+	    }
+	    if (*nvxlst > *maxvxl) {
+		setmsg_("The voxel-plate list requires # elements; the outpu"
+			"t list size MAXVXL is #.", (ftnlen)75);
+		errint_("#", nvxlst, (ftnlen)1);
+		errint_("#", maxvxl, (ftnlen)1);
+		sigerr_("SPICE(BARRAYTOOSMALL)", (ftnlen)21);
+		chkout_("ZZMKSPIN", (ftnlen)8);
+		return 0;
+	    }
 
-/*                   Let IXPTR be the index in the VXPTR array of the */
-/*                   pointer for the current voxel. */
-
-		    ixptr = cgrptr[cvid - 1] - 1 + cgof1d;
-		    zzaddlnk_(&ixptr, &i__, maxptr, mxcell, vxptr, &ncell, 
-			    cells);
-		    if (failed_()) {
-			chkout_("ZZMKSPIN", (ftnlen)8);
-			return 0;
-		    }
+/*           Replace each count with a pointer to the start of the */
+/*           voxel's list in VXLIST, or with -1 if the voxel is empty, */
+/*           and store the count at the start of the list. */
+
+	    ptrdex = 0;
+	    i__1 = *nvxptr;
+	    for (aval = 1; aval <= i__1; ++aval) {
+		n = vxptr[aval - 1];
+		if (n > 0) {
+		    vxlist[ptrdex] = n;
+		    vxptr[aval - 1] = ptrdex + 1;
+		    ptrdex = ptrdex + 1 + n;
+		} else {
+		    vxptr[aval - 1] = -1;
 		}
 	    }
 	}
     }
-    *nvxptr = to - 1;
 
-/*     Generate two linked lists mapping voxel ID to the plates enclosed */
-/*     within that voxel (if any). */
+/*     The second pass has reduced the counts at the start of the */
+/*     lists to zero. Restore them; the lists are contiguous. */
+
+    ptrdex = *nvxlst + 1;
+    for (aval = *nvxptr; aval >= 1; --aval) {
+	j = vxptr[aval - 1];
+	if (j > 0) {
+	    vxlist[j - 1] = ptrdex - j - 1;
+	    ptrdex = j;
+	}
+    }
 
 /*     VXPTR : An array, indexed by voxel ID. For an array element, */
 /*             VXPTR(VOX_ID), greater than zero, the value identifies an */
@@ -1079,7 +1167,6 @@ static integer c_b53 = 100000;
 /*             The N elements following VXLIST( VXPTR(VOX_ID) ), */
 /*             contain the IDs of those plates within the voxel. */
 
-    zzuntngl_(nvxptr, mxcell, cells, maxvxl, vxptr, nvxlst, vxlist);
     chkout_("ZZMKSPIN", (ftnlen)8);
     return 0;
 } /* zzmkspin_ */
@@ -0,0 +1,59 @@
+#include "f2c.h"
+#include "fio.h"
+#include <string.h>
+
+/* Read the next record from the file connected for formatted
+   sequential input to Unit, as a READ with format (A) into LINE
+   would: characters beyond the length of LINE are skipped, and LINE
+   is padded with blanks. The record is read with fgets rather than
+   through the formatted I/O library, so the format need not be
+   interpreted for each record. The return value is zero on success,
+   negative at end of file, and positive if the unit is not connected
+   for formatted sequential input or the read fails. */
+
+ integer
+#ifdef KR_headers
+zzrdlin_(Unit, line, line_len) integer *Unit; char *line; ftnlen line_len;
+#else
+zzrdlin_(integer *Unit, char *line, ftnlen line_len)
+#endif
+{
+	unit *u;
+	FILE *f;
+	char buf[1024];
+	size_t n;
+	ftnlen i, m;
+	int got, nl;
+
+	if (*Unit >= MXUNIT || *Unit < 0)
+		return 101;
+	u = &f__units[*Unit];
+	if ((f = u->ufd) == NULL || u->url != 0 || !u->ufmt || u->uwrt)
+		return 102;
+	i = 0;
+	got = 0;
+	for(;;) {
+		if (fgets(buf, (int)sizeof(buf), f) == NULL) {
+			if (got)
+				break;
+			return ferror(f) ? 115 : -1;
+			}
+		got = 1;
+		n = strlen(buf);
+		nl = n > 0 && buf[n-1] == '\n';
+		if (nl)
+			--n;
+		m = line_len - i;
+		if ((ftnlen)n < m)
+			m = (ftnlen)n;
+		if (m > 0) {
+			memcpy(line + i, buf, (size_t)m);
+			i += m;
+			}
+		if (nl)
+			break;
+		}
+	if (i < line_len)
+		memset(line + i, ' ', (size_t)(line_len - i));
+	return 0;
+	}
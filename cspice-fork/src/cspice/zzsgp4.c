@@ -15,7 +15,7 @@ static logical c_false = FALSE_;
 
 /* $Procedure ZZSGP4 ( SGP4 wrapper ) */
 /* Subroutine */ int zzsgp4_0_(int n__, doublereal *geophs, doublereal *elems,
-	 integer *opmode, doublereal *t, doublereal *state)
+	 integer *opmode, doublereal *t, doublereal *state, doublereal *rec)
 {
     /* System generated locals */
     doublereal d__1, d__2;
@@ -775,6 +775,13 @@ static logical c_false = FALSE_;
 
 /* $ Version */
 
+/* -    SPICELIB Version 1.1.0, 16-OCT-2026 */
+
+/*        Added entry points XXSGP4S and XXSGP4R, which save the */
+/*        state set by XXSGP4I to a record and restore it, so that */
+/*        element sets can be initialized once and evaluated many */
+/*        times. */
+
 /* -    SPICELIB Version 1.0.1, 30-MAY-2021 (EDW) (JDR) */
 
 /*        Correction of documentation error in listing of GEOPHS */
@@ -808,11 +815,15 @@ static logical c_false = FALSE_;
 	}
     if (state) {
 	}
+    if (rec) {
+	}
 
     /* Function Body */
     switch(n__) {
 	case 1: goto L_xxsgp4i;
 	case 2: goto L_xxsgp4e;
+	case 3: goto L_xxsgp4s;
+	case 4: goto L_xxsgp4r;
 	}
 
     chkin_("ZZSGP4", (ftnlen)6);
@@ -1802,24 +1813,374 @@ L_xxsgp4e:
     }
     chkout_("XXSGP4E", (ftnlen)7);
     return 0;
+/* $Procedure XXSGP4S ( SGP4 save state ) */
+
+L_xxsgp4s:
+/* $ Abstract */
+
+/*     Save the state set by XXSGP4I to a record. */
+
+/* $ Declarations */
+
+/*     DOUBLE PRECISION      REC   ( * ) */
+
+/* $ Brief_I/O */
+
+/*     VARIABLE  I/O  DESCRIPTION */
+/*     --------  ---  -------------------------------------------------- */
+/*     REC        O   Record of the SGP4 state. */
+
+/* $ Detailed_Input */
+
+/*     None. */
+
+/* $ Detailed_Output */
+
+/*     REC      is a record holding every value set by the last call */
+/*              to XXSGP4I, in a form that XXSGP4R can restore. REC */
+/*              must have room for 97 values. */
+
+/* $ Parameters */
+
+/*     None. */
+
+/* $ Exceptions */
+
+/*     Error free. */
+
+/* $ Files */
+
+/*     None. */
+
+/* $ Particulars */
+
+/*     XXSGP4I does all of the work that depends only on the element */
+/*     set, including a time conversion. Saving its state lets a */
+/*     caller evaluate many element sets at many times, initializing */
+/*     each element set only once. Restoring a record with XXSGP4R */
+/*     and calling XXSGP4E gives exactly the state that XXSGP4I */
+/*     followed by XXSGP4E would. */
+
+/* $ Examples */
+
+/*     None. */
+
+/* $ Restrictions */
+
+/*     1)  XXSGP4I must have been called. */
+
+/* $ Literature_References */
+
+/*     None. */
+
+/* $ Author_and_Institution */
+
+/*     None. */
+
+/* $ Version */
+
+/* -    SPICELIB Version 1.0.0, 16-OCT-2026 */
+
+/* -& */
+/* $ Index_Entries */
+
+/*     save SGP4 state */
+
+/* -& */
+    rec[0] = ecco;
+    rec[1] = alta;
+    rec[2] = dedt;
+    rec[3] = con41;
+    rec[4] = didt;
+    rec[5] = dmdt;
+    rec[6] = pgho;
+    rec[7] = altp;
+    rec[8] = mdot;
+    rec[9] = j3oj2;
+    rec[10] = gsto;
+    rec[11] = zmol;
+    rec[12] = zmos;
+    rec[13] = t2cof;
+    rec[14] = t3cof;
+    rec[15] = t4cof;
+    rec[16] = t5cof;
+    rec[17] = a;
+    rec[18] = atime;
+    rec[19] = aycof;
+    rec[20] = inclo;
+    rec[21] = xfact;
+    rec[22] = pinco;
+    rec[23] = argpo;
+    rec[24] = xlcof;
+    rec[25] = xmcof;
+    rec[26] = bstar;
+    rec[27] = xlamo;
+    rec[28] = x1mth2;
+    rec[29] = delmo;
+    rec[30] = d2;
+    rec[31] = d3;
+    rec[32] = x7thm1;
+    rec[33] = e3;
+    rec[34] = d4;
+    rec[35] = dnodt;
+    rec[36] = domdt;
+    rec[37] = j2;
+    rec[38] = nodeo;
+    rec[39] = er;
+    rec[40] = mo;
+    rec[41] = no;
+    rec[42] = omgcof;
+    rec[43] = xnodcf;
+    rec[44] = cc1;
+    rec[45] = sinmao;
+    rec[46] = cc4;
+    rec[47] = cc5;
+    rec[48] = ee2;
+    rec[49] = se2;
+    rec[50] = se3;
+    rec[51] = sh2;
+    rec[52] = sh3;
+    rec[53] = xh2;
+    rec[54] = xh3;
+    rec[55] = xi2;
+    rec[56] = xi3;
+    rec[57] = xl2;
+    rec[58] = xl3;
+    rec[59] = xl4;
+    rec[60] = si2;
+    rec[61] = si3;
+    rec[62] = sl2;
+    rec[63] = sl3;
+    rec[64] = sl4;
+    rec[65] = d2201;
+    rec[66] = d2211;
+    rec[67] = d3210;
+    rec[68] = d3222;
+    rec[69] = d4410;
+    rec[70] = d5220;
+    rec[71] = d4422;
+    rec[72] = d5232;
+    rec[73] = d5421;
+    rec[74] = d5433;
+    rec[75] = eta;
+    rec[76] = peo;
+    rec[77] = pho;
+    rec[78] = xke;
+    rec[79] = plo;
+    rec[80] = xli;
+    rec[81] = xni;
+    rec[82] = nodedot;
+    rec[83] = argpdot;
+    rec[84] = del1;
+    rec[85] = del2;
+    rec[86] = del3;
+    rec[87] = sgh2;
+    rec[88] = sgh3;
+    rec[89] = sgh4;
+    rec[90] = xgh2;
+    rec[91] = xgh3;
+    rec[92] = xgh4;
+    rec[93] = (doublereal) irez;
+    rec[94] = (doublereal) svmode;
+    rec[95] = dosimp ? 1. : 0.;
+    rec[96] = dodeep ? 1. : 0.;
+    return 0;
+/* $Procedure XXSGP4R ( SGP4 restore state ) */
+
+L_xxsgp4r:
+/* $ Abstract */
+
+/*     Restore a state saved by XXSGP4S. */
+
+/* $ Declarations */
+
+/*     DOUBLE PRECISION      REC   ( * ) */
+
+/* $ Brief_I/O */
+
+/*     VARIABLE  I/O  DESCRIPTION */
+/*     --------  ---  -------------------------------------------------- */
+/*     REC        I   Record of the SGP4 state. */
+
+/* $ Detailed_Input */
+
+/*     REC      is a record written by XXSGP4S. */
+
+/* $ Detailed_Output */
+
+/*     None. */
+
+/* $ Parameters */
+
+/*     None. */
+
+/* $ Exceptions */
+
+/*     Error free. */
+
+/* $ Files */
+
+/*     None. */
+
+/* $ Particulars */
+
+/*     After this call XXSGP4E evaluates the element set from which */
+/*     REC was saved. See XXSGP4S. */
+
+/* $ Examples */
+
+/*     None. */
+
+/* $ Restrictions */
+
+/*     1)  REC must have been written by XXSGP4S. */
+
+/* $ Literature_References */
+
+/*     None. */
+
+/* $ Author_and_Institution */
+
+/*     None. */
+
+/* $ Version */
+
+/* -    SPICELIB Version 1.0.0, 16-OCT-2026 */
+
+/* -& */
+/* $ Index_Entries */
+
+/*     restore SGP4 state */
+
+/* -& */
+    ecco = rec[0];
+    alta = rec[1];
+    dedt = rec[2];
+    con41 = rec[3];
+    didt = rec[4];
+    dmdt = rec[5];
+    pgho = rec[6];
+    altp = rec[7];
+    mdot = rec[8];
+    j3oj2 = rec[9];
+    gsto = rec[10];
+    zmol = rec[11];
+    zmos = rec[12];
+    t2cof = rec[13];
+    t3cof = rec[14];
+    t4cof = rec[15];
+    t5cof = rec[16];
+    a = rec[17];
+    atime = rec[18];
+    aycof = rec[19];
+    inclo = rec[20];
+    xfact = rec[21];
+    pinco = rec[22];
+    argpo = rec[23];
+    xlcof = rec[24];
+    xmcof = rec[25];
+    bstar = rec[26];
+    xlamo = rec[27];
+    x1mth2 = rec[28];
+    delmo = rec[29];
+    d2 = rec[30];
+    d3 = rec[31];
+    x7thm1 = rec[32];
+    e3 = rec[33];
+    d4 = rec[34];
+    dnodt = rec[35];
+    domdt = rec[36];
+    j2 = rec[37];
+    nodeo = rec[38];
+    er = rec[39];
+    mo = rec[40];
+    no = rec[41];
+    omgcof = rec[42];
+    xnodcf = rec[43];
+    cc1 = rec[44];
+    sinmao = rec[45];
+    cc4 = rec[46];
+    cc5 = rec[47];
+    ee2 = rec[48];
+    se2 = rec[49];
+    se3 = rec[50];
+    sh2 = rec[51];
+    sh3 = rec[52];
+    xh2 = rec[53];
+    xh3 = rec[54];
+    xi2 = rec[55];
+    xi3 = rec[56];
+    xl2 = rec[57];
+    xl3 = rec[58];
+    xl4 = rec[59];
+    si2 = rec[60];
+    si3 = rec[61];
+    sl2 = rec[62];
+    sl3 = rec[63];
+    sl4 = rec[64];
+    d2201 = rec[65];
+    d2211 = rec[66];
+    d3210 = rec[67];
+    d3222 = rec[68];
+    d4410 = rec[69];
+    d5220 = rec[70];
+    d4422 = rec[71];
+    d5232 = rec[72];
+    d5421 = rec[73];
+    d5433 = rec[74];
+    eta = rec[75];
+    peo = rec[76];
+    pho = rec[77];
+    xke = rec[78];
+    plo = rec[79];
+    xli = rec[80];
+    xni = rec[81];
+    nodedot = rec[82];
+    argpdot = rec[83];
+    del1 = rec[84];
+    del2 = rec[85];
+    del3 = rec[86];
+    sgh2 = rec[87];
+    sgh3 = rec[88];
+    sgh4 = rec[89];
+    xgh2 = rec[90];
+    xgh3 = rec[91];
+    xgh4 = rec[92];
+    irez = (integer) rec[93];
+    svmode = (integer) rec[94];
+    dosimp = rec[95] != 0.;
+    dodeep = rec[96] != 0.;
+    return 0;
 } /* zzsgp4_ */
 
 /* Subroutine */ int zzsgp4_(doublereal *geophs, doublereal *elems, integer *
 	opmode, doublereal *t, doublereal *state)
 {
-    return zzsgp4_0_(0, geophs, elems, opmode, t, state);
+    return zzsgp4_0_(0, geophs, elems, opmode, t, state, (doublereal *)0);
     }
 
 /* Subroutine */ int xxsgp4i_(doublereal *geophs, doublereal *elems, integer *
 	opmode)
 {
     return zzsgp4_0_(1, geophs, elems, opmode, (doublereal *)0, (doublereal *)
-	    0);
+	    0, (doublereal *)0);
     }
 
 /* Subroutine */ int xxsgp4e_(doublereal *t, doublereal *state)
 {
     return zzsgp4_0_(2, (doublereal *)0, (doublereal *)0, (integer *)0, t, 
-	    state);
+	    state, (doublereal *)0);
+    }
+
+/* Subroutine */ int xxsgp4s_(doublereal *rec)
+{
+    return zzsgp4_0_(3, (doublereal *)0, (doublereal *)0, (integer *)0, (
+	    doublereal *)0, (doublereal *)0, rec);
+    }
+
+/* Subroutine */ int xxsgp4r_(doublereal *rec)
+{
+    return zzsgp4_0_(4, (doublereal *)0, (doublereal *)0, (integer *)0, (
+	    doublereal *)0, (doublereal *)0, rec);
     }
 
@@ -1472,6 +1472,7 @@ extern int dafbna_(integer *handle, doublereal *sum, char *name__, ftnlen name_l
 extern int dafada_(doublereal *data, integer *n);
 extern int dafena_(void);
 extern int dafcad_(integer *handle);
+extern int dafwbs_(integer *n);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
 /*:ref: sigerr_ 14 2 13 124 */
@@ -1645,6 +1646,7 @@ extern int dafgda_(integer *handle, integer *baddr, integer *eaddr, doublereal *
 /*:ref: dafarw_ 14 3 4 4 4 */
 /*:ref: dafgdr_ 14 6 4 4 4 4 7 12 */
 /*:ref: cleard_ 14 2 4 7 */
+/*:ref: zzdafgbf_ 12 4 4 4 4 7 */
  
 extern int dafps_(integer *nd, integer *ni, doublereal *dc, integer *ic, doublereal *sum);
 extern int dafus_(doublereal *sum, integer *nd, integer *ni, doublereal *dc, integer *ic);
@@ -1690,6 +1692,7 @@ extern int dafrda_(integer *handle, integer *begin, integer *end, doublereal *da
 /*:ref: dafarw_ 14 3 4 4 4 */
 /*:ref: dafrdr_ 14 6 4 4 4 4 7 12 */
 /*:ref: cleard_ 14 2 4 7 */
+/*:ref: zzdafgbf_ 12 4 4 4 4 7 */
  
 extern int dafrfr_(integer *handle, integer *nd, integer *ni, char *ifname, integer *fward, integer *bward, integer *free, ftnlen ifname_len);
 /*:ref: return_ 12 0 */
@@ -1736,6 +1739,7 @@ extern int dafgdr_(integer *handle, integer *recno, integer *begin, integer *end
 extern int dafgsr_(integer *handle, integer *recno, integer *begin, integer *end, doublereal *data, logical *found);
 extern int dafrdr_(integer *handle, integer *recno, integer *begin, integer *end, doublereal *data, logical *found);
 extern int dafwdr_(integer *handle, integer *recno, doublereal *drec);
+extern int dafwdn_(integer *handle, integer *recno, integer *nrec, doublereal *drecs);
 extern int dafnrr_(integer *reads, integer *reqs);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
@@ -1818,6 +1822,7 @@ extern int dafwda_(integer *handle, integer *begin, integer *end, doublereal *da
 /*:ref: cleard_ 14 2 4 7 */
 /*:ref: moved_ 14 3 7 4 7 */
 /*:ref: dafwdr_ 14 3 4 4 7 */
+/*:ref: dafwdn_ 14 4 4 4 4 7 */
  
 extern int dafwfr_(integer *handle, integer *nd, integer *ni, char *ifname, integer *fward, integer *bward, integer *free, ftnlen ifname_len);
 /*:ref: return_ 12 0 */
@@ -1843,6 +1848,7 @@ extern int dasa2l_(integer *handle, integer *type__, integer *addrss, integer *c
 /*:ref: failed_ 12 0 */
 /*:ref: dashfs_ 14 9 4 4 4 4 4 4 4 4 4 */
 /*:ref: dasrri_ 14 5 4 4 4 4 4 */
+extern int zzdasa2c_(integer *handle);
  
 extern int dasac_(integer *handle, integer *n, char *buffer, ftnlen buffer_len);
 /*:ref: return_ 12 0 */
@@ -2071,6 +2077,7 @@ extern int dasham_(integer *handle, char *access, ftnlen access_len);
 /*:ref: zzplatfm_ 14 4 13 13 124 124 */
 /*:ref: zzdasnfr_ 14 11 4 13 13 4 4 4 4 13 124 124 124 */
 /*:ref: zzddhcls_ 14 4 4 13 12 124 */
+/*:ref: zzdasa2c_ 14 1 4 */
 /*:ref: lnkfsl_ 14 3 4 4 4 */
 /*:ref: removi_ 14 2 4 4 */
 /*:ref: errfnm_ 14 3 13 4 124 */
@@ -3270,6 +3277,7 @@ extern int eknelt_(integer *selidx, integer *row, integer *nelt);
 extern int ekgc_(integer *selidx, integer *row, integer *elment, char *cdata, logical *null, logical *found, ftnlen cdata_len);
 extern int ekgd_(integer *selidx, integer *row, integer *elment, doublereal *ddata, logical *null, logical *found);
 extern int ekgi_(integer *selidx, integer *row, integer *elment, integer *idata, logical *null, logical *found);
+extern int zzekqgen_(integer *gen);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
 /*:ref: sigerr_ 14 2 13 124 */
@@ -6073,6 +6081,7 @@ extern int cltext_(char *file, ftnlen file_len);
 /*:ref: chkout_ 14 2 13 124 */
 /*:ref: isrchi_ 4 3 4 4 4 */
 /*:ref: getlun_ 14 1 4 */
+/*:ref: zzrdlin_ 4 3 4 13 124 */
  
 extern int readla_(integer *unit, integer *maxlin, integer *numlin, char *array, logical *eof, ftnlen array_len);
 /*:ref: return_ 12 0 */
@@ -9602,6 +9611,7 @@ extern int trcnam_(integer *index, char *name__, ftnlen name_len);
 extern int qcktrc_(char *trace, ftnlen trace_len);
 extern int freeze_(void);
 extern int trcoff_(void);
+extern int trcmod_(char *mode, ftnlen mode_len);
 /*:ref: wrline_ 14 4 13 13 124 124 */
 /*:ref: frstnb_ 4 2 13 124 */
 /*:ref: getdev_ 14 2 13 124 */
@@ -9610,6 +9620,11 @@ extern int trcoff_(void);
 /*:ref: failed_ 12 0 */
 /*:ref: intstr_ 14 3 4 13 124 */
 /*:ref: suffix_ 14 5 13 4 13 124 124 */
+/*:ref: eqstr_ 12 4 13 13 124 124 */
+/*:ref: setmsg_ 14 2 13 124 */
+/*:ref: errch_ 14 4 13 13 124 124 */
+/*:ref: sigerr_ 14 2 13 124 */
+/*:ref: errint_ 14 3 13 4 124 */
  
 extern doublereal trgsep_(doublereal *et, char *targ1, char *shape1, char *frame1, char *targ2, char *shape2, char *frame2, char *obsrvr, char *abcorr, ftnlen targ1_len, ftnlen shape1_len, ftnlen frame1_len, ftnlen targ2_len, ftnlen shape2_len, ftnlen frame2_len, ftnlen obsrvr_len, ftnlen abcorr_len);
 /*:ref: return_ 12 0 */
@@ -10608,6 +10623,9 @@ extern int zzcxbrut_(doublereal *apex, doublereal *axis, doublereal *angle, doub
 /*:ref: vlcom_ 14 5 7 7 7 7 7 */
 /*:ref: vadd_ 14 3 7 7 7 */
  
+extern logical zzdafgbf_(integer *handle, integer *baddr, integer *eaddr, doublereal *data);
+/*:ref: dafwda_ 14 4 4 4 4 7 */
+ 
 extern int zzdafgdr_(integer *handle, integer *recno, doublereal *dprec, logical *found);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
@@ -12276,6 +12294,15 @@ extern int zzekixlk_(integer *handle, integer *coldsc, integer *key, integer *re
 /*:ref: sigerr_ 14 2 13 124 */
 /*:ref: chkout_ 14 2 13 124 */
  
+extern int zzekjhin_(integer *nrows, integer *coltyp, logical *ok);
+extern int zzekjhad_(integer *handle, integer *segdsc, integer *coldsc, integer *row, integer *elt, integer *rvidx, logical *ok);
+extern int zzekjhpb_(integer *handle, integer *segdsc, integer *coldsc, integer *row, integer *elt);
+extern int zzekjhnx_(logical *found, integer *rvidx);
+extern int zzekjhcl_(void);
+/*:ref: zzekrsc_ 14 10 4 4 4 4 4 4 13 12 12 124 */
+/*:ref: zzekrsd_ 14 8 4 4 4 4 4 7 12 12 */
+/*:ref: zzekrsi_ 14 8 4 4 4 4 4 4 12 12 */
+ 
 extern int zzekjoin_(integer *jbase1, integer *jbase2, integer *njcnst, logical *active, integer *cpidx1, integer *clidx1, integer *elts1, integer *ops, integer *cpidx2, integer *clidx2, integer *elts2, integer *sthan, integer *stsdsc, integer *stdtpt, integer *dtpool, integer *dtdscs, integer *jbase3, integer *nrows);
 /*:ref: chkin_ 14 2 13 124 */
 /*:ref: setmsg_ 14 2 13 124 */
@@ -14774,6 +14801,20 @@ extern int zzprscor_(char *abcorr, logical *attblk, ftnlen abcorr_len);
 /*:ref: sigerr_ 14 2 13 124 */
 /*:ref: chkout_ 14 2 13 124 */
  
+extern int zzprop2v_(integer *n, integer *ld, doublereal *gm, integer *gmstep, doublereal *pvinit, doublereal *dt, integer *dtstep, doublereal *pvprop, integer *fail, integer *code);
+/*:ref: dpmax_ 7 0 */
+/*:ref: vzero_ 12 1 7 */
+/*:ref: vnorm_ 7 1 7 */
+/*:ref: vdot_ 7 2 7 7 */
+/*:ref: vcrss_ 14 3 7 7 7 */
+/*:ref: vlcom_ 14 5 7 7 7 7 7 */
+/*:ref: brcktd_ 7 3 7 7 7 */
+ 
+extern int zzp2verr_(integer *fail, integer *code);
+/*:ref: setmsg_ 14 2 13 124 */
+/*:ref: errint_ 14 3 13 4 124 */
+/*:ref: sigerr_ 14 2 13 124 */
+ 
 extern int zzprsmet_(integer *bodyid, char *method, integer *mxnsrf, char *shape, char *subtyp, logical *pri, integer *nsurf, integer *srflst, char *pntdef, char *trmtyp, ftnlen method_len, ftnlen shape_len, ftnlen subtyp_len, ftnlen pntdef_len, ftnlen trmtyp_len);
 /*:ref: return_ 12 0 */
 /*:ref: chkin_ 14 2 13 124 */
@@ -15180,6 +15221,8 @@ extern int zzsglatx_(doublereal *p1, doublereal *p2, doublereal *minlat, doubler
 extern int zzsgp4_(doublereal *geophs, doublereal *elems, integer *opmode, doublereal *t, doublereal *state);
 extern int xxsgp4i_(doublereal *geophs, doublereal *elems, integer *opmode);
 extern int xxsgp4e_(doublereal *t, doublereal *state);
+extern int xxsgp4s_(doublereal *rec);
+extern int xxsgp4r_(doublereal *rec);
 /*:ref: chkin_ 14 2 13 124 */
 /*:ref: setmsg_ 14 2 13 124 */
 /*:ref: sigerr_ 14 2 13 124 */
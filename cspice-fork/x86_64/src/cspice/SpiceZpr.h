@@ -58,6 +58,44 @@
 
 -Version
 
+   -CSPICE Version 13.6.0
+
+       Added prototype for
+
+          dafwbs_c
+
+   -CSPICE Version 13.5.0
+
+       Added prototypes for
+
+          conicv_c
+          prop2v_c
+
+   -CSPICE Version 13.4.0
+
+       Added prototypes for
+
+          sgp4ev_c
+          sgp4in_c
+
+   -CSPICE Version 13.3.0
+
+       Added a prototype for bodctr_c.
+
+   -CSPICE Version 13.2.0
+
+       Added a prototype for trcmod_c.
+
+   -CSPICE Version 13.1.0
+
+       Added prototypes for
+
+          ekpbdc_c
+          ekpbdd_c
+          ekpcls_c
+          ekpfnd_c
+          ekpqry_c
+
    -CSPICE Version 13.0.0, 05-NOV-2021 (JDR) (MCS) (NJB)
 
        Fixed size of "accobs" argument of spkaps_c: it was 6 when it
@@ -896,6 +934,10 @@ Include Files:
                                 SpiceBoolean       * found );
 
 
+   void              bodctr_c ( SpiceInt             ctr    [2],
+                                SpiceBoolean       * update     );
+
+
    void              bods2c_c ( ConstSpiceChar     * name,
                                 SpiceInt           * code,
                                 SpiceBoolean       * found );
@@ -1215,6 +1257,12 @@ Include Files:
                                 SpiceDouble         state[6] );
 
 
+   void              conicv_c ( SpiceInt            n,
+                                ConstSpiceDouble    elts   [][8],
+                                SpiceDouble         et,
+                                SpiceDouble         states [][6] );
+
+
    void              convrt_c ( SpiceDouble         x,
                                 ConstSpiceChar    * in,
                                 ConstSpiceChar    * out,
@@ -1386,6 +1434,9 @@ Include Files:
                                 SpiceInt            ic  []  );
 
 
+   void              dafwbs_c ( SpiceInt            nrec );
+
+
    void              dasac_c  ( SpiceInt            handle,
                                 SpiceInt            n,
                                 SpiceInt            buflen,
@@ -2100,6 +2151,34 @@ Include Files:
                                 SpiceInt          * handle );
 
 
+   void              ekpbdc_c ( SpiceInt            qryhan,
+                                SpiceInt            parm,
+                                ConstSpiceChar    * value  );
+
+
+   void              ekpbdd_c ( SpiceInt            qryhan,
+                                SpiceInt            parm,
+                                SpiceDouble         value  );
+
+
+   void              ekpcls_c ( SpiceInt            qryhan );
+
+
+   void              ekpfnd_c ( SpiceInt            qryhan,
+                                SpiceInt            errmln,
+                                SpiceInt          * nmrows,
+                                SpiceBoolean      * error,
+                                SpiceChar         * errmsg );
+
+
+   void              ekpqry_c ( ConstSpiceChar    * query,
+                                SpiceInt            errmln,
+                                SpiceInt          * qryhan,
+                                SpiceInt          * nparms,
+                                SpiceBoolean      * error,
+                                SpiceChar         * errmsg );
+
+
    void              ekpsel_c ( ConstSpiceChar    * query,
                                 SpiceInt            msglen,
                                 SpiceInt            tablen,
@@ -3649,6 +3728,13 @@ Include Files:
                                 SpiceDouble         pvprop[6] );
 
 
+   void              prop2v_c ( SpiceDouble         gm,
+                                SpiceInt            n,
+                                ConstSpiceDouble    pvinit [],
+                                SpiceDouble         dt,
+                                SpiceDouble         pvprop [] );
+
+
    void              prsdp_c  ( ConstSpiceChar    * string,
                                 SpiceDouble       * dpval  );
 
@@ -3976,6 +4062,19 @@ Include Files:
    void              setmsg_c ( ConstSpiceChar    * msg );
 
 
+   void              sgp4ev_c ( SpiceInt            n,
+                                ConstSpiceDouble    recs   [][SPICE_SGP4_RECLEN],
+                                SpiceInt            nep,
+                                ConstSpiceDouble    ets    [],
+                                SpiceDouble         states [][6] );
+
+
+   void              sgp4in_c ( ConstSpiceDouble    geophs [8],
+                                SpiceInt            n,
+                                ConstSpiceDouble    elems  [][10],
+                                SpiceDouble         recs   [][SPICE_SGP4_RECLEN] );
+
+
    void              shellc_c ( SpiceInt            ndim,
                                 SpiceInt            lenvals,
                                 void              * array   );
@@ -4759,6 +4858,9 @@ Include Files:
    void              trcdep_c ( SpiceInt          * depth );
 
 
+   void              trcmod_c ( ConstSpiceChar    * mode );
+
+
    void              trcnam_c ( SpiceInt            index,
                                 SpiceInt            namelen,
                                 SpiceChar         * name     );
@@ -0,0 +1,171 @@
+/*
+
+-Procedure bodctr_c ( Body name-code mapping state counter )
+
+-Abstract
+
+   Determine whether the body name-code mappings have changed since a
+   caller last checked.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   NAIF_IDS
+
+-Keywords
+
+   BODY
+   CONVERSION
+   ID
+   NAME
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+   void bodctr_c ( SpiceInt          ctr    [2],
+                   SpiceBoolean    * update     )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   ctr       I-O  The caller's copy of the state counter.
+   update     O   SPICETRUE if the mappings have changed.
+
+-Detailed_Input
+
+   ctr         is the caller's copy of the state counter of the body
+               name-code mappings, as returned by a previous call to
+               this routine.
+
+               Before the first call, both elements of `ctr' should be
+               set to intmax_c(). This value is never taken by the
+               state counter, so the first call always reports an
+               update.
+
+-Detailed_Output
+
+   ctr         is the current value of the state counter.
+
+   update      is SPICETRUE if the state counter differed from `ctr'
+               on input, that is, if the name-code mappings may have
+               changed since `ctr' was last returned by this routine.
+               Otherwise `update' is SPICEFALSE.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If an error occurs while the name-code mappings are updated
+       from the kernel pool, the error is signaled by a routine in the
+       call tree of this routine.
+
+-Files
+
+   None.
+
+-Particulars
+
+   The state counter changes whenever the name-code mappings are
+   changed by boddef_c, or whenever the kernel pool variables
+   NAIF_BODY_NAME or NAIF_BODY_CODE are assigned or deleted.
+
+   Applications that translate the same names repeatedly can keep
+   their own table of translations and discard it whenever this
+   routine reports an update.
+
+-Examples
+
+   1)    /.
+         Discard cached translations if the mappings have changed.
+         ./
+         SpiceInt                ctr [2] = { 0, 0 };
+         SpiceBoolean            update;
+
+         ctr[0] = intmax_c();
+         ctr[1] = intmax_c();
+               .
+               .
+               .
+         bodctr_c ( ctr, &update );
+
+         if ( update )
+         {
+            /.
+            Clear the cached translations.
+            ./
+         }
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0, 16-OCT-2026
+
+-Index_Entries
+
+   check for changes to body name-code mappings
+
+-&
+*/
+
+{ /* Begin bodctr_c */
+
+   /*
+   Local variables
+   */
+   integer                 usrctr [2];
+   logical                 upd;
+
+
+   usrctr[0] = ctr[0];
+   usrctr[1] = ctr[1];
+
+   zzbctrck_ ( usrctr, &upd );
+
+   ctr[0]  = usrctr[0];
+   ctr[1]  = usrctr[1];
+   *update = upd;
+
+
+} /* End bodctr_c */
@@ -24,6 +24,7 @@
 	    char *, ftnlen), chkout_(char *, ftnlen), setmsg_(char *, ftnlen),
 	     errint_(char *, integer *, ftnlen);
     extern logical return_(void);
+    extern logical zzdafgbf_(integer *, integer *, integer *, doublereal *);
 
 /* $ Abstract */
 
@@ -263,6 +264,11 @@
 
 /* $ Version */
 
+/* -    SPICELIB Version 1.2.0, 16-OCT-2026 */
+
+/*        Data still held in the write buffer of DAFANA are now */
+/*        returned from memory. */
+
 /* -    SPICELIB Version 1.1.0, 13-AUG-2021 (JDR) */
 
 /*        Changed the input argument names BEGIN and END to BADDR to */
@@ -314,6 +320,13 @@
 	return 0;
     }
 
+/*     Data added to a new array may still be in DAFANA's write */
+/*     buffer. */
+
+    if (zzdafgbf_(handle, baddr, eaddr, data)) {
+	return 0;
+    }
+
 /*     Convert raw addresses to record/word representations. */
 
     dafarw_(baddr, &begr, &begw);
@@ -28,6 +28,7 @@
 	    ftnlen), setmsg_(char *, ftnlen), errint_(char *, integer *, 
 	    ftnlen);
     extern logical return_(void);
+    extern logical zzdafgbf_(integer *, integer *, integer *, doublereal *);
 
 /* $ Abstract */
 
@@ -174,6 +175,11 @@
 
 /* $ Version */
 
+/* -    SPICELIB Version 2.2.0, 16-OCT-2026 */
+
+/*        Data still held in the write buffer of DAFANA are now */
+/*        returned from memory. */
+
 /* -    SPICELIB Version 2.1.0, 26-OCT-2021 (JDR) */
 
 /*        Added IMPLICIT NONE statement. */
@@ -289,6 +295,13 @@
 	return 0;
     }
 
+/*     Data added to a new array may still be in DAFANA's write */
+/*     buffer. */
+
+    if (zzdafgbf_(handle, begin, end, data)) {
+	return 0;
+    }
+
 /*     Convert raw addresses to record/word representations. */
 
     dafarw_(begin, &begr, &begw);
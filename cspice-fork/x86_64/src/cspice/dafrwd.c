@@ -647,6 +647,8 @@ static integer c__128 = 128;
     extern /* Subroutine */ int sigerr_(char *, ftnlen), chkout_(char *, 
 	    ftnlen);
     extern integer intmax_(void);
+    extern integer zzdafwrn_(integer *, integer *, integer *, char *);
+    extern /* Subroutine */ int dafwdr_(integer *, integer *, doublereal *);
     logical stored;
     integer iostat;
     extern /* Subroutine */ int setmsg_(char *, ftnlen), errint_(char *, 
@@ -778,6 +780,8 @@ static integer c__128 = 128;
 
 /*        DAFWDR         Write double precision record. */
 
+/*        DAFWDN         Write consecutive double precision records. */
+
 /*        DAFNRR         Number of reads, requests. */
 
 /*     DAFGDR, DAFGSR, and DAFWDR are the only approved means for */
@@ -832,6 +836,11 @@ static integer c__128 = 128;
 
 /* $ Version */
 
+/* -    SPICELIB Version 2.2.0, 16-OCT-2026 */
+
+/*        Added entry point DAFWDN, which writes a run of consecutive */
+/*        records with a single write. */
+
 /* -    SPICELIB Version 2.1.0, 12-AUG-2021 (NJB) (JDR) */
 
 /*        Bug fixes: now NREAD is not incremented once it reaches */
@@ -950,6 +959,7 @@ static integer c__128 = 128;
 	case 3: goto L_dafrdr;
 	case 4: goto L_dafwdr;
 	case 5: goto L_dafnrr;
+	case 6: goto L_dafwdn;
 	}
 
 
@@ -2353,6 +2363,154 @@ L_dafnrr:
     *reads = nread;
     *reqs = nreq;
     return 0;
+/* $Procedure DAFWDN ( DAF, write consecutive d.p. records ) */
+
+L_dafwdn:
+/* $ Abstract */
+
+/*     Write or rewrite the contents of a run of consecutive double */
+/*     precision records in a DAF. */
+
+/* $ Required_Reading */
+
+/*     DAF */
+
+/* $ Keywords */
+
+/*     FILES */
+
+/* $ Declarations */
+
+/*     INTEGER               HANDLE */
+/*     INTEGER               RECNO */
+/*     INTEGER               NREC */
+/*     DOUBLE PRECISION      DRECS  ( 128, NREC ) */
+
+/* $ Brief_I/O */
+
+/*     VARIABLE  I/O  DESCRIPTION */
+/*     --------  ---  -------------------------------------------------- */
+/*     HANDLE     I   Handle of DAF. */
+/*     RECNO      I   Number of the first record to write. */
+/*     NREC       I   Number of records. */
+/*     DRECS      I   Contents of the records. */
+
+/* $ Detailed_Input */
+
+/*     HANDLE   is the handle associated with a DAF open for writing. */
+
+/*     RECNO    is the record number of the first double precision */
+/*              record to be written. */
+
+/*     NREC     is the number of records to write. If NREC is less */
+/*              than one, nothing is written. */
+
+/*     DRECS    contains the records, one after another. */
+
+/* $ Detailed_Output */
+
+/*     None. */
+
+/* $ Parameters */
+
+/*     None. */
+
+/* $ Exceptions */
+
+/*     1)  If the file is not open for write access, the error */
+/*         SPICE(DAFILLEGWRITE) is signaled. */
+
+/*     2)  If the records cannot be written, the error */
+/*         SPICE(DAFDPWRITEFAIL) is signaled by DAFWDR. */
+
+/* $ Files */
+
+/*     See argument HANDLE. */
+
+/* $ Particulars */
+
+/*     The records are written exactly as NREC calls to DAFWDR would */
+/*     write them, but with a single write to the file, so that writers */
+/*     of large arrays are not limited by the cost of one I/O call per */
+/*     record. Buffered copies of the records are updated. */
+
+/*     If the single write cannot be done, for example because the I/O */
+/*     library has not yet opened the file for writing, the records are */
+/*     written one at a time by DAFWDR. */
+
+/* $ Examples */
+
+/*     None. */
+
+/* $ Restrictions */
+
+/*     None. */
+
+/* $ Literature_References */
+
+/*     None. */
+
+/* $ Author_and_Institution */
+
+/*     None. */
+
+/* $ Version */
+
+/* -    SPICELIB Version 1.0.0, 16-OCT-2026 */
+
+/* -& */
+/* $ Index_Entries */
+
+/*     write consecutive DAF d.p. records */
+
+/* -& */
+
+/*     Standard SPICE error handling. */
+
+    if (return_()) {
+	return 0;
+    } else {
+	chkin_("DAFWDN", (ftnlen)6);
+    }
+    if (*handle >= 0) {
+	setmsg_("Attempt was made to write to a read-only file.", (ftnlen)46);
+	sigerr_("SPICE(DAFILLEGWRITE)", (ftnlen)20);
+	chkout_("DAFWDN", (ftnlen)6);
+	return 0;
+    }
+    if (*begin < 1) {
+	chkout_("DAFWDN", (ftnlen)6);
+	return 0;
+    }
+    zzddhhlu_(handle, "DAF", &c_false, &unit, (ftnlen)3);
+    if (failed_()) {
+	chkout_("DAFWDN", (ftnlen)6);
+	return 0;
+    }
+    {
+	integer nw, j, k;
+
+/*        Records the single write did not complete are written one */
+/*        at a time, which also reports any write failure. */
+
+	nw = zzdafwrn_(&unit, recno, begin, (char *)drec);
+	for (j = nw; j < *begin && ! failed_(); ++j) {
+	    k = *recno + j;
+	    dafwdr_(handle, &k, &drec[j << 7]);
+	}
+
+/*        Bring buffered copies of the records written in bulk up to */
+/*        date. */
+
+	for (k = 0; k < 100; ++k) {
+	    j = rbrec[k] - *recno;
+	    if (rbhan[k] == *handle && j >= 0 && j < nw) {
+		moved_(&drec[j << 7], &c__128, &rbdat[k << 7]);
+	    }
+	}
+    }
+    chkout_("DAFWDN", (ftnlen)6);
+    return 0;
 } /* dafrwd_ */
 
 /* Subroutine */ int dafrwd_(integer *handle, integer *recno, integer *begin, 
@@ -2391,6 +2549,13 @@ L_dafnrr:
 	    doublereal *)0, (logical *)0, (integer *)0, (integer *)0);
     }
 
+/* Subroutine */ int dafwdn_(integer *handle, integer *recno, integer *nrec, 
+	doublereal *drecs)
+{
+    return dafrwd_0_(6, handle, recno, nrec, (integer *)0, drecs, (
+	    doublereal *)0, (logical *)0, (integer *)0, (integer *)0);
+    }
+
 /* Subroutine */ int dafnrr_(integer *reads, integer *reqs)
 {
     return dafrwd_0_(5, (integer *)0, (integer *)0, (integer *)0, (integer *)
@@ -0,0 +1,162 @@
+/*
+
+-Procedure dafwbs_c ( DAF, set write buffer size )
+
+-Abstract
+
+   Set the size of the buffer in which the data of each new DAF array
+   are collected before they are written to the file.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   DAF
+
+-Keywords
+
+   DAF
+   FILES
+
+*/
+
+   #include "SpiceUsr.h"
+   #include "SpiceZfc.h"
+
+   void dafwbs_c ( SpiceInt nrec )
+
+/*
+
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   nrec       I   Buffer size, in records.
+
+-Detailed_Input
+
+   nrec        is the number of 1024-byte records of data that may be
+               held in memory for each DAF array being written. Zero,
+               the default, disables buffering.
+
+-Detailed_Output
+
+   None.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   1)  If `nrec' is negative, or greater than intmax_c()/128, so
+       that the number of double precision numbers a buffer holds
+       could not be represented as an integer, the error
+       SPICE(VALUEOUTOFRANGE) is signaled by a routine in the call
+       tree of this routine.
+
+-Files
+
+   None.
+
+-Particulars
+
+   SPK, CK and PCK segment writers add the data of each segment to
+   the file through the DAF "add new array" routines, often a few
+   numbers at a time. Without a buffer, every addition reads and
+   rewrites the file records it touches, so writing a segment of
+   many millions of records is limited by the number of I/O calls.
+
+   With a buffer of `nrec' records, the data of each array are
+   collected in memory and written in runs of up to `nrec' records,
+   each with a single write. Reads of the array's data by address,
+   such as those the generic segment writers make while finishing a
+   segment, are answered from the buffer. The remaining data are written when the
+   array is ended, just before its summary, so an array is never
+   visible in the file before all of its data have been written.
+
+   Each array being written has its own buffer, allocated when data
+   are first added to it. If the memory cannot be allocated, data are
+   written directly, as if `nrec' were zero. A new size applies to
+   each buffer the next time it is empty.
+
+-Examples
+
+   1) Write a large CK segment with a 1 MiB buffer.
+
+      #include "SpiceUsr.h"
+          .
+          .
+          .
+      dafwbs_c ( 1024 );
+
+      ckopn_c  ( fname, "reconstructed attitude", 0, &handle );
+      ckw03_c  ( handle, begtim, endtim, inst, ref, avflag, segid,
+                 nrec,   sclkdp, quats,  avvs, nints,  starts     );
+      ckcls_c  ( handle );
+
+-Restrictions
+
+   1)  dafgda_c and dafrda_c return data still held in a buffer,
+       but record-level reads, such as those of dafgdr_c, do not see
+       them until they are written. Applications that read back the
+       records of an array before ending it must not enable
+       buffering.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0, 16-OCT-2026
+
+-Index_Entries
+
+   set DAF write buffer size
+
+-&
+*/
+
+{ /* Begin dafwbs_c */
+
+
+   /*
+   Participate in error tracing.
+   */
+   chkin_c ( "dafwbs_c" );
+
+
+   dafwbs_ ( ( integer * ) &nrec );
+
+
+   chkout_c ( "dafwbs_c" );
+
+} /* End dafwbs_c */
@@ -3,17 +3,185 @@
 	-lf2c -lm   (in that order)
 */
 
+#include <string.h>
 #include "f2c.h"
 
+/* DASBSZ is the number of records in each of the record buffers. */
+/* It may be changed by defining DASBSZ when compiling this file. */
+/* DASHSZ is the size of the hash tables used to locate buffered */
+/* records. */
+
+#ifndef DASBSZ
+#define DASBSZ 64
+#endif
+#define DASHSZ (DASBSZ * 2 + 1)
+
 /* Table of constant values */
 
-static integer c__10 = 10;
+static integer c__bsz = DASBSZ;
 static integer c__1 = 1;
 static integer c__128 = 128;
 static logical c_false = FALSE_;
 static integer c__256 = 256;
 static integer c__1024 = 1024;
 
+/* RAHSZ is the maximum number of records read ahead at once. */
+
+#define RAHSZ 32
+
+/* Read-ahead windows, one for each data type: character, double */
+/* precision and integer. RAHHAN, RAHFST and RAHN are the handle, */
+/* first record number and number of records of each window; */
+/* LSTHAN and LSTREC designate the last record of each type read */
+/* from a file. */
+
+static integer rahhan[3] = { 0,0,0 };
+static integer rahfst[3] = { 0,0,0 };
+static integer rahn[3] = { 0,0,0 };
+static integer lsthan[3] = { 0,0,0 };
+static integer lstrec[3] = { 0,0,0 };
+static char rahbuf[3 * RAHSZ * 1024];
+
+static integer zzdasbhs(integer handle, integer recno)
+{
+    return (integer) (((unsigned long) handle * 31UL + (unsigned long) recno)
+	     % DASHSZ);
+}
+
+/* Return the buffer entry containing record RECNO of the file */
+/* designated by HANDLE, or zero if the record is not buffered. */
+
+static integer zzdasbfd(integer *hshtab, integer *hshnxt, integer *hnbuf, 
+	integer *rnbuf, integer handle, integer recno)
+{
+    integer node;
+
+    node = hshtab[zzdasbhs(handle, recno)];
+    while(node > 0) {
+	if (hnbuf[node - 1] == handle && rnbuf[node - 1] == recno) {
+	    return node;
+	}
+	node = hshnxt[node - 1];
+    }
+    return 0;
+}
+
+/* Add buffer entry NODE to the hash table. The handle and record */
+/* number of the entry must already be set. */
+
+static void zzdasbin(integer *hshtab, integer *hshnxt, integer *hnbuf, 
+	integer *rnbuf, integer node)
+{
+    integer h__;
+
+    h__ = zzdasbhs(hnbuf[node - 1], rnbuf[node - 1]);
+    hshnxt[node - 1] = hshtab[h__];
+    hshtab[h__] = node;
+}
+
+/* Remove buffer entry NODE from the hash table, if it is present. */
+
+static void zzdasbrm(integer *hshtab, integer *hshnxt, integer *hnbuf, 
+	integer *rnbuf, integer node)
+{
+    integer h__, prev, this__;
+
+    h__ = zzdasbhs(hnbuf[node - 1], rnbuf[node - 1]);
+    prev = 0;
+    this__ = hshtab[h__];
+    while(this__ > 0 && this__ != node) {
+	prev = this__;
+	this__ = hshnxt[this__ - 1];
+    }
+    if (this__ == 0) {
+	return;
+    }
+    if (prev == 0) {
+	hshtab[h__] = hshnxt[node - 1];
+    } else {
+	hshnxt[prev - 1] = hshnxt[node - 1];
+    }
+}
+
+/* Obtain record RECNO of the file designated by HANDLE from the */
+/* read-ahead window for data type TYPE (0 for character, 1 for */
+/* double precision, 2 for integer), and place its contents in */
+/* RECORD. */
+
+/* If the record is not in the window but directly follows the last */
+/* record of this type read from the file, the file is read-only and */
+/* has native binary format, the window is refilled with up to RAHSZ */
+/* records starting at RECNO, using a single read. */
+
+/* The return value is TRUE if the record was supplied or an error */
+/* was signaled, and FALSE if the caller must read the record. */
+
+static logical zzdasrah(integer *handle, integer *recno, integer type, 
+	char *record)
+{
+    static integer natbff = 0;
+    static logical first = TRUE_;
+
+    integer i__, n, unit, intarc, intbff, intamh;
+    logical found, seqntl;
+    char access[5], fname[255];
+    static integer c_rahsz = RAHSZ;
+
+    extern /* Subroutine */ int dasham_(integer *, char *, ftnlen), 
+	    zzddhnfo_(integer *, char *, integer *, integer *, integer *, 
+	    logical *, ftnlen), zzddhnfc_(integer *), zzddhhlu_(integer *, 
+	    char *, logical *, integer *, ftnlen);
+    extern integer zzdasrdn_(integer *, integer *, integer *, char *);
+    extern logical failed_(void);
+
+    i__ = *recno - rahfst[type];
+    seqntl = *handle == lsthan[type] && *recno == lstrec[type] + 1;
+    lsthan[type] = *handle;
+    lstrec[type] = *recno;
+    if (*handle == rahhan[type] && i__ >= 0 && i__ < rahn[type]) {
+	memcpy(record, rahbuf + ((type * RAHSZ + i__) << 10), (size_t) 1024);
+	return TRUE_;
+    }
+    if (! seqntl) {
+	return FALSE_;
+    }
+    dasham_(handle, access, (ftnlen)5);
+    if (failed_()) {
+	return TRUE_;
+    }
+    if (strncmp(access, "READ ", (size_t) 5) != 0) {
+	return FALSE_;
+    }
+    if (first) {
+	zzddhnfc_(&natbff);
+	if (failed_()) {
+	    return TRUE_;
+	}
+	first = FALSE_;
+    }
+    zzddhnfo_(handle, fname, &intarc, &intbff, &intamh, &found, (ftnlen)255);
+    if (failed_()) {
+	return TRUE_;
+    }
+    if (! found || intbff != natbff) {
+	return FALSE_;
+    }
+    zzddhhlu_(handle, "DAS", &c_false, &unit, (ftnlen)3);
+    if (failed_()) {
+	return TRUE_;
+    }
+    n = zzdasrdn_(&unit, recno, &c_rahsz, rahbuf + ((type * RAHSZ) << 10));
+    if (n < 1) {
+	rahn[type] = 0;
+	return FALSE_;
+    }
+    rahhan[type] = *handle;
+    rahfst[type] = *recno;
+    rahn[type] = n;
+    memcpy(record, rahbuf + ((type * RAHSZ) << 10), (size_t) 1024);
+    return TRUE_;
+}
+
 /* $Procedure DASRWR ( DAS, read/write records ) */
 /* Subroutine */ int dasrwr_0_(int n__, integer *handle, integer *recno, char 
 	*recc, doublereal *recd, integer *reci, integer *first, integer *last,
@@ -23,16 +191,13 @@ static integer c__1024 = 1024;
     /* Initialized data */
 
     static logical pass1 = TRUE_;
-    static integer rnbufi[10] = { 0,0,0,0,0,0,0,0,0,0 };
-    static integer hnbufc[10] = { 0,0,0,0,0,0,0,0,0,0 };
-    static integer hnbufd[10] = { 0,0,0,0,0,0,0,0,0,0 };
-    static integer hnbufi[10] = { 0,0,0,0,0,0,0,0,0,0 };
-    static logical upbufc[10] = { FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,
-	    FALSE_,FALSE_,FALSE_,FALSE_ };
-    static logical upbufd[10] = { FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,
-	    FALSE_,FALSE_,FALSE_,FALSE_ };
-    static logical upbufi[10] = { FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,FALSE_,
-	    FALSE_,FALSE_,FALSE_,FALSE_ };
+    static integer rnbufi[DASBSZ];
+    static integer hnbufc[DASBSZ];
+    static integer hnbufd[DASBSZ];
+    static integer hnbufi[DASBSZ];
+    static logical upbufc[DASBSZ];
+    static logical upbufd[DASBSZ];
+    static logical upbufi[DASBSZ];
     static integer headc = 0;
     static integer headd = 0;
     static integer headi = 0;
@@ -41,308 +206,11 @@ static integer c__1024 = 1024;
     static integer wrunit = -1;
     static integer usedd = 0;
     static integer usedi = 0;
-    static char rcbufc[1024*10] = "                                         "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                       " "                                      "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                          " "                                   "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                             " "                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                " "                             "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                   " "                          "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                      " "                       "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                         " "                    "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                            " "                 "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                               " "              "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                                "
-	    "                                                  ";
-    static doublereal rcbufd[1280]	/* was [128][10] */ = { 0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,
-	    0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0.,0. 
-	    };
-    static integer rcbufi[2560]	/* was [256][10] */ = { 0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-	    0,0,0,0,0,0,0,0 };
-    static integer rnbufc[10] = { 0,0,0,0,0,0,0,0,0,0 };
-    static integer rnbufd[10] = { 0,0,0,0,0,0,0,0,0,0 };
+    static char rcbufc[1024*DASBSZ];
+    static doublereal rcbufd[DASBSZ << 7]	/* was [128][DASBSZ] */;
+    static integer rcbufi[DASBSZ << 8]	/* was [256][DASBSZ] */;
+    static integer rnbufc[DASBSZ];
+    static integer rnbufd[DASBSZ];
 
     /* System generated locals */
     integer i__1, i__2;
@@ -358,10 +226,12 @@ static integer c__1024 = 1024;
 	    zzdasgri_(integer *, integer *, integer *), chkin_(char *, ftnlen)
 	    , lnkan_(integer *, integer *), moved_(doublereal *, integer *, 
 	    doublereal *);
-    static integer poolc[32]	/* was [2][16] */, poold[32]	/* was [2][16]
-	     */;
+    static integer poolc[(DASBSZ + 6) * 2]	/* was [2][DASBSZ + 6] */, 
+	    poold[(DASBSZ + 6) * 2]	/* was [2][DASBSZ + 6] */;
     extern /* Subroutine */ int movei_(integer *, integer *, integer *);
-    static integer pooli[32]	/* was [2][16] */;
+    static integer pooli[(DASBSZ + 6) * 2]	/* was [2][DASBSZ + 6] */;
+    static integer hshc[DASHSZ], hshd[DASHSZ], hshi[DASHSZ], hnxc[DASBSZ], 
+	    hnxd[DASBSZ], hnxi[DASBSZ];
     extern integer lnktl_(integer *, integer *);
     extern logical failed_(void);
     extern /* Subroutine */ int dasioc_(char *, integer *, integer *, char *, 
@@ -459,7 +329,12 @@ static integer c__1024 = 1024;
 /*     BUFSZI, */
 /*     BUFSZC   are, respectively, the number of records in the */
 /*              data buffers for double precision, integer, and */
-/*              character records. */
+/*              character records. In this implementation all three */
+/*              are given by DASBSZ, which defaults to 64 and may be */
+/*              set when this file is compiled. */
+
+/*     RAHSZ    is the maximum number of records read ahead when */
+/*              records of one type are read sequentially. */
 
 /* $ Exceptions */
 
@@ -543,6 +418,19 @@ static integer c__1024 = 1024;
 /*           application. In some cases, increasing the buffer sizes */
 /*           may slow the application down. */
 
+/*     Buffered records are located through a hash table keyed by */
+/*     handle and record number, so the cost of a lookup does not grow */
+/*     with the buffer size. */
+
+/*     When the DASRRx entry points read consecutive records of one */
+/*     type from a file that is open for read access and has native */
+/*     binary format, up to RAHSZ following records are read from the */
+/*     file at once and held in a read-ahead window for that type. */
+/*     Subsequent reads of those records are satisfied from the window */
+/*     rather than from the file. Files open for write access are never */
+/*     read ahead, since their buffered records may differ from the */
+/*     records in the file. */
+
 /* $ Examples */
 
 /*     See the entry points for examples specific to those routines. */
@@ -565,6 +453,13 @@ static integer c__1024 = 1024;
 
 /* $ Version */
 
+/* -    SPICELIB Version 3.0.0, 16-OCT-2026 */
+
+/*        The record buffers now hold DASBSZ records each, and buffered */
+/*        records are located through hash tables. Sequential reads */
+/*        from read-only native files are served from read-ahead */
+/*        windows filled by ZZDASRDN. */
+
 /* -    SPICELIB Version 2.1.0, 07-OCT-2021 (NJB) (JDR) */
 
 /*        Added initializers for record buffers. */
@@ -934,9 +829,9 @@ L_dasrrd:
 /*     If it hasn't been done yet, initialize the pointer list pools. */
 
     if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
+	lnkini_(&c__bsz, poold);
+	lnkini_(&c__bsz, pooli);
+	lnkini_(&c__bsz, poolc);
 	pass1 = FALSE_;
     }
 
@@ -966,45 +861,38 @@ L_dasrrd:
     }
 
 /*     See whether record number RECNO in file HANDLE is buffered.  We'll */
-/*     search through the list of buffered records starting at the head */
-/*     of the list.  If we find the desired record, transfer the */
+/*     look the record up in the hash table of buffered records.  If we */
+/*     find the desired record, transfer the */
 /*     requested data to the array DATAD and return without further ado. */
 
-    node = headd;
-    while(node > 0) {
-	if (*handle == hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)737)] && *recno == 
-		rnbufd[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufd", i__2, "dasrwr_", (ftnlen)737)]) {
+    node = zzdasbfd(hshd, hnxd, hnbufd, rnbufd, *handle, *recno);
+    if (node > 0) {
 
 /*           Found it.  Move this record to the head of the list. */
 /*           Update our head pointer as required. */
 
-	    if (node != headd) {
-		lnkxsl_(&node, &node, poold);
-		lnkilb_(&node, &headd, poold);
-		headd = node;
-	    }
+	if (node != headd) {
+	    lnkxsl_(&node, &node, poold);
+	    lnkilb_(&node, &headd, poold);
+	    headd = node;
+	}
 
 /*           Don't forget to return the requested data. */
 
-	    if (*first == *last) {
-		datad[0] = rcbufd[(i__1 = *first + (node << 7) - 129) < 1280 
-			&& 0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_"
-			, (ftnlen)757)];
-	    } else {
-		i__2 = *last - *first + 1;
-		moved_(&rcbufd[(i__1 = *first + (node << 7) - 129) < 1280 && 
-			0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (
-			ftnlen)761)], &i__2, datad);
-	    }
+	if (*first == *last) {
+	    datad[0] = rcbufd[(i__1 = *first + (node << 7) - 129) < DASBSZ << 7 
+		    && 0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_"
+		    , (ftnlen)757)];
+	} else {
+	    i__2 = *last - *first + 1;
+	    moved_(&rcbufd[(i__1 = *first + (node << 7) - 129) < DASBSZ << 7 && 
+		    0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (
+		    ftnlen)761)], &i__2, datad);
+	}
 
 /*           We haven't checked in, so don't check out. */
 
-	    return 0;
-	}
-	node = poold[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poold", i__1, "dasrwr_", (ftnlen)772)];
+	return 0;
     }
 
 /*     The record wasn't buffered.  We need to allocate entries to */
@@ -1016,30 +904,32 @@ L_dasrrd:
 /*     us down much to check in, comparatively speaking. */
 
     chkin_("DASRRD", (ftnlen)6);
-    if (usedd == 10) {
+    if (usedd == DASBSZ) {
 
 /*        Grab the buffer entry at the tail end of the list. */
 
 	node = lnktl_(&headd, poold);
 	lnkxsl_(&node, &node, poold);
 
+	zzdasbrm(hshd, hnxd, hnbufd, rnbufd, node);
+
 /*        If the allocated buffer entry was updated, write it out. */
 
-	if (upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
+	if (upbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
 		"fd", i__1, "dasrwr_", (ftnlen)798)]) {
 
 /*           We'll need a logical unit in order to write to the file. */
 
-	    zzddhhlu_(&hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	    zzddhhlu_(&hnbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		    s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)802)], "DAS", &
 		    c_false, &wrunit, (ftnlen)3);
 	    if (failed_()) {
 		chkout_("DASRRD", (ftnlen)6);
 		return 0;
 	    }
-	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < 10 && 0 <= 
+	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufd", i__1, "dasrwr_", (ftnlen)
-		    809)], &rcbufd[(i__2 = (node << 7) - 128) < 1280 && 0 <= 
+		    809)], &rcbufd[(i__2 = (node << 7) - 128) < DASBSZ << 7 && 0 <= 
 		    i__2 ? i__2 : s_rnge("rcbufd", i__2, "dasrwr_", (ftnlen)
 		    809)], (ftnlen)5);
 	    if (failed_()) {
@@ -1056,10 +946,12 @@ L_dasrrd:
 	++usedd;
     }
 
-/*     Try to read the record. */
+/*     Try to read the record, from the read-ahead window if possible. */
 
-    zzdasgrd_(handle, recno, &rcbufd[(i__1 = (node << 7) - 128) < 1280 && 0 <=
-	     i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (ftnlen)835)]);
+    i__1 = (node << 7) - 128;
+    if (! zzdasrah(handle, recno, 1, (char *) &rcbufd[i__1])) {
+	zzdasgrd_(handle, recno, &rcbufd[i__1]);
+    }
     if (failed_()) {
 	chkout_("DASRRD", (ftnlen)6);
 	return 0;
@@ -1073,18 +965,19 @@ L_dasrrd:
 /*     this record. */
 
     lnkilb_(&node, &headd, poold);
-    hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufd", i__1,
+    hnbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("hnbufd", i__1,
 	     "dasrwr_", (ftnlen)852)] = *handle;
-    rnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufd", i__1,
+    rnbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("rnbufd", i__1,
 	     "dasrwr_", (ftnlen)853)] = *recno;
-    upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufd", i__1,
+    zzdasbin(hshd, hnxd, hnbufd, rnbufd, node);
+    upbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbufd", i__1,
 	     "dasrwr_", (ftnlen)854)] = FALSE_;
     headd = node;
 
 /*     Don't forget to return the requested data. */
 
     i__2 = *last - *first + 1;
-    moved_(&rcbufd[(i__1 = *first + (node << 7) - 129) < 1280 && 0 <= i__1 ? 
+    moved_(&rcbufd[(i__1 = *first + (node << 7) - 129) < DASBSZ << 7 && 0 <= i__1 ? 
 	    i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (ftnlen)860)], &i__2, 
 	    datad);
     chkout_("DASRRD", (ftnlen)6);
@@ -1307,9 +1200,9 @@ L_dasrri:
 /*     If it hasn't been done yet, initialize the pointer list pools. */
 
     if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
+	lnkini_(&c__bsz, poold);
+	lnkini_(&c__bsz, pooli);
+	lnkini_(&c__bsz, poolc);
 	pass1 = FALSE_;
     }
 
@@ -1339,46 +1232,39 @@ L_dasrri:
     }
 
 /*     See whether record number RECNO in file HANDLE is buffered.  We'll */
-/*     search through the list of buffered records starting at the head */
-/*     of the list.  If we find the desired record, transfer the */
+/*     look the record up in the hash table of buffered records.  If we */
+/*     find the desired record, transfer the */
 /*     requested data to the array DATAI and return without further ado. */
 
-    node = headi;
-    while(node > 0) {
-	if (*handle == hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)1149)] && *recno == 
-		rnbufi[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufi", i__2, "dasrwr_", (ftnlen)1149)]) {
+    node = zzdasbfd(hshi, hnxi, hnbufi, rnbufi, *handle, *recno);
+    if (node > 0) {
 
 
 /*           Found it.  Move this record to the head of the list. */
 /*           Update our head pointer as required. */
 
-	    if (node != headi) {
-		lnkxsl_(&node, &node, pooli);
-		lnkilb_(&node, &headi, pooli);
-		headi = node;
-	    }
+	if (node != headi) {
+	    lnkxsl_(&node, &node, pooli);
+	    lnkilb_(&node, &headi, pooli);
+	    headi = node;
+	}
 
 /*           Don't forget to return the requested data. */
 
-	    if (*first == *last) {
-		datai[0] = rcbufi[(i__1 = *first + (node << 8) - 257) < 2560 
-			&& 0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_"
-			, (ftnlen)1170)];
-	    } else {
-		i__2 = *last - *first + 1;
-		movei_(&rcbufi[(i__1 = *first + (node << 8) - 257) < 2560 && 
-			0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (
-			ftnlen)1174)], &i__2, datai);
-	    }
+	if (*first == *last) {
+	    datai[0] = rcbufi[(i__1 = *first + (node << 8) - 257) < DASBSZ << 8 
+		    && 0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_"
+		    , (ftnlen)1170)];
+	} else {
+	    i__2 = *last - *first + 1;
+	    movei_(&rcbufi[(i__1 = *first + (node << 8) - 257) < DASBSZ << 8 && 
+		    0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (
+		    ftnlen)1174)], &i__2, datai);
+	}
 
 /*           We haven't checked in, so don't check out. */
 
-	    return 0;
-	}
-	node = pooli[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("pooli", i__1, "dasrwr_", (ftnlen)1185)];
+	return 0;
     }
 
 /*     The record wasn't buffered.  We need to allocate entries to */
@@ -1390,23 +1276,25 @@ L_dasrri:
 /*     us down much to check in, comparatively speaking. */
 
     chkin_("DASRRI", (ftnlen)6);
-    if (usedi == 10) {
+    if (usedi == DASBSZ) {
 
 /*        Grab the buffer entry at the tail end of the list. */
 
 	node = lnktl_(&headi, pooli);
 	lnkxsl_(&node, &node, pooli);
 
+	zzdasbrm(hshi, hnxi, hnbufi, rnbufi, node);
+
 /*        If the allocated buffer entry was updated, write it out. */
 
-	if (upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
+	if (upbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
 		"fi", i__1, "dasrwr_", (ftnlen)1211)]) {
-	    zzddhhlu_(&hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	    zzddhhlu_(&hnbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		    s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)1213)], "DAS", &
 		    c_false, &wrunit, (ftnlen)3);
-	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < 10 && 0 <= 
+	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufi", i__1, "dasrwr_", (ftnlen)
-		    1215)], &rcbufi[(i__2 = (node << 8) - 256) < 2560 && 0 <= 
+		    1215)], &rcbufi[(i__2 = (node << 8) - 256) < DASBSZ << 8 && 0 <= 
 		    i__2 ? i__2 : s_rnge("rcbufi", i__2, "dasrwr_", (ftnlen)
 		    1215)], (ftnlen)5);
 	    if (failed_()) {
@@ -1423,10 +1311,12 @@ L_dasrri:
 	++usedi;
     }
 
-/*     Try to read the record. */
+/*     Try to read the record, from the read-ahead window if possible. */
 
-    zzdasgri_(handle, recno, &rcbufi[(i__1 = (node << 8) - 256) < 2560 && 0 <=
-	     i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (ftnlen)1241)]);
+    i__1 = (node << 8) - 256;
+    if (! zzdasrah(handle, recno, 2, (char *) &rcbufi[i__1])) {
+	zzdasgri_(handle, recno, &rcbufi[i__1]);
+    }
     if (failed_()) {
 	chkout_("DASRRI", (ftnlen)6);
 	return 0;
@@ -1440,18 +1330,19 @@ L_dasrri:
 /*     this record. */
 
     lnkilb_(&node, &headi, pooli);
-    hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufi", i__1,
+    hnbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("hnbufi", i__1,
 	     "dasrwr_", (ftnlen)1258)] = *handle;
-    rnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufi", i__1,
+    rnbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("rnbufi", i__1,
 	     "dasrwr_", (ftnlen)1259)] = *recno;
-    upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufi", i__1,
+    zzdasbin(hshi, hnxi, hnbufi, rnbufi, node);
+    upbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbufi", i__1,
 	     "dasrwr_", (ftnlen)1260)] = FALSE_;
     headi = node;
 
 /*     Don't forget to return the requested data. */
 
     i__2 = *last - *first + 1;
-    movei_(&rcbufi[(i__1 = *first + (node << 8) - 257) < 2560 && 0 <= i__1 ? 
+    movei_(&rcbufi[(i__1 = *first + (node << 8) - 257) < DASBSZ << 8 && 0 <= i__1 ? 
 	    i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (ftnlen)1266)], &i__2, 
 	    datai);
     chkout_("DASRRI", (ftnlen)6);
@@ -1669,9 +1560,9 @@ L_dasrrc:
 /*     If it hasn't been done yet, initialize the pointer list pools. */
 
     if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
+	lnkini_(&c__bsz, poold);
+	lnkini_(&c__bsz, pooli);
+	lnkini_(&c__bsz, poolc);
 	pass1 = FALSE_;
     }
 
@@ -1701,39 +1592,32 @@ L_dasrrc:
     }
 
 /*     See whether record number RECNO in file HANDLE is buffered.  We'll */
-/*     search through the list of buffered records starting at the head */
-/*     of the list.  If we find the desired record, transfer the */
+/*     look the record up in the hash table of buffered records.  If we */
+/*     find the desired record, transfer the */
 /*     requested data to the array DATAC and return without further ado. */
 
-    node = headc;
-    while(node > 0) {
-	if (*handle == hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)1551)] && *recno == 
-		rnbufc[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufc", i__2, "dasrwr_", (ftnlen)1551)]) {
+    node = zzdasbfd(hshc, hnxc, hnbufc, rnbufc, *handle, *recno);
+    if (node > 0) {
 
 
 /*           Found it.  Move this record to the head of the list. */
 /*           Update our head pointer as required. */
 
-	    if (node != headc) {
-		lnkxsl_(&node, &node, poolc);
-		lnkilb_(&node, &headc, poolc);
-		headc = node;
-	    }
+	if (node != headc) {
+	    lnkxsl_(&node, &node, poolc);
+	    lnkilb_(&node, &headc, poolc);
+	    headc = node;
+	}
 
 /*           Don't forget to return the requested data. */
 
-	    s_copy(datac, rcbufc + ((((i__1 = node - 1) < 10 && 0 <= i__1 ? 
-		    i__1 : s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)1570)) <<
-		     10) + (*first - 1)), datac_len, *last - (*first - 1));
+	s_copy(datac, rcbufc + ((((i__1 = node - 1) < DASBSZ && 0 <= i__1 ? 
+		i__1 : s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)1570)) <<
+		 10) + (*first - 1)), datac_len, *last - (*first - 1));
 
 /*           We haven't checked in, so don't check out. */
 
-	    return 0;
-	}
-	node = poolc[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poolc", i__1, "dasrwr_", (ftnlen)1579)];
+	return 0;
     }
 
 /*     The record wasn't buffered.  We need to allocate entries to */
@@ -1745,23 +1629,25 @@ L_dasrrc:
 /*     us down much to check in, comparatively speaking. */
 
     chkin_("DASRRC", (ftnlen)6);
-    if (usedc == 10) {
+    if (usedc == DASBSZ) {
 
 /*        Grab the buffer entry at the tail end of the list. */
 
 	node = lnktl_(&headc, poolc);
 	lnkxsl_(&node, &node, poolc);
 
+	zzdasbrm(hshc, hnxc, hnbufc, rnbufc, node);
+
 /*        If the allocated buffer entry was updated, write it out. */
 
-	if (upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
+	if (upbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
 		"fc", i__1, "dasrwr_", (ftnlen)1605)]) {
-	    zzddhhlu_(&hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	    zzddhhlu_(&hnbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		    s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)1607)], "DAS", &
 		    c_false, &wrunit, (ftnlen)3);
-	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < 10 && 0 <= 
+	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufc", i__1, "dasrwr_", (ftnlen)
-		    1609)], rcbufc + (((i__2 = node - 1) < 10 && 0 <= i__2 ? 
+		    1609)], rcbufc + (((i__2 = node - 1) < DASBSZ && 0 <= i__2 ? 
 		    i__2 : s_rnge("rcbufc", i__2, "dasrwr_", (ftnlen)1609)) <<
 		     10), (ftnlen)5, (ftnlen)1024);
 	    if (failed_()) {
@@ -1778,12 +1664,13 @@ L_dasrrc:
 	++usedc;
     }
 
-/*     Try to read the record. */
+/*     Try to read the record, from the read-ahead window if possible. */
 
     zzddhhlu_(handle, "DAS", &c_false, &unit, (ftnlen)3);
-    dasioc_("READ", &unit, recno, rcbufc + (((i__1 = node - 1) < 10 && 0 <= 
-	    i__1 ? i__1 : s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)1637)) << 
-	    10), (ftnlen)4, (ftnlen)1024);
+    i__1 = (node - 1) << 10;
+    if (! zzdasrah(handle, recno, 0, rcbufc + i__1)) {
+	dasioc_("READ", &unit, recno, rcbufc + i__1, (ftnlen)4, (ftnlen)1024);
+    }
     if (failed_()) {
 	chkout_("DASRRC", (ftnlen)6);
 	return 0;
@@ -1797,17 +1684,18 @@ L_dasrrc:
 /*     this record. */
 
     lnkilb_(&node, &headc, poolc);
-    hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufc", i__1,
+    hnbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("hnbufc", i__1,
 	     "dasrwr_", (ftnlen)1654)] = *handle;
-    rnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufc", i__1,
+    rnbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("rnbufc", i__1,
 	     "dasrwr_", (ftnlen)1655)] = *recno;
-    upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufc", i__1,
+    zzdasbin(hshc, hnxc, hnbufc, rnbufc, node);
+    upbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbufc", i__1,
 	     "dasrwr_", (ftnlen)1656)] = FALSE_;
     headc = node;
 
 /*     Don't forget to return the requested data. */
 
-    s_copy(datac, rcbufc + ((((i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+    s_copy(datac, rcbufc + ((((i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 	    s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)1662)) << 10) + (*first 
 	    - 1)), datac_len, *last - (*first - 1));
     chkout_("DASRRC", (ftnlen)6);
@@ -2025,51 +1913,44 @@ L_daswrd:
 /*     If it hasn't been done yet, initialize the pointer list pools. */
 
     if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
+	lnkini_(&c__bsz, poold);
+	lnkini_(&c__bsz, pooli);
+	lnkini_(&c__bsz, poolc);
 	pass1 = FALSE_;
     }
 
 /*     See whether double precision record number RECNO from file HANDLE */
-/*     is buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
+/*     is buffered.  We'll look the record up in the hash table of */
+/*     buffered records.  If the record is already */
 /*     buffered, we'll update the buffer entry, but we'll defer writing */
 /*     the record out until we need to free a record, or until the */
 /*     d.p. buffer is flushed, whichever comes first. */
 
-    node = headd;
-    while(node > 0) {
-	if (*handle == hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)1917)] && *recno == 
-		rnbufd[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufd", i__2, "dasrwr_", (ftnlen)1917)]) {
+    node = zzdasbfd(hshd, hnxd, hnbufd, rnbufd, *handle, *recno);
+    if (node > 0) {
 
 /*           Found it.  Update the buffered record. */
 
-	    moved_(recd, &c__128, &rcbufd[(i__1 = (node << 7) - 128) < 1280 &&
-		     0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (
-		    ftnlen)1922)]);
+	moved_(recd, &c__128, &rcbufd[(i__1 = (node << 7) - 128) < DASBSZ << 7 &&
+		 0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (
+		ftnlen)1922)]);
 
 /*           Set the update flag, indicating that this buffer entry */
 /*           has been modified. */
 
-	    upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fd", i__1, "dasrwr_", (ftnlen)1928)] = TRUE_;
+	upbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
+		"fd", i__1, "dasrwr_", (ftnlen)1928)] = TRUE_;
 
 /*           Put the information about this record at the head of the */
 /*           active list, if it is not already there. */
 
-	    if (node != headd) {
-		lnkxsl_(&node, &node, poold);
-		lnkilb_(&node, &headd, poold);
-		headd = node;
-	    }
-	    chkout_("DASWRD", (ftnlen)6);
-	    return 0;
+	if (node != headd) {
+	    lnkxsl_(&node, &node, poold);
+	    lnkilb_(&node, &headd, poold);
+	    headd = node;
 	}
-	node = poold[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poold", i__1, "dasrwr_", (ftnlen)1947)];
+	chkout_("DASWRD", (ftnlen)6);
+	return 0;
     }
 
 /*     The record we're writing to is not buffered.  We'll allocate */
@@ -2078,7 +1959,7 @@ L_daswrd:
 /*     this record, we'll write its contents out to the corresponding */
 /*     file, if the record has been updated. */
 
-    if (usedd < 10) {
+    if (usedd < DASBSZ) {
 
 /*        There's a free buffer entry available.  Just allocate it. */
 
@@ -2091,16 +1972,18 @@ L_daswrd:
 	node = lnktl_(&headd, poold);
 	lnkxsl_(&node, &node, poold);
 
+	zzdasbrm(hshd, hnxd, hnbufd, rnbufd, node);
+
 /*        If the allocated record was updated, write it out. */
 
-	if (upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
+	if (upbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
 		"fd", i__1, "dasrwr_", (ftnlen)1977)]) {
-	    zzddhhlu_(&hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	    zzddhhlu_(&hnbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		    s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)1979)], "DAS", &
 		    c_false, &wrunit, (ftnlen)3);
-	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < 10 && 0 <= 
+	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufd", i__1, "dasrwr_", (ftnlen)
-		    1981)], &rcbufd[(i__2 = (node << 7) - 128) < 1280 && 0 <= 
+		    1981)], &rcbufd[(i__2 = (node << 7) - 128) < DASBSZ << 7 && 0 <= 
 		    i__2 ? i__2 : s_rnge("rcbufd", i__2, "dasrwr_", (ftnlen)
 		    1981)], (ftnlen)5);
 	    if (failed_()) {
@@ -2112,19 +1995,20 @@ L_daswrd:
 
 /*     Now update the allocated buffer entry with the input data. */
 
-    moved_(recd, &c__128, &rcbufd[(i__1 = (node << 7) - 128) < 1280 && 0 <= 
+    moved_(recd, &c__128, &rcbufd[(i__1 = (node << 7) - 128) < DASBSZ << 7 && 0 <= 
 	    i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (ftnlen)1998)]);
 
 /*     Set the update flag, indicating that this buffer entry */
 /*     has been modified. Also set the handle and record number */
 /*     entries. */
 
-    upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufd", i__1,
+    upbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbufd", i__1,
 	     "dasrwr_", (ftnlen)2005)] = TRUE_;
-    hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufd", i__1,
+    hnbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("hnbufd", i__1,
 	     "dasrwr_", (ftnlen)2006)] = *handle;
-    rnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufd", i__1,
+    rnbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("rnbufd", i__1,
 	     "dasrwr_", (ftnlen)2007)] = *recno;
+    zzdasbin(hshd, hnxd, hnbufd, rnbufd, node);
 
 /*     Link this buffer entry to the head of the list. */
 
@@ -2344,51 +2228,44 @@ L_daswri:
 /*     If it hasn't been done yet, initialize the pointer list pools. */
 
     if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
+	lnkini_(&c__bsz, poold);
+	lnkini_(&c__bsz, pooli);
+	lnkini_(&c__bsz, poolc);
 	pass1 = FALSE_;
     }
 
 /*     See whether integer record number RECNO from file HANDLE is */
-/*     buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
+/*     buffered.  We'll look the record up in the hash table of */
+/*     buffered records.  If the record is already */
 /*     buffered, we'll update the buffer entry, but we'll defer writing */
 /*     the record out until we need to free a record, or until the */
 /*     integer buffer is flushed, whichever comes first. */
 
-    node = headi;
-    while(node > 0) {
-	if (*handle == hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)2268)] && *recno == 
-		rnbufi[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufi", i__2, "dasrwr_", (ftnlen)2268)]) {
+    node = zzdasbfd(hshi, hnxi, hnbufi, rnbufi, *handle, *recno);
+    if (node > 0) {
 
 /*           Found it.  Update the buffered record. */
 
-	    movei_(reci, &c__256, &rcbufi[(i__1 = (node << 8) - 256) < 2560 &&
-		     0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (
-		    ftnlen)2273)]);
+	movei_(reci, &c__256, &rcbufi[(i__1 = (node << 8) - 256) < DASBSZ << 8 &&
+		 0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (
+		ftnlen)2273)]);
 
 /*           Set the update flag, indicating that this buffer entry */
 /*           has been modified. */
 
-	    upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fi", i__1, "dasrwr_", (ftnlen)2279)] = TRUE_;
+	upbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
+		"fi", i__1, "dasrwr_", (ftnlen)2279)] = TRUE_;
 
 /*           Put the information about this record at the head of the */
 /*           active list, if it is not already there. */
 
-	    if (node != headi) {
-		lnkxsl_(&node, &node, pooli);
-		lnkilb_(&node, &headi, pooli);
-		headi = node;
-	    }
-	    chkout_("DASWRI", (ftnlen)6);
-	    return 0;
+	if (node != headi) {
+	    lnkxsl_(&node, &node, pooli);
+	    lnkilb_(&node, &headi, pooli);
+	    headi = node;
 	}
-	node = pooli[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("pooli", i__1, "dasrwr_", (ftnlen)2298)];
+	chkout_("DASWRI", (ftnlen)6);
+	return 0;
     }
 
 /*     The record we're writing to is not buffered.  We'll allocate */
@@ -2397,7 +2274,7 @@ L_daswri:
 /*     this record, we'll write its contents out to the corresponding */
 /*     file, if the record has been updated. */
 
-    if (usedi < 10) {
+    if (usedi < DASBSZ) {
 
 /*        There's a free buffer entry available.  Just allocate it. */
 
@@ -2410,16 +2287,18 @@ L_daswri:
 	node = lnktl_(&headi, pooli);
 	lnkxsl_(&node, &node, pooli);
 
+	zzdasbrm(hshi, hnxi, hnbufi, rnbufi, node);
+
 /*        If the allocated record was updated, write it out. */
 
-	if (upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
+	if (upbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
 		"fi", i__1, "dasrwr_", (ftnlen)2327)]) {
-	    zzddhhlu_(&hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	    zzddhhlu_(&hnbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		    s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)2329)], "DAS", &
 		    c_false, &wrunit, (ftnlen)3);
-	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < 10 && 0 <= 
+	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufi", i__1, "dasrwr_", (ftnlen)
-		    2331)], &rcbufi[(i__2 = (node << 8) - 256) < 2560 && 0 <= 
+		    2331)], &rcbufi[(i__2 = (node << 8) - 256) < DASBSZ << 8 && 0 <= 
 		    i__2 ? i__2 : s_rnge("rcbufi", i__2, "dasrwr_", (ftnlen)
 		    2331)], (ftnlen)5);
 	    if (failed_()) {
@@ -2431,7 +2310,7 @@ L_daswri:
 
 /*     Now update the allocated buffer entry with the input data. */
 
-    movei_(reci, &c__256, &rcbufi[(i__1 = (node << 8) - 256) < 2560 && 0 <= 
+    movei_(reci, &c__256, &rcbufi[(i__1 = (node << 8) - 256) < DASBSZ << 8 && 0 <= 
 	    i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (ftnlen)2348)]);
 
 /*     Set the update flag, indicating that this buffer entry */
@@ -2439,12 +2318,13 @@ L_daswri:
 /*     entries. */
 
     zzddhhlu_(handle, "DAS", &c_false, &unit, (ftnlen)3);
-    upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufi", i__1,
+    upbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbufi", i__1,
 	     "dasrwr_", (ftnlen)2357)] = TRUE_;
-    hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufi", i__1,
+    hnbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("hnbufi", i__1,
 	     "dasrwr_", (ftnlen)2358)] = *handle;
-    rnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufi", i__1,
+    rnbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("rnbufi", i__1,
 	     "dasrwr_", (ftnlen)2359)] = *recno;
+    zzdasbin(hshi, hnxi, hnbufi, rnbufi, node);
 
 /*     Link this buffer entry to the head of the list. */
 
@@ -2665,51 +2545,44 @@ L_daswrc:
 /*     If it hasn't been done yet, initialize the pointer list pools. */
 
     if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
+	lnkini_(&c__bsz, poold);
+	lnkini_(&c__bsz, pooli);
+	lnkini_(&c__bsz, poolc);
 	pass1 = FALSE_;
     }
 
 /*     See whether character record number RECNO from file HANDLE is */
-/*     buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
+/*     buffered.  We'll look the record up in the hash table of */
+/*     buffered records.  If the record is already */
 /*     buffered, we'll update the buffer entry, but we'll defer writing */
 /*     the record out until we need to free a record, or until the */
 /*     character buffer is flushed, whichever comes first. */
 
-    node = headc;
-    while(node > 0) {
-	if (*handle == hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)2621)] && *recno == 
-		rnbufc[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufc", i__2, "dasrwr_", (ftnlen)2621)]) {
+    node = zzdasbfd(hshc, hnxc, hnbufc, rnbufc, *handle, *recno);
+    if (node > 0) {
 
 /*           Found it.  Update the buffered record. */
 
-	    s_copy(rcbufc + (((i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)2626)) << 10), 
-		    recc, (ftnlen)1024, recc_len);
+	s_copy(rcbufc + (((i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
+		s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)2626)) << 10), 
+		recc, (ftnlen)1024, recc_len);
 
 /*           Set the update flag, indicating that this buffer entry */
 /*           has been modified. */
 
-	    upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fc", i__1, "dasrwr_", (ftnlen)2632)] = TRUE_;
+	upbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
+		"fc", i__1, "dasrwr_", (ftnlen)2632)] = TRUE_;
 
 /*           Put the information about this record at the head of the */
 /*           active list, if it is not already there. */
 
-	    if (node != headc) {
-		lnkxsl_(&node, &node, poolc);
-		lnkilb_(&node, &headc, poolc);
-		headc = node;
-	    }
-	    chkout_("DASWRC", (ftnlen)6);
-	    return 0;
+	if (node != headc) {
+	    lnkxsl_(&node, &node, poolc);
+	    lnkilb_(&node, &headc, poolc);
+	    headc = node;
 	}
-	node = poolc[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poolc", i__1, "dasrwr_", (ftnlen)2651)];
+	chkout_("DASWRC", (ftnlen)6);
+	return 0;
     }
 
 /*     The record we're writing to is not buffered.  We'll allocate */
@@ -2718,7 +2591,7 @@ L_daswrc:
 /*     this record, we'll write its contents out to the corresponding */
 /*     file, if the record has been updated. */
 
-    if (usedc < 10) {
+    if (usedc < DASBSZ) {
 
 /*        There's a free buffer entry available.  Just allocate it. */
 
@@ -2731,16 +2604,18 @@ L_daswrc:
 	node = lnktl_(&headc, poolc);
 	lnkxsl_(&node, &node, poolc);
 
+	zzdasbrm(hshc, hnxc, hnbufc, rnbufc, node);
+
 /*        If the allocated record was updated, write it out. */
 
-	if (upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
+	if (upbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
 		"fc", i__1, "dasrwr_", (ftnlen)2680)]) {
-	    zzddhhlu_(&hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	    zzddhhlu_(&hnbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		    s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)2682)], "DAS", &
 		    c_false, &wrunit, (ftnlen)3);
-	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < 10 && 0 <= 
+	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufc", i__1, "dasrwr_", (ftnlen)
-		    2684)], rcbufc + (((i__2 = node - 1) < 10 && 0 <= i__2 ? 
+		    2684)], rcbufc + (((i__2 = node - 1) < DASBSZ && 0 <= i__2 ? 
 		    i__2 : s_rnge("rcbufc", i__2, "dasrwr_", (ftnlen)2684)) <<
 		     10), (ftnlen)5, (ftnlen)1024);
 	    if (failed_()) {
@@ -2752,7 +2627,7 @@ L_daswrc:
 
 /*     Now update the allocated buffer entry with the input data. */
 
-    s_copy(rcbufc + (((i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge(
+    s_copy(rcbufc + (((i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge(
 	    "rcbufc", i__1, "dasrwr_", (ftnlen)2701)) << 10), recc, (ftnlen)
 	    1024, recc_len);
 
@@ -2760,12 +2635,13 @@ L_daswrc:
 /*     has been modified.  Also set the handle and record number */
 /*     entries. */
 
-    upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufc", i__1,
+    upbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbufc", i__1,
 	     "dasrwr_", (ftnlen)2708)] = TRUE_;
-    hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufc", i__1,
+    hnbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("hnbufc", i__1,
 	     "dasrwr_", (ftnlen)2709)] = *handle;
-    rnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufc", i__1,
+    rnbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("rnbufc", i__1,
 	     "dasrwr_", (ftnlen)2710)] = *recno;
+    zzdasbin(hshc, hnxc, hnbufc, rnbufc, node);
 
 /*     Link this buffer entry to the head of the list. */
 
@@ -3019,9 +2895,9 @@ L_dasurd:
 /*     If it hasn't been done yet, initialize the pointer list pools. */
 
     if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
+	lnkini_(&c__bsz, poold);
+	lnkini_(&c__bsz, pooli);
+	lnkini_(&c__bsz, poolc);
 	pass1 = FALSE_;
     }
 
@@ -3050,45 +2926,38 @@ L_dasurd:
     }
 
 /*     See whether double precision record number RECNO from file HANDLE */
-/*     is buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
+/*     is buffered.  We'll look the record up in the hash table of */
+/*     buffered records.  If the record is already */
 /*     buffered, we'll update the buffer entry, but we'll defer writing */
 /*     the record out until we need to free a record, or until the */
 /*     d.p. buffer is flushed, whichever comes first. */
 
-    node = headd;
-    while(node > 0) {
-	if (*handle == hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)3036)] && *recno == 
-		rnbufd[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufd", i__2, "dasrwr_", (ftnlen)3036)]) {
+    node = zzdasbfd(hshd, hnxd, hnbufd, rnbufd, *handle, *recno);
+    if (node > 0) {
 
 /*           Found it.  Update the buffered record. */
 
-	    i__2 = *last - *first + 1;
-	    moved_(datad, &i__2, &rcbufd[(i__1 = *first + (node << 7) - 129) <
-		     1280 && 0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasr"
-		    "wr_", (ftnlen)3041)]);
+	i__2 = *last - *first + 1;
+	moved_(datad, &i__2, &rcbufd[(i__1 = *first + (node << 7) - 129) <
+		 DASBSZ << 7 && 0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasr"
+		"wr_", (ftnlen)3041)]);
 
 /*           Set the update flag, indicating that this buffer entry */
 /*           has been modified. */
 
-	    upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fd", i__1, "dasrwr_", (ftnlen)3047)] = TRUE_;
+	upbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
+		"fd", i__1, "dasrwr_", (ftnlen)3047)] = TRUE_;
 
 /*           Put the information about this record at the head of the */
 /*           active list, if it is not already there. */
 
-	    if (node != headd) {
-		lnkxsl_(&node, &node, poold);
-		lnkilb_(&node, &headd, poold);
-		headd = node;
-	    }
-	    chkout_("DASURD", (ftnlen)6);
-	    return 0;
+	if (node != headd) {
+	    lnkxsl_(&node, &node, poold);
+	    lnkilb_(&node, &headd, poold);
+	    headd = node;
 	}
-	node = poold[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poold", i__1, "dasrwr_", (ftnlen)3066)];
+	chkout_("DASURD", (ftnlen)6);
+	return 0;
     }
 
 /*     The record we're writing to is not buffered.  In order to */
@@ -3098,7 +2967,7 @@ L_dasurd:
 /*     record.  Before using this record, we'll write its contents out */
 /*     to the corresponding file, if the record has been updated. */
 
-    if (usedd < 10) {
+    if (usedd < DASBSZ) {
 
 /*        There's a free buffer entry available.  Just allocate it. */
 
@@ -3111,16 +2980,18 @@ L_dasurd:
 	node = lnktl_(&headd, poold);
 	lnkxsl_(&node, &node, poold);
 
+	zzdasbrm(hshd, hnxd, hnbufd, rnbufd, node);
+
 /*        If the allocated record was updated, write it out. */
 
-	if (upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
+	if (upbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
 		"fd", i__1, "dasrwr_", (ftnlen)3097)]) {
-	    zzddhhlu_(&hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	    zzddhhlu_(&hnbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		    s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)3099)], "DAS", &
 		    c_false, &wrunit, (ftnlen)3);
-	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < 10 && 0 <= 
+	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufd", i__1, "dasrwr_", (ftnlen)
-		    3101)], &rcbufd[(i__2 = (node << 7) - 128) < 1280 && 0 <= 
+		    3101)], &rcbufd[(i__2 = (node << 7) - 128) < DASBSZ << 7 && 0 <= 
 		    i__2 ? i__2 : s_rnge("rcbufd", i__2, "dasrwr_", (ftnlen)
 		    3101)], (ftnlen)5);
 	    if (failed_()) {
@@ -3132,7 +3003,7 @@ L_dasurd:
 
 /*     Now try to read the record we're going to update. */
 
-    zzdasgrd_(handle, recno, &rcbufd[(i__1 = (node << 7) - 128) < 1280 && 0 <=
+    zzdasgrd_(handle, recno, &rcbufd[(i__1 = (node << 7) - 128) < DASBSZ << 7 && 0 <=
 	     i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (ftnlen)3119)]);
     if (failed_()) {
 	chkout_("DASURD", (ftnlen)6);
@@ -3147,11 +3018,12 @@ L_dasurd:
 /*     Update the head pointer. */
 
     lnkilb_(&node, &headd, poold);
-    hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufd", i__1,
+    hnbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("hnbufd", i__1,
 	     "dasrwr_", (ftnlen)3136)] = *handle;
-    rnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufd", i__1,
+    rnbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("rnbufd", i__1,
 	     "dasrwr_", (ftnlen)3137)] = *recno;
-    upbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufd", i__1,
+    zzdasbin(hshd, hnxd, hnbufd, rnbufd, node);
+    upbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbufd", i__1,
 	     "dasrwr_", (ftnlen)3138)] = TRUE_;
     headd = node;
 
@@ -3160,7 +3032,7 @@ L_dasurd:
 /*     automatically before or at the time the file is closed. */
 
     i__2 = *last - *first + 1;
-    moved_(datad, &i__2, &rcbufd[(i__1 = *first + (node << 7) - 129) < 1280 &&
+    moved_(datad, &i__2, &rcbufd[(i__1 = *first + (node << 7) - 129) < DASBSZ << 7 &&
 	     0 <= i__1 ? i__1 : s_rnge("rcbufd", i__1, "dasrwr_", (ftnlen)
 	    3146)]);
     chkout_("DASURD", (ftnlen)6);
@@ -3411,9 +3283,9 @@ L_dasuri:
 /*     If it hasn't been done yet, initialize the pointer list pools. */
 
     if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
+	lnkini_(&c__bsz, poold);
+	lnkini_(&c__bsz, pooli);
+	lnkini_(&c__bsz, poolc);
 	pass1 = FALSE_;
     }
 
@@ -3442,45 +3314,38 @@ L_dasuri:
     }
 
 /*     See whether integer record number RECNO from file HANDLE is */
-/*     buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
+/*     buffered.  We'll look the record up in the hash table of */
+/*     buffered records.  If the record is already */
 /*     buffered, we'll update the buffer entry, but we'll defer writing */
 /*     the record out until we need to free a record, or until the */
 /*     integer buffer is flushed, whichever comes first. */
 
-    node = headi;
-    while(node > 0) {
-	if (*handle == hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)3467)] && *recno == 
-		rnbufi[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufi", i__2, "dasrwr_", (ftnlen)3467)]) {
+    node = zzdasbfd(hshi, hnxi, hnbufi, rnbufi, *handle, *recno);
+    if (node > 0) {
 
 /*           Found it.  Update the buffered record. */
 
-	    i__2 = *last - *first + 1;
-	    movei_(datai, &i__2, &rcbufi[(i__1 = *first + (node << 8) - 257) <
-		     2560 && 0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasr"
-		    "wr_", (ftnlen)3472)]);
+	i__2 = *last - *first + 1;
+	movei_(datai, &i__2, &rcbufi[(i__1 = *first + (node << 8) - 257) <
+		 DASBSZ << 8 && 0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasr"
+		"wr_", (ftnlen)3472)]);
 
 /*           Set the update flag, indicating that this buffer entry */
 /*           has been modified. */
 
-	    upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fi", i__1, "dasrwr_", (ftnlen)3478)] = TRUE_;
+	upbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
+		"fi", i__1, "dasrwr_", (ftnlen)3478)] = TRUE_;
 
 /*           Put the information about this record at the head of the */
 /*           active list, if it is not already there. */
 
-	    if (node != headi) {
-		lnkxsl_(&node, &node, pooli);
-		lnkilb_(&node, &headi, pooli);
-		headi = node;
-	    }
-	    chkout_("DASURI", (ftnlen)6);
-	    return 0;
+	if (node != headi) {
+	    lnkxsl_(&node, &node, pooli);
+	    lnkilb_(&node, &headi, pooli);
+	    headi = node;
 	}
-	node = pooli[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("pooli", i__1, "dasrwr_", (ftnlen)3497)];
+	chkout_("DASURI", (ftnlen)6);
+	return 0;
     }
 
 /*     The record we're writing to is not buffered.  We'll allocate */
@@ -3489,7 +3354,7 @@ L_dasuri:
 /*     this record, we'll write its contents out to the corresponding */
 /*     file, if the record has been updated. */
 
-    if (usedi < 10) {
+    if (usedi < DASBSZ) {
 
 /*        There's a free buffer entry available.  Just allocate it. */
 
@@ -3502,16 +3367,18 @@ L_dasuri:
 	node = lnktl_(&headi, pooli);
 	lnkxsl_(&node, &node, pooli);
 
+	zzdasbrm(hshi, hnxi, hnbufi, rnbufi, node);
+
 /*        If the allocated record was updated, write it out. */
 
-	if (upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
+	if (upbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
 		"fi", i__1, "dasrwr_", (ftnlen)3526)]) {
-	    zzddhhlu_(&hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	    zzddhhlu_(&hnbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		    s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)3528)], "DAS", &
 		    c_false, &wrunit, (ftnlen)3);
-	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < 10 && 0 <= 
+	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufi", i__1, "dasrwr_", (ftnlen)
-		    3530)], &rcbufi[(i__2 = (node << 8) - 256) < 2560 && 0 <= 
+		    3530)], &rcbufi[(i__2 = (node << 8) - 256) < DASBSZ << 8 && 0 <= 
 		    i__2 ? i__2 : s_rnge("rcbufi", i__2, "dasrwr_", (ftnlen)
 		    3530)], (ftnlen)5);
 	    if (failed_()) {
@@ -3523,7 +3390,7 @@ L_dasuri:
 
 /*     Now try to read the record we're going to update. */
 
-    zzdasgri_(handle, recno, &rcbufi[(i__1 = (node << 8) - 256) < 2560 && 0 <=
+    zzdasgri_(handle, recno, &rcbufi[(i__1 = (node << 8) - 256) < DASBSZ << 8 && 0 <=
 	     i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (ftnlen)3547)]);
     if (failed_()) {
 	chkout_("DASURI", (ftnlen)6);
@@ -3538,11 +3405,12 @@ L_dasuri:
 /*     Update the head pointer. */
 
     lnkilb_(&node, &headi, pooli);
-    hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufi", i__1,
+    hnbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("hnbufi", i__1,
 	     "dasrwr_", (ftnlen)3564)] = *handle;
-    rnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufi", i__1,
+    rnbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("rnbufi", i__1,
 	     "dasrwr_", (ftnlen)3565)] = *recno;
-    upbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufi", i__1,
+    zzdasbin(hshi, hnxi, hnbufi, rnbufi, node);
+    upbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbufi", i__1,
 	     "dasrwr_", (ftnlen)3566)] = TRUE_;
     headi = node;
 
@@ -3551,7 +3419,7 @@ L_dasuri:
 /*     automatically before or at the time the file is closed. */
 
     i__2 = *last - *first + 1;
-    movei_(datai, &i__2, &rcbufi[(i__1 = *first + (node << 8) - 257) < 2560 &&
+    movei_(datai, &i__2, &rcbufi[(i__1 = *first + (node << 8) - 257) < DASBSZ << 8 &&
 	     0 <= i__1 ? i__1 : s_rnge("rcbufi", i__1, "dasrwr_", (ftnlen)
 	    3574)]);
     chkout_("DASURI", (ftnlen)6);
@@ -3807,9 +3675,9 @@ L_dasurc:
 /*     If it hasn't been done yet, initialize the pointer list pools. */
 
     if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
+	lnkini_(&c__bsz, poold);
+	lnkini_(&c__bsz, pooli);
+	lnkini_(&c__bsz, poolc);
 	pass1 = FALSE_;
     }
 
@@ -3838,44 +3706,37 @@ L_dasurc:
     }
 
 /*     See whether character record number RECNO from file HANDLE is */
-/*     buffered.  We'll search through the list of buffered records */
-/*     starting at the head of the list.  If the record is already */
+/*     buffered.  We'll look the record up in the hash table of */
+/*     buffered records.  If the record is already */
 /*     buffered, we'll update the buffer entry, but we'll defer writing */
 /*     the record out until we need to free a record, or until the */
 /*     character buffer is flushed, whichever comes first. */
 
-    node = headc;
-    while(node > 0) {
-	if (*handle == hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)3901)] && *recno == 
-		rnbufc[(i__2 = node - 1) < 10 && 0 <= i__2 ? i__2 : s_rnge(
-		"rnbufc", i__2, "dasrwr_", (ftnlen)3901)]) {
+    node = zzdasbfd(hshc, hnxc, hnbufc, rnbufc, *handle, *recno);
+    if (node > 0) {
 
 /*           Found it.  Update the buffered record. */
 
-	    s_copy(rcbufc + ((((i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
-		    s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)3906)) << 10) + 
-		    (*first - 1)), datac, *last - (*first - 1), datac_len);
+	s_copy(rcbufc + ((((i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
+		s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)3906)) << 10) + 
+		(*first - 1)), datac, *last - (*first - 1), datac_len);
 
 /*           Set the update flag, indicating that this buffer entry */
 /*           has been modified. */
 
-	    upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
-		    "fc", i__1, "dasrwr_", (ftnlen)3912)] = TRUE_;
+	upbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
+		"fc", i__1, "dasrwr_", (ftnlen)3912)] = TRUE_;
 
 /*           Put the information about this record at the head of the */
 /*           active list, if it is not already there. */
 
-	    if (node != headc) {
-		lnkxsl_(&node, &node, poolc);
-		lnkilb_(&node, &headc, poolc);
-		headc = node;
-	    }
-	    chkout_("DASURC", (ftnlen)6);
-	    return 0;
+	if (node != headc) {
+	    lnkxsl_(&node, &node, poolc);
+	    lnkilb_(&node, &headc, poolc);
+	    headc = node;
 	}
-	node = poolc[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
-		s_rnge("poolc", i__1, "dasrwr_", (ftnlen)3931)];
+	chkout_("DASURC", (ftnlen)6);
+	return 0;
     }
 
 /*     The record we're writing to is not buffered.  We'll allocate */
@@ -3884,7 +3745,7 @@ L_dasurc:
 /*     this record, we'll write its contents out to the corresponding */
 /*     file, if the record has been updated. */
 
-    if (usedc < 10) {
+    if (usedc < DASBSZ) {
 
 /*        There's a free buffer entry available.  Just allocate it. */
 
@@ -3897,16 +3758,18 @@ L_dasurc:
 	node = lnktl_(&headc, poolc);
 	lnkxsl_(&node, &node, poolc);
 
+	zzdasbrm(hshc, hnxc, hnbufc, rnbufc, node);
+
 /*        If the allocated record was updated, write it out. */
 
-	if (upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbu"
+	if (upbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbu"
 		"fc", i__1, "dasrwr_", (ftnlen)3960)]) {
-	    zzddhhlu_(&hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	    zzddhhlu_(&hnbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		    s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)3963)], "DAS", &
 		    c_false, &wrunit, (ftnlen)3);
-	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < 10 && 0 <= 
+	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufc", i__1, "dasrwr_", (ftnlen)
-		    3965)], rcbufc + (((i__2 = node - 1) < 10 && 0 <= i__2 ? 
+		    3965)], rcbufc + (((i__2 = node - 1) < DASBSZ && 0 <= i__2 ? 
 		    i__2 : s_rnge("rcbufc", i__2, "dasrwr_", (ftnlen)3965)) <<
 		     10), (ftnlen)5, (ftnlen)1024);
 	    if (failed_()) {
@@ -3919,7 +3782,7 @@ L_dasurc:
 /*     Now try to read the record we're going to update. */
 
     zzddhhlu_(handle, "DAS", &c_false, &unit, (ftnlen)3);
-    dasioc_("READ", &unit, recno, rcbufc + (((i__1 = node - 1) < 10 && 0 <= 
+    dasioc_("READ", &unit, recno, rcbufc + (((i__1 = node - 1) < DASBSZ && 0 <= 
 	    i__1 ? i__1 : s_rnge("rcbufc", i__1, "dasrwr_", (ftnlen)3984)) << 
 	    10), (ftnlen)4, (ftnlen)1024);
     if (failed_()) {
@@ -3935,11 +3798,12 @@ L_dasurc:
 /*     Update the head pointer. */
 
     lnkilb_(&node, &headc, poolc);
-    hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("hnbufc", i__1,
+    hnbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("hnbufc", i__1,
 	     "dasrwr_", (ftnlen)4001)] = *handle;
-    rnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("rnbufc", i__1,
+    rnbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("rnbufc", i__1,
 	     "dasrwr_", (ftnlen)4002)] = *recno;
-    upbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge("upbufc", i__1,
+    zzdasbin(hshc, hnxc, hnbufc, rnbufc, node);
+    upbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge("upbufc", i__1,
 	     "dasrwr_", (ftnlen)4003)] = TRUE_;
     headc = node;
 
@@ -3947,7 +3811,7 @@ L_dasurc:
 /*     have to write the record back to the file; that will get done */
 /*     automatically before or at the time the file is closed. */
 
-    s_copy(rcbufc + ((((i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : s_rnge(
+    s_copy(rcbufc + ((((i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : s_rnge(
 	    "rcbufc", i__1, "dasrwr_", (ftnlen)4011)) << 10) + (*first - 1)), 
 	    datac, *last - (*first - 1), datac_len);
     chkout_("DASURC", (ftnlen)6);
@@ -4430,9 +4294,9 @@ L_daswbr:
 /*     If it hasn't been done yet, initialize the pointer list pools. */
 
     if (pass1) {
-	lnkini_(&c__10, poold);
-	lnkini_(&c__10, pooli);
-	lnkini_(&c__10, poolc);
+	lnkini_(&c__bsz, poold);
+	lnkini_(&c__bsz, pooli);
+	lnkini_(&c__bsz, poolc);
 	pass1 = FALSE_;
     }
 
@@ -4451,15 +4315,15 @@ L_daswbr:
 
     node = headd;
     while(node > 0) {
-	if (*handle == hnbufd[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	if (*handle == hnbufd[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		s_rnge("hnbufd", i__1, "dasrwr_", (ftnlen)4540)]) {
 
 /*           This record belongs to the file of interest, so write the */
 /*           the record out. */
 
-	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < 10 && 0 <= 
+	    dasiod_("WRITE", &wrunit, &rnbufd[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufd", i__1, "dasrwr_", (ftnlen)
-		    4545)], &rcbufd[(i__2 = (node << 7) - 128) < 1280 && 0 <= 
+		    4545)], &rcbufd[(i__2 = (node << 7) - 128) < DASBSZ << 7 && 0 <= 
 		    i__2 ? i__2 : s_rnge("rcbufd", i__2, "dasrwr_", (ftnlen)
 		    4545)], (ftnlen)5);
 	    if (failed_()) {
@@ -4473,11 +4337,12 @@ L_daswbr:
 /*           the head node.  Decrement the number of used d.p. */
 /*           buffer elements. */
 
-	    next = poold[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
+	    next = poold[(i__1 = (node << 1) + 10) < (DASBSZ + 6) * 2 && 0 <= i__1 ? i__1 : 
 		    s_rnge("poold", i__1, "dasrwr_", (ftnlen)4562)];
 	    if (node == headd) {
 		headd = next;
 	    }
+	    zzdasbrm(hshd, hnxd, hnbufd, rnbufd, node);
 	    lnkfsl_(&node, &node, poold);
 	    node = next;
 	    --usedd;
@@ -4485,7 +4350,7 @@ L_daswbr:
 
 /*           Just get the next node. */
 
-	    node = poold[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
+	    node = poold[(i__1 = (node << 1) + 10) < (DASBSZ + 6) * 2 && 0 <= i__1 ? i__1 : 
 		    s_rnge("poold", i__1, "dasrwr_", (ftnlen)4577)];
 	}
     }
@@ -4494,15 +4359,15 @@ L_daswbr:
 
     node = headi;
     while(node > 0) {
-	if (*handle == hnbufi[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	if (*handle == hnbufi[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		s_rnge("hnbufi", i__1, "dasrwr_", (ftnlen)4592)]) {
 
 /*           This record belongs to the file of interest, so write the */
 /*           the record out. */
 
-	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < 10 && 0 <= 
+	    dasioi_("WRITE", &wrunit, &rnbufi[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufi", i__1, "dasrwr_", (ftnlen)
-		    4597)], &rcbufi[(i__2 = (node << 8) - 256) < 2560 && 0 <= 
+		    4597)], &rcbufi[(i__2 = (node << 8) - 256) < DASBSZ << 8 && 0 <= 
 		    i__2 ? i__2 : s_rnge("rcbufi", i__2, "dasrwr_", (ftnlen)
 		    4597)], (ftnlen)5);
 	    if (failed_()) {
@@ -4516,11 +4381,12 @@ L_daswbr:
 /*           the head node.  Decrement the number of used integer */
 /*           buffer elements. */
 
-	    next = pooli[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
+	    next = pooli[(i__1 = (node << 1) + 10) < (DASBSZ + 6) * 2 && 0 <= i__1 ? i__1 : 
 		    s_rnge("pooli", i__1, "dasrwr_", (ftnlen)4614)];
 	    if (node == headi) {
 		headi = next;
 	    }
+	    zzdasbrm(hshi, hnxi, hnbufi, rnbufi, node);
 	    lnkfsl_(&node, &node, pooli);
 	    node = next;
 	    --usedi;
@@ -4528,7 +4394,7 @@ L_daswbr:
 
 /*           Just get the next node. */
 
-	    node = pooli[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
+	    node = pooli[(i__1 = (node << 1) + 10) < (DASBSZ + 6) * 2 && 0 <= i__1 ? i__1 : 
 		    s_rnge("pooli", i__1, "dasrwr_", (ftnlen)4629)];
 	}
     }
@@ -4537,15 +4403,15 @@ L_daswbr:
 
     node = headc;
     while(node > 0) {
-	if (*handle == hnbufc[(i__1 = node - 1) < 10 && 0 <= i__1 ? i__1 : 
+	if (*handle == hnbufc[(i__1 = node - 1) < DASBSZ && 0 <= i__1 ? i__1 : 
 		s_rnge("hnbufc", i__1, "dasrwr_", (ftnlen)4644)]) {
 
 /*           This record belongs to the file of interest, so write the */
 /*           the record out. */
 
-	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < 10 && 0 <= 
+	    dasioc_("WRITE", &wrunit, &rnbufc[(i__1 = node - 1) < DASBSZ && 0 <= 
 		    i__1 ? i__1 : s_rnge("rnbufc", i__1, "dasrwr_", (ftnlen)
-		    4649)], rcbufc + (((i__2 = node - 1) < 10 && 0 <= i__2 ? 
+		    4649)], rcbufc + (((i__2 = node - 1) < DASBSZ && 0 <= i__2 ? 
 		    i__2 : s_rnge("rcbufc", i__2, "dasrwr_", (ftnlen)4649)) <<
 		     10), (ftnlen)5, (ftnlen)1024);
 	    if (failed_()) {
@@ -4559,11 +4425,12 @@ L_daswbr:
 /*           the head node.  Decrement the number of used character */
 /*           buffer elements. */
 
-	    next = poolc[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
+	    next = poolc[(i__1 = (node << 1) + 10) < (DASBSZ + 6) * 2 && 0 <= i__1 ? i__1 : 
 		    s_rnge("poolc", i__1, "dasrwr_", (ftnlen)4666)];
 	    if (node == headc) {
 		headc = next;
 	    }
+	    zzdasbrm(hshc, hnxc, hnbufc, rnbufc, node);
 	    lnkfsl_(&node, &node, poolc);
 	    node = next;
 	    --usedc;
@@ -4571,7 +4438,7 @@ L_daswbr:
 
 /*           Just get the next node. */
 
-	    node = poolc[(i__1 = (node << 1) + 10) < 32 && 0 <= i__1 ? i__1 : 
+	    node = poolc[(i__1 = (node << 1) + 10) < (DASBSZ + 6) * 2 && 0 <= i__1 ? i__1 : 
 		    s_rnge("poolc", i__1, "dasrwr_", (ftnlen)4681)];
 	}
     }
@@ -135,22 +135,17 @@
                SPICE_DSK02_MAXCGR (see the -Parameters section below).
 
    worksz      is the second dimension of the workspace array `work'.
-               `worksz' must be at least as large as the greater of
-
-                  - the number of fine voxel-plate associations
-
-                    This number is equal to
-
-                       np * {average number of fine voxels
-                             intersected by each plate}
-
-                  - the number of vertex-plate associations, if
-                    the vertex-plate mapping is constructed.
+               `worksz' must be at least np+1 and, if the vertex-plate
+               mapping is constructed, at least as large as the number
+               of vertex-plate associations.
 
                     This number is equal to
 
                        nv + ( 3 * np )
 
+               The fine voxel-plate associations are built in place in
+               the spatial index and need no workspace.
+
    voxpsz      is the size of the fine voxel-plate pointer array.
                This array maps fine voxels to lists of plates that
                intersect those voxels. `voxpsz' must be at least as
@@ -754,6 +749,11 @@
 
 -Version
 
+   -CSPICE Version 1.0.2, 16-OCT-2026
+
+       Updated the description of `worksz': the voxel-plate mapping
+       no longer uses the workspace.
+
    -CSPICE Version 1.0.1, 10-AUG-2021 (JDR)
 
        Edited the header to comply with NAIF standard. Fixed I/O type
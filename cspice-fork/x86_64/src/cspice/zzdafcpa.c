@@ -0,0 +1,186 @@
+/* zzdafcpa.f -- translated by f2c (version 19980913).
+   You must link the resulting object file with the libraries:
+	-lf2c -lm   (in that order)
+*/
+
+#include "f2c.h"
+
+/* $Procedure ZZDAFCPA ( DAF, copy address range to new array ) */
+/* Subroutine */ int zzdafcpa_(integer *handle, integer *baddr, integer *
+	eaddr)
+{
+    /* System generated locals */
+    integer i__1;
+
+    /* Local variables */
+    static doublereal data[1024];
+    integer last, n;
+    extern /* Subroutine */ int chkin_(char *, ftnlen), dafada_(doublereal *,
+	    integer *), dafgda_(integer *, integer *, integer *, doublereal *)
+	    ;
+    integer first;
+    extern /* Subroutine */ int sigerr_(char *, ftnlen), chkout_(char *,
+	    ftnlen), setmsg_(char *, ftnlen), errint_(char *, integer *,
+	    ftnlen);
+    extern logical failed_(void), return_(void);
+
+/* $ Abstract */
+
+/*     SPICE Private routine intended solely for the support of SPICE */
+/*     routines. Users should not call this routine directly due */
+/*     to the volatile nature of this routine. */
+
+/*     Append the double precision data bounded by two addresses */
+/*     within a DAF to the array currently being added to a DAF. */
+
+/* $ Disclaimer */
+
+/*     THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE */
+/*     CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S. */
+/*     GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE */
+/*     ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE */
+/*     PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS" */
+/*     TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY */
+/*     WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A */
+/*     PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC */
+/*     SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE */
+/*     SOFTWARE AND RELATED MATERIALS, HOWEVER USED. */
+
+/*     IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA */
+/*     BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT */
+/*     LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND, */
+/*     INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS, */
+/*     REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE */
+/*     REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY. */
+
+/*     RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF */
+/*     THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY */
+/*     CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE */
+/*     ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE. */
+
+/* $ Required_Reading */
+
+/*     DAF */
+
+/* $ Keywords */
+
+/*     FILES */
+
+/* $ Declarations */
+/* $ Brief_I/O */
+
+/*     VARIABLE  I/O  DESCRIPTION */
+/*     --------  ---  -------------------------------------------------- */
+/*     HANDLE     I   Handle of a DAF. */
+/*     BADDR, */
+/*     EADDR      I   Initial, final address of the data to copy. */
+
+/* $ Detailed_Input */
+
+/*     HANDLE   is the handle of a DAF open for read or write access. */
+
+/*     BADDR, */
+/*     EADDR    are the initial and final addresses of a contiguous */
+/*              set of double precision numbers within the DAF, */
+/*              normally the data of an array. */
+
+/* $ Detailed_Output */
+
+/*     None. See $Particulars. */
+
+/* $ Parameters */
+
+/*     None. */
+
+/* $ Exceptions */
+
+/*     1)  If BADDR is zero or negative, or if BADDR exceeds EADDR, an */
+/*         error is signaled by DAFGDA. */
+
+/*     2)  If no array is being added, an error is signaled by DAFADA. */
+
+/* $ Files */
+
+/*     See argument HANDLE. */
+
+/* $ Particulars */
+
+/*     The data are read and added to the new array in blocks of a */
+/*     fixed size, so that an array of any length is copied without */
+/*     any further storage. Because the data of SPK, CK and PCK */
+/*     segments do not refer to their own absolute addresses, copying */
+/*     the whole data of a segment into a new array gives a valid */
+/*     segment with the same contents. */
+
+/*     The new array may be in the same file as HANDLE. */
+
+/* $ Examples */
+
+/*     To copy an SPK segment with descriptor DESCR and identifier */
+/*     IDENT from the file with handle HANDLE to the file with handle */
+/*     NEWH: */
+
+/*        CALL DAFUS    ( DESCR, 2, 6, DC, IC ) */
+/*        CALL DAFBNA   ( NEWH,  DESCR, IDENT ) */
+/*        CALL ZZDAFCPA ( HANDLE, IC(5), IC(6) ) */
+/*        CALL DAFENA */
+
+/* $ Restrictions */
+
+/*     None. */
+
+/* $ Literature_References */
+
+/*     None. */
+
+/* $ Author_and_Institution */
+
+/*     None. */
+
+/* $ Version */
+
+/* -    SPICELIB Version 1.0.0, 16-OCT-2026 */
+
+/* -& */
+/* $ Index_Entries */
+
+/*     copy DAF data to new array */
+
+/* -& */
+
+/*     SPICELIB functions */
+
+
+/*     Local parameters */
+
+
+/*     Local variables */
+
+
+/*     Standard SPICE error handling. */
+
+    if (return_()) {
+	return 0;
+    }
+    if (*baddr <= 0 || *baddr > *eaddr) {
+	chkin_("ZZDAFCPA", (ftnlen)8);
+	setmsg_("Address range [#, #] is invalid.", (ftnlen)32);
+	errint_("#", baddr, (ftnlen)1);
+	errint_("#", eaddr, (ftnlen)1);
+	sigerr_("SPICE(DAFBEGGTEND)", (ftnlen)18);
+	chkout_("ZZDAFCPA", (ftnlen)8);
+	return 0;
+    }
+    first = *baddr;
+    while(first <= *eaddr && ! failed_()) {
+/* Computing MIN */
+	i__1 = first + 1023;
+	last = min(i__1,*eaddr);
+	n = last - first + 1;
+	dafgda_(handle, &first, &last, data);
+	dafada_(data, &n);
+	first = last + 1;
+    }
+    return 0;
+} /* zzdafcpa_ */
+
@@ -0,0 +1,29 @@
+#include "f2c.h"
+#include "fio.h"
+
+/* Read up to NREC consecutive records, starting at record RECNO, from
+   the file connected for direct access to Unit, using a single read.
+   The records are placed in BUFFER, which must have room for NREC
+   records. The return value is the number of complete records read;
+   it is zero if the unit is not connected for direct access, if the
+   last operation on the unit was a write, or if the read fails. */
+
+ integer
+#ifdef KR_headers
+zzdasrdn_(Unit, recno, nrec, buffer) integer *Unit, *recno, *nrec; char *buffer;
+#else
+zzdasrdn_(integer *Unit, integer *recno, integer *nrec, char *buffer)
+#endif
+{
+	unit *u;
+	FILE *f;
+
+	if (*Unit >= MXUNIT || *Unit < 0 || *recno < 1 || *nrec < 1)
+		return 0;
+	u = &f__units[*Unit];
+	if ((f = u->ufd) == NULL || u->url <= 0 || u->uwrt || !(u->urw & 1))
+		return 0;
+	if (fseek(f, (long)(*recno - 1) * u->url, SEEK_SET))
+		return 0;
+	return (integer)fread(buffer, (size_t)u->url, (size_t)*nrec, f);
+	}
@@ -0,0 +1,774 @@
+/*
+
+-Procedure zzprop2v ( Propagate two-body states, vectorized )
+
+-Abstract
+
+   SPICE Private routine intended solely for the support of SPICE
+   routines.  Users should not call this routine directly due
+   to the volatile nature of this routine.
+
+   Propagate many states under two-body motion, producing exactly the
+   states PROP2B would.
+
+-Disclaimer
+
+   THIS SOFTWARE AND ANY RELATED MATERIALS WERE CREATED BY THE
+   CALIFORNIA INSTITUTE OF TECHNOLOGY (CALTECH) UNDER A U.S.
+   GOVERNMENT CONTRACT WITH THE NATIONAL AERONAUTICS AND SPACE
+   ADMINISTRATION (NASA). THE SOFTWARE IS TECHNOLOGY AND SOFTWARE
+   PUBLICLY AVAILABLE UNDER U.S. EXPORT LAWS AND IS PROVIDED "AS-IS"
+   TO THE RECIPIENT WITHOUT WARRANTY OF ANY KIND, INCLUDING ANY
+   WARRANTIES OF PERFORMANCE OR MERCHANTABILITY OR FITNESS FOR A
+   PARTICULAR USE OR PURPOSE (AS SET FORTH IN UNITED STATES UCC
+   SECTIONS 2312-2313) OR FOR ANY PURPOSE WHATSOEVER, FOR THE
+   SOFTWARE AND RELATED MATERIALS, HOWEVER USED.
+
+   IN NO EVENT SHALL CALTECH, ITS JET PROPULSION LABORATORY, OR NASA
+   BE LIABLE FOR ANY DAMAGES AND/OR COSTS, INCLUDING, BUT NOT
+   LIMITED TO, INCIDENTAL OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+   INCLUDING ECONOMIC DAMAGE OR INJURY TO PROPERTY AND LOST PROFITS,
+   REGARDLESS OF WHETHER CALTECH, JPL, OR NASA BE ADVISED, HAVE
+   REASON TO KNOW, OR, IN FACT, SHALL KNOW OF THE POSSIBILITY.
+
+   RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF
+   THE SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY
+   CALTECH AND NASA FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE
+   ACTIONS OF RECIPIENT IN THE USE OF THE SOFTWARE.
+
+-Required_Reading
+
+   None.
+
+-Keywords
+
+   CONIC
+   EPHEMERIS
+   PRIVATE
+   UTILITY
+
+*/
+
+   #include <math.h>
+   #include "f2c.h"
+   #include "SpiceZfc.h"
+
+   /*
+   Number of states propagated together. The loops over the states
+   of a block have no dependencies between iterations, so that the
+   compiler can vectorize them.
+   */
+   #define BLKSIZ          8
+
+   /*
+   Failure codes.
+   */
+   #define NONPOS          1
+   #define ZEROPS          2
+   #define ZEROVL          3
+   #define NOCONC          4
+   #define DTRANG          5
+
+
+/*
+Evaluate the Stumpff functions C0, C1, C2 and C3 at each of the
+m values x for which use is true, exactly as stmp03_ does. The
+series used for small arguments is evaluated for every value, and
+then replaced by the closed form for values outside [-1, 1].
+*/
+static void stumpff ( integer           m,
+                      const logical     use   [BLKSIZ],
+                      const doublereal  pairs [20],
+                      const doublereal  x     [BLKSIZ],
+                      doublereal        c0    [BLKSIZ],
+                      doublereal        c1    [BLKSIZ],
+                      doublereal        c2    [BLKSIZ],
+                      doublereal        c3    [BLKSIZ] )
+{
+   doublereal              z;
+   integer                 i;
+   integer                 l;
+
+   for ( l = 0;  l < m;  l++ )
+   {
+      c3[l] = 1.;
+      c2[l] = 1.;
+   }
+
+   for ( i = 20;  i >= 4;  i -= 2 )
+   {
+      for ( l = 0;  l < m;  l++ )
+      {
+         c3[l] = 1. - x[l] * pairs[i-1] * c3[l];
+      }
+   }
+
+   for ( i = 19;  i >= 3;  i -= 2 )
+   {
+      for ( l = 0;  l < m;  l++ )
+      {
+         c2[l] = 1. - x[l] * pairs[i-1] * c2[l];
+      }
+   }
+
+   for ( l = 0;  l < m;  l++ )
+   {
+      c3[l] = pairs[1] * c3[l];
+      c2[l] = pairs[0] * c2[l];
+      c1[l] = 1. - x[l] * c3[l];
+      c0[l] = 1. - x[l] * c2[l];
+   }
+
+   for ( l = 0;  l < m;  l++ )
+   {
+      if ( !use[l] )
+      {
+         continue;
+      }
+
+      if ( x[l] < -1. )
+      {
+         z     = sqrt( -x[l] );
+         c0[l] = cosh( z );
+         c1[l] = sinh( z ) / z;
+         c2[l] = ( 1 - c0[l] ) / x[l];
+         c3[l] = ( 1 - c1[l] ) / x[l];
+      }
+      else if ( x[l] > 1. )
+      {
+         z     = sqrt( x[l] );
+         c0[l] = cos( z );
+         c1[l] = sin( z ) / z;
+         c2[l] = ( 1 - c0[l] ) / x[l];
+         c3[l] = ( 1 - c1[l] ) / x[l];
+      }
+   }
+}
+
+
+/*
+-Brief_I/O
+
+   VARIABLE  I/O  DESCRIPTION
+   --------  ---  --------------------------------------------------
+   n          I   Number of states.
+   ld         I   Leading dimension of pvinit and pvprop.
+   gm         I   Gravity of the central mass for each state.
+   gmstep     I   Stride of gm: 0 for a single value, 1 for n values.
+   pvinit     I   Initial states, as six arrays of n components.
+   dt         I   Time offset for each state.
+   dtstep     I   Stride of dt: 0 for a single value, 1 for n values.
+   pvprop     O   Propagated states, as six arrays of n components.
+   fail       O   Index of the first state that could not be
+                  propagated, or 0.
+   code       O   The reason the state could not be propagated.
+
+-Detailed_Input
+
+   n           is the number of states.
+
+   gm          is the gravitational parameter of the central mass
+               for each state, in km**3/sec**2. If `gmstep' is 0,
+               gm[0] applies to every state; otherwise gm has `n'
+               elements.
+
+   ld          is the distance between the components of a state in
+               pvinit and pvprop. ld is at least n.
+
+   pvinit      is an array of states relative to the central mass.
+               Component k of state i is
+
+                  pvinit[ k*ld + i ]
+
+               so that the x positions of all the states are
+               contiguous, followed by the y positions and so on. A
+               subset of the states of a larger array can be
+               propagated by passing a pointer into the array and the
+               array's own leading dimension.
+
+   dt          is the time offset in seconds from the initial states
+               to the propagated states. If `dtstep' is 0, dt[0]
+               applies to every state; otherwise dt has `n' elements.
+
+-Detailed_Output
+
+   pvprop      is an array of the propagated states, laid out as
+               pvinit. Each state is exactly the
+               state that prop2b_ would produce from the same inputs.
+               States that cannot be propagated are set to zero.
+
+   fail        is the 1-based index of the first state that could
+               not be propagated, or 0 if all the states were
+               propagated.
+
+   code        is, if `fail' is non-zero, the reason that state
+               could not be propagated:
+
+                  1  gm is not positive
+                  2  the position is zero
+                  3  the velocity is zero
+                  4  the position and velocity are parallel
+                  5  dt is beyond the range for which the state can
+                     be propagated reliably
+
+               These correspond to the errors SPICE(NONPOSITIVEMASS),
+               SPICE(ZEROPOSITION), SPICE(ZEROVELOCITY),
+               SPICE(NONCONICMOTION) and SPICE(DTOUTOFRANGE) signaled
+               by prop2b_.
+
+-Parameters
+
+   None.
+
+-Exceptions
+
+   Error free. Failures are reported through `fail' and `code', and
+   do not prevent the other states being propagated.
+
+-Files
+
+   None.
+
+-Particulars
+
+   This routine performs the computation of prop2b_ for blocks of
+   states at a time: the universal variable of every state of a block
+   is bracketed and then found by bisection in lock step, with each
+   state stopping under exactly the conditions prop2b_ applies to it.
+   The per-state quantities are held in arrays, so that each step is
+   a loop over the states of the block that the compiler can
+   vectorize.
+
+   This routine does not use the SPICE error subsystem or any saved
+   variables, so it may be called from several threads at once for
+   disjoint sets of states. zzp2verr_, in this file, signals the SPICE error
+   corresponding to a failure it reports.
+
+-Examples
+
+   See prop2v_c and conicv_c.
+
+-Restrictions
+
+   None.
+
+-Literature_References
+
+   None.
+
+-Author_and_Institution
+
+   None.
+
+-Version
+
+   -CSPICE Version 1.0.0, 16-OCT-2026
+
+-Index_Entries
+
+   propagate many states using two-body force model
+
+-&
+*/
+
+
+   int zzprop2v_ ( integer     * n,
+                   integer     * ld,
+                   doublereal  * gm,
+                   integer     * gmstep,
+                   doublereal  * pvinit,
+                   doublereal  * dt,
+                   integer     * dtstep,
+                   doublereal  * pvprop,
+                   integer     * fail,
+                   integer     * code   )
+
+{ /* Begin zzprop2v_ */
+
+   extern doublereal       dpmax_ ( void );
+
+   /*
+   Per-state quantities, named as in prop2b_.
+   */
+   doublereal              f     [BLKSIZ];
+   doublereal              br0   [BLKSIZ];
+   doublereal              b2rv  [BLKSIZ];
+   doublereal              bq    [BLKSIZ];
+   doublereal              qovr0 [BLKSIZ];
+   doublereal              bound [BLKSIZ];
+   doublereal              t     [BLKSIZ];
+   doublereal              x     [BLKSIZ];
+   doublereal              oldx  [BLKSIZ];
+   doublereal              lower [BLKSIZ];
+   doublereal              upper [BLKSIZ];
+   doublereal              kfun  [BLKSIZ];
+   doublereal              fx2   [BLKSIZ];
+   doublereal              c0    [BLKSIZ];
+   doublereal              c1    [BLKSIZ];
+   doublereal              c2    [BLKSIZ];
+   doublereal              c3    [BLKSIZ];
+   doublereal              s0    [BLKSIZ];
+   doublereal              s1    [BLKSIZ];
+   doublereal              s2    [BLKSIZ];
+   doublereal              s3    [BLKSIZ];
+   integer                 lcount[BLKSIZ];
+   integer                 mostc [BLKSIZ];
+   integer                 status[BLKSIZ];
+   logical                 done  [BLKSIZ];
+   logical                 run   [BLKSIZ];
+   logical                 live  [BLKSIZ];
+
+   doublereal              pairs [20];
+   doublereal              pos   [3];
+   doublereal              vel   [3];
+   doublereal              hvec  [3];
+   doublereal              eqvec [3];
+   doublereal              tmpvec[3];
+   doublereal              b;
+   doublereal              br;
+   doublereal              d__1;
+   doublereal              d__2;
+   doublereal              d__3;
+   doublereal              e;
+   doublereal              fixed;
+   doublereal              gml;
+   doublereal              h2;
+   doublereal              logdpm;
+   doublereal              logmax;
+   doublereal              maxc;
+   doublereal              pc;
+   doublereal              pcdot;
+   doublereal              q;
+   doublereal              r0;
+   doublereal              rootf;
+   doublereal              rv;
+   doublereal              vc;
+   doublereal              vcdot;
+   doublereal              x2;
+   doublereal              x3;
+   integer                 base;
+   integer                 i;
+   integer                 k;
+   integer                 l;
+   integer                 m;
+   integer                 ldim;
+   integer                 nn;
+   logical                 any;
+
+   nn    = *n;
+   ldim  = *ld;
+   *fail = 0;
+   *code = 0;
+
+   for ( i = 1;  i <= 20;  i++ )
+   {
+      pairs[i-1] = 1. / ( (doublereal) i * (doublereal) ( i + 1 ) );
+   }
+
+   logdpm = log( dpmax_() / 2. );
+   logmax = log( dpmax_() );
+
+   for ( base = 0;  base < nn;  base += BLKSIZ )
+   {
+      m = min( BLKSIZ, nn - base );
+
+      /*
+      Compute the constants of each orbit as prop2b_ does. States
+      that need no propagation or cannot be propagated are given
+      harmless values and marked done.
+      */
+      for ( l = 0;  l < m;  l++ )
+      {
+         i   = base + l;
+         gml = gm[ i * (*gmstep) ];
+         t[l] = dt[ i * (*dtstep) ];
+
+         for ( k = 0;  k < 3;  k++ )
+         {
+            pos[k] = pvinit[ k     * ldim + i ];
+            vel[k] = pvinit[ (k+3) * ldim + i ];
+         }
+
+         status[l] = 0;
+         done  [l] = FALSE_;
+
+         if ( gml <= 0. )
+         {
+            status[l] = NONPOS;
+         }
+         else if ( vzero_( pos ) )
+         {
+            status[l] = ZEROPS;
+         }
+         else if ( vzero_( vel ) )
+         {
+            status[l] = ZEROVL;
+         }
+         else
+         {
+            r0 = vnorm_( pos );
+            rv = vdot_ ( pos, vel );
+
+            vcrss_( pos, vel, hvec );
+            h2 = vdot_( hvec, hvec );
+
+            if ( h2 == 0. )
+            {
+               status[l] = NOCONC;
+            }
+            else
+            {
+               vcrss_( vel, hvec, tmpvec );
+               d__1 =  1. / gml;
+               d__2 = -1. / r0;
+               vlcom_( &d__1, tmpvec, &d__2, pos, eqvec );
+               e = vnorm_( eqvec );
+
+               q        = h2 / ( gml * ( e + 1 ) );
+               f[l]     = 1. - e;
+               b        = sqrt( q / gml );
+               br0[l]   = b * r0;
+               b2rv[l]  = b * b * rv;
+               bq[l]    = b * q;
+               qovr0[l] = q / r0;
+
+               d__2 = 1., d__3 = abs( br0[l] ), d__2 = max( d__2, d__3 ),
+               d__3 = abs( b2rv[l] ), d__2 = max( d__2, d__3 ),
+               d__3 = abs( bq[l] ), d__2 = max( d__2, d__3 ),
+               d__3 = ( d__1 = qovr0[l] / bq[l], abs( d__1 ) );
+               maxc = max( d__2, d__3 );
+
+               if ( f[l] < 0. )
+               {
+                  fixed = logdpm - log( maxc );
+                  rootf = sqrt( -f[l] );
+                  d__1  = fixed / rootf;
+                  d__2  = ( fixed + log( -f[l] ) * 1.5 ) / rootf;
+                  bound[l] = min( d__1, d__2 );
+               }
+               else
+               {
+                  bound[l] = exp( ( log( 1.5 ) + logmax - log( maxc ) )
+                                  / 3.                                  );
+               }
+            }
+         }
+
+         if ( ( status[l] != 0 ) || ( t[l] == 0. ) )
+         {
+            done [l] = TRUE_;
+            f    [l] = 0.;
+            br0  [l] = 1.;
+            b2rv [l] = 0.;
+            bq   [l] = 1.;
+            qovr0[l] = 0.;
+            bound[l] = 1.;
+         }
+      }
+
+      /*
+      Get the initial guess at one end of the bracket.
+      */
+      for ( l = 0;  l < m;  l++ )
+      {
+         live[l] = !done[l];
+         d__1  = t[l] / bq[l];
+         d__2  = -bound[l];
+         x[l]  = brcktd_( &d__1, &d__2, &bound[l] );
+         fx2[l] = f[l] * x[l] * x[l];
+      }
+
+      stumpff ( m, live, pairs, fx2, c0, c1, c2, c3 );
+
+      for ( l = 0;  l < m;  l++ )
+      {
+         kfun[l] = x[l] * (   br0[l]  * c1[l]
+                            + x[l] * (   b2rv[l] * c2[l]
+                                       + x[l] * ( bq[l] * c3[l] ) ) );
+
+         if ( t[l] < 0. )
+         {
+            upper[l] = 0.;
+            lower[l] = x[l];
+            run  [l] = !done[l] && ( kfun[l] > t[l] );
+         }
+         else
+         {
+            lower[l] = 0.;
+            upper[l] = x[l];
+            run  [l] = !done[l] && ( kfun[l] < t[l] );
+         }
+      }
+
+      /*
+      Widen each bracket until it contains the root.
+      */
+      do
+      {
+         for ( l = 0;  l < m;  l++ )
+         {
+            if ( run[l] )
+            {
+               oldx[l] = x[l];
+               d__2    = -bound[l];
+
+               if ( t[l] < 0. )
+               {
+                  upper[l]  = lower[l];
+                  lower[l] *= 2.;
+                  x[l]      = brcktd_( &lower[l], &d__2, &bound[l] );
+               }
+               else
+               {
+                  lower[l]  = upper[l];
+                  upper[l] *= 2.;
+                  x[l]      = brcktd_( &upper[l], &d__2, &bound[l] );
+               }
+
+               if ( x[l] == oldx[l] )
+               {
+                  status[l] = DTRANG;
+                  done  [l] = TRUE_;
+                  run   [l] = FALSE_;
+               }
+
+               fx2[l] = f[l] * x[l] * x[l];
+            }
+         }
+
+         stumpff ( m, run, pairs, fx2, s0, s1, s2, s3 );
+
+         any = FALSE_;
+
+         for ( l = 0;  l < m;  l++ )
+         {
+            if ( run[l] )
+            {
+               c0[l] = s0[l];
+               c1[l] = s1[l];
+               c2[l] = s2[l];
+               c3[l] = s3[l];
+
+               if ( t[l] < 0. )
+               {
+                  kfun[l] = x[l] * (   br0[l] * c1[l]
+                                     + x[l] * (   b2rv[l] * c2[l]
+                                                + x[l] * ( bq[l] * c3[l] ) ) );
+                  run[l]  = ( kfun[l] > t[l] );
+               }
+               else
+               {
+                  kfun[l] = x[l] * (   br0[l] * c1[l]
+                                     + x[l] * (   b2rv[l] * c2[l]
+                                                + x[l] * bq[l] * c3[l] ) );
+                  run[l]  = ( kfun[l] < t[l] );
+               }
+
+               any = any || run[l];
+            }
+         }
+      }
+      while ( any );
+
+      /*
+      Bisect each bracket.
+      */
+      for ( l = 0;  l < m;  l++ )
+      {
+         if ( !done[l] )
+         {
+            d__3 = lower[l], d__2 = ( lower[l] + upper[l] ) / 2.;
+            d__2 = max( d__3, d__2 );
+            x[l] = min( upper[l], d__2 );
+         }
+         fx2[l] = f[l] * x[l] * x[l];
+      }
+
+      for ( l = 0;  l < m;  l++ )
+      {
+         live[l] = !done[l];
+      }
+
+      stumpff ( m, live, pairs, fx2, c0, c1, c2, c3 );
+
+      any = FALSE_;
+
+      for ( l = 0;  l < m;  l++ )
+      {
+         lcount[l] = 0;
+         mostc [l] = 1000;
+         run   [l] = !done[l] && ( x[l] > lower[l] ) && ( x[l] < upper[l] );
+         any       = any || run[l];
+      }
+
+      while ( any )
+      {
+         for ( l = 0;  l < m;  l++ )
+         {
+            if ( run[l] )
+            {
+               kfun[l] = x[l] * (   br0[l] * c1[l]
+                                  + x[l] * (   b2rv[l] * c2[l]
+                                             + x[l] * bq[l] * c3[l] ) );
+
+               if ( kfun[l] > t[l] )
+               {
+                  upper[l] = x[l];
+               }
+               else if ( kfun[l] < t[l] )
+               {
+                  lower[l] = x[l];
+               }
+               else
+               {
+                  upper[l] = x[l];
+                  lower[l] = x[l];
+               }
+
+               if (    ( mostc[l] > 64 )
+                    && ( upper[l] != 0. ) && ( lower[l] != 0. ) )
+               {
+                  mostc [l] = 64;
+                  lcount[l] = 0;
+               }
+
+               d__3 = lower[l], d__2 = ( lower[l] + upper[l] ) / 2.;
+               d__2 = max( d__3, d__2 );
+               x[l] = min( upper[l], d__2 );
+               fx2[l] = f[l] * x[l] * x[l];
+            }
+         }
+
+         stumpff ( m, run, pairs, fx2, s0, s1, s2, s3 );
+
+         any = FALSE_;
+
+         for ( l = 0;  l < m;  l++ )
+         {
+            if ( run[l] )
+            {
+               c0[l] = s0[l];
+               c1[l] = s1[l];
+               c2[l] = s2[l];
+               c3[l] = s3[l];
+
+               ++lcount[l];
+
+               run[l] =    ( x[l] > lower[l] ) && ( x[l] < upper[l] )
+                        && ( lcount[l] < mostc[l] );
+               any    = any || run[l];
+            }
+         }
+      }
+
+      /*
+      Form the propagated states.
+      */
+      for ( l = 0;  l < m;  l++ )
+      {
+         i = base + l;
+
+         if ( status[l] != 0 )
+         {
+            for ( k = 0;  k < 6;  k++ )
+            {
+               pvprop[ k * ldim + i ] = 0.;
+            }
+
+            if ( *fail == 0 )
+            {
+               *fail = i + 1;
+               *code = status[l];
+            }
+         }
+         else if ( t[l] == 0. )
+         {
+            for ( k = 0;  k < 6;  k++ )
+            {
+               pvprop[ k * ldim + i ] = pvinit[ k * ldim + i ];
+            }
+         }
+         else
+         {
+            x2    = x[l] * x[l];
+            x3    = x2 * x[l];
+            br    = br0[l] * c0[l] + x[l] * (   b2rv[l] * c1[l]
+                                              + x[l] * ( bq[l] * c2[l] ) );
+            pc    = 1. - qovr0[l] * x2 * c2[l];
+            vc    = t[l] - bq[l] * x3 * c3[l];
+            pcdot = -( qovr0[l] / br ) * x[l] * c1[l];
+            vcdot = 1. - bq[l] / br * x2 * c2[l];
+
+            for ( k = 0;  k < 3;  k++ )
+            {
+               pos[k] = pvinit[ k     * ldim + i ];
+               vel[k] = pvinit[ (k+3) * ldim + i ];
+            }
+
+            for ( k = 0;  k < 3;  k++ )
+            {
+               pvprop[ k     * ldim + i ] = pc    * pos[k] + vc    * vel[k];
+               pvprop[ (k+3) * ldim + i ] = pcdot * pos[k] + vcdot * vel[k];
+            }
+         }
+      }
+   }
+
+   return 0;
+
+} /* End zzprop2v_ */
+
+
+/*
+Signal the SPICE error corresponding to a failure reported by
+zzprop2v_ for the state with 1-based index fail.
+*/
+   int zzp2verr_ ( integer     * fail,
+                   integer     * code )
+
+{ /* Begin zzp2verr_ */
+
+   integer                 index;
+
+   index = *fail - 1;
+
+   if ( *code == NONPOS )
+   {
+      setmsg_ ( "The gravitational parameter for the state at index "
+                "# was not positive.", (ftnlen)70                      );
+      errint_ ( "#", &index, (ftnlen)1                                 );
+      sigerr_ ( "SPICE(NONPOSITIVEMASS)", (ftnlen)22                   );
+   }
+   else if ( *code == ZEROPS )
+   {
+      setmsg_ ( "The position of the state at index # is the zero "
+                "vector.", (ftnlen)56                                 );
+      errint_ ( "#", &index, (ftnlen)1                                );
+      sigerr_ ( "SPICE(ZEROPOSITION)", (ftnlen)19                     );
+   }
+   else if ( *code == ZEROVL )
+   {
+      setmsg_ ( "The velocity of the state at index # is the zero "
+                "vector.", (ftnlen)56                                 );
+      errint_ ( "#", &index, (ftnlen)1                                );
+      sigerr_ ( "SPICE(ZEROVELOCITY)", (ftnlen)19                     );
+   }
+   else if ( *code == NOCONC )
+   {
+      setmsg_ ( "The position and velocity of the state at index # "
+                "are parallel.", (ftnlen)63                           );
+      errint_ ( "#", &index, (ftnlen)1                                );
+      sigerr_ ( "SPICE(NONCONICMOTION)", (ftnlen)21                   );
+   }
+   else
+   {
+      setmsg_ ( "The time offset for the state at index # is beyond "
+                "the range for which the state can be reliably "
+                "propagated.", (ftnlen)108                             );
+      errint_ ( "#", &index, (ftnlen)1                                 );
+      sigerr_ ( "SPICE(DTOUTOFRANGE)", (ftnlen)19                      );
+   }
+
+   return 0;
+
+} /* End zzp2verr_ */
@@ -0,0 +1,275 @@
+#include <errno.h>
+#include <math.h>
+#include "f2c.h"
+#include "fio.h"
+
+/* Block I/O of encoded double precision numbers in text transfer
+   files, for WRENCD and RDENCD.
+
+   The numbers are encoded exactly as DP2HX encodes them, and each
+   one is written on its own line between single quotes, exactly as
+   WRENCD's formatted writes put them. Reads accept the records that
+   WRENCD writes; anything else is left to the list-directed read of
+   RDENCD. Both work directly on the stream of a unit connected for
+   sequential formatted access, which is safe between complete I/O
+   statements since the I/O library keeps no data of its own for such
+   units between statements. */
+
+ static char digits[16] = "0123456789ABCDEF";
+ static signed char values[256];
+ static int tabled = 0;
+
+ static void
+#ifdef KR_headers
+maketable()
+#else
+maketable(void)
+#endif
+{
+	int i;
+
+	for (i = 0; i < 256; i++)
+		values[i] = -1;
+	for (i = 0; i < 16; i++)
+		values[(unsigned char)digits[i]] = (signed char)i;
+	tabled = 1;
+	}
+
+/* Encode NUMBER as DP2HX would, returning the length of the string.
+   STRING needs room for 24 characters. NUMBER must be finite. */
+
+ static int
+#ifdef KR_headers
+encode(number, string) double number; char *string;
+#else
+encode(double number, char *string)
+#endif
+{
+	char *s = string, e[8];
+	double f;
+	int exp2, exp16, d, n;
+
+	if (number == 0. || number != number) {
+		s[0] = '0'; s[1] = '^'; s[2] = '0';
+		return 3;
+		}
+	if (number < 0.) {
+		*s++ = '-';
+		number = -number;
+		}
+
+	/* NUMBER = F * 2**EXP2 with 1/2 <= F < 1, and so NUMBER is
+	   F * 2**(EXP2 - 4*EXP16) * 16**EXP16 with the first factor in
+	   [1/16, 1). Scaling by powers of two is exact. */
+
+	f = frexp(number, &exp2);
+	exp16 = exp2 > 0 ? (exp2 + 3) / 4 : -(-exp2 / 4);
+	f = ldexp(f, exp2 - 4*exp16);
+	while (f != 0.) {
+		f *= 16.;
+		d = (int)f;
+		f -= d;
+		*s++ = digits[d];
+		}
+
+	*s++ = '^';
+	if (exp16 < 0) {
+		*s++ = '-';
+		exp16 = -exp16;
+		}
+	n = 0;
+	do {
+		e[n++] = digits[exp16 & 15];
+		exp16 >>= 4;
+		} while (exp16);
+	while (n)
+		*s++ = e[--n];
+	return (int)(s - string);
+	}
+
+/* Write the N numbers in DATA to Unit, one per record, each between
+   single quotes. The return value is N if the numbers were written,
+   zero if Unit is not connected for sequential formatted output that
+   is already under way or a number is infinite (nothing is written
+   then), and -1 if the write fails, in which case IOSTAT is set. */
+
+ integer
+#ifdef KR_headers
+zzxfrpt_(Unit, n, data, iostat) integer *Unit, *n, *iostat; doublereal *data;
+#else
+zzxfrpt_(integer *Unit, integer *n, doublereal *data, integer *iostat)
+#endif
+{
+	char buffer[4096];
+	unit *u;
+	FILE *f;
+	integer i;
+	int k = 0;
+
+	*iostat = 0;
+	if (*Unit >= MXUNIT || *Unit < 0 || *n < 1)
+		return 0;
+	u = &f__units[*Unit];
+	if ((f = u->ufd) == NULL || u->url != 0 || !u->ufmt
+	 || !(u->urw & 2) || u->uwrt != 1)
+		return 0;
+	for (i = 0; i < *n; i++)
+		if (data[i] - data[i] != 0. && data[i] == data[i])
+			return 0;
+
+	for (i = 0; i < *n; i++) {
+		if (k > (int)sizeof(buffer) - 32) {
+			if (fwrite(buffer, 1, (size_t)k, f) != (size_t)k)
+				goto bad;
+			k = 0;
+			}
+		buffer[k++] = '\'';
+		k += encode(data[i], buffer + k);
+		buffer[k++] = '\'';
+		buffer[k++] = '\n';
+		}
+	if (k && fwrite(buffer, 1, (size_t)k, f) != (size_t)k)
+		goto bad;
+	return *n;
+ bad:
+	*iostat = errno ? errno : 1;
+	return -1;
+	}
+
+/* Read up to N quoted strings from Unit into WORK, each blank padded
+   or truncated to WORK_LEN characters, and then skip the rest of the
+   record, as a list-directed read of N character items would. The
+   return value is:
+
+      N    if all N strings were read;
+
+      K    (0 <= K < N) if the next item is not a quoted string. The
+           first K strings were read and the stream is positioned at
+           the next item, which the caller should read with a
+           list-directed read;
+
+      -1   if Unit is not connected for sequential formatted input,
+           or the last operation on it was a write;
+
+      -2   if a string or the record ends at the end of the file. */
+
+ integer
+#ifdef KR_headers
+zzxfrgt_(Unit, n, work, work_len) integer *Unit, *n; char *work; ftnlen work_len;
+#else
+zzxfrgt_(integer *Unit, integer *n, char *work, ftnlen work_len)
+#endif
+{
+	unit *u;
+	FILE *f;
+	char *s;
+	integer i;
+	ftnlen k;
+	int ch;
+
+	if (*Unit >= MXUNIT || *Unit < 0 || *n < 1)
+		return -1;
+	u = &f__units[*Unit];
+	if ((f = u->ufd) == NULL || u->url != 0 || !u->ufmt
+	 || !(u->urw & 1) || u->uwrt || u->uend)
+		return -1;
+
+	for (i = 0; i < *n; i++) {
+		while ((ch = getc(f)) == ' ' || ch == '\t' || ch == '\n')
+			;
+		if (ch != '\'') {
+			if (ch != EOF)
+				ungetc(ch, f);
+			return i;
+			}
+		s = work + i * work_len;
+		k = 0;
+		while ((ch = getc(f)) != '\'') {
+			if (ch == EOF || ch == '\n')
+				goto eof;
+			if (k < work_len)
+				s[k++] = (char)ch;
+			}
+		while (k < work_len)
+			s[k++] = ' ';
+		}
+	while ((ch = getc(f)) != '\n')
+		if (ch == EOF)
+			goto eof;
+	return *n;
+ eof:
+	if (feof(f))
+		u->uend = 1;
+	return -2;
+	}
+
+/* Decode STRING, as written by DP2HX, into NUMBER. The return value
+   is FALSE, and NUMBER is unchanged, unless STRING is in the form
+   DP2HX writes and its value is a normal double precision number;
+   HX2DP must then be used. */
+
+ logical
+#ifdef KR_headers
+zzhx2dp_(string, number, string_len) char *string; doublereal *number; ftnlen string_len;
+#else
+zzhx2dp_(char *string, doublereal *number, ftnlen string_len)
+#endif
+{
+	char *s = string, *se = string + string_len;
+	unsigned long long m = 0;
+	int negtiv = 0, expneg = 0, nd = 0, exp16 = 0, ne = 0, d, exp2;
+	double x;
+
+	if (!tabled)
+		maketable();
+	if (s < se && *s == '-') {
+		negtiv = 1;
+		s++;
+		}
+	for (; s < se && (d = values[(unsigned char)*s]) >= 0; s++) {
+		if (++nd > 14)
+			return FALSE_;
+		m = m << 4 | (unsigned long long)d;
+		}
+	if (nd == 0 || s >= se || *s++ != '^')
+		return FALSE_;
+	if (s < se && *s == '-') {
+		expneg = 1;
+		s++;
+		}
+	for (; s < se && (d = values[(unsigned char)*s]) >= 0; s++) {
+		if (++ne > 4)
+			return FALSE_;
+		exp16 = exp16 << 4 | d;
+		}
+	if (ne == 0)
+		return FALSE_;
+	for (; s < se; s++)
+		if (*s != ' ')
+			return FALSE_;
+	if (m == 0) {
+		if (nd != 1 || exp16 != 0 || expneg || negtiv)
+			return FALSE_;
+		*number = 0.;
+		return TRUE_;
+		}
+	if (expneg)
+		exp16 = -exp16;
+
+	/* The value is M * 16**(EXP16 - ND). It is exact if M has at most
+	   53 significant bits and the result is a normal number. */
+
+	exp2 = 4 * (exp16 - nd);
+	while (!(m & 1)) {
+		m >>= 1;
+		exp2++;
+		}
+	if (m >> 53)
+		return FALSE_;
+	(void)frexp((double)m, &d);
+	if (d + exp2 < -1021 || d + exp2 > 1024)
+		return FALSE_;
+	x = ldexp((double)m, exp2);
+	*number = negtiv ? -x : x;
+	return TRUE_;
+	}
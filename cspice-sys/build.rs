@@ -9,6 +9,48 @@ const CSPICE_DIR: &str = "../cspice-fork";
 const CSPICE_CLANG_TARGET: &str = "CSPICE_CLANG_TARGET";
 const CSPICE_CLANG_ROOT: &str = "CSPICE_CLANG_ROOT";
 
+/// Sources in `<arch>/src/cspice` of the fork that have changed since the prebuilt libraries in
+/// `<arch>/lib` were generated. They are compiled and replace (or are added to) the members of a
+/// copy of the prebuilt library, so that the library linked always matches the sources. The list
+/// can be emptied when the libraries are regenerated with makeall.csh.
+const CHANGED_SOURCES: &[&str] = &[
+    "bodctr_c.c",
+    "conicv_c.c",
+    "dafana.c",
+    "dafgda.c",
+    "dafrda.c",
+    "dafrwd.c",
+    "dafwbs_c.c",
+    "dafwda.c",
+    "dasa2l.c",
+    "dasfm.c",
+    "dasrwr.c",
+    "dskmi2.c",
+    "dskmi2_c.c",
+    "ekpqry_c.c",
+    "ekqmgr.c",
+    "prop2v_c.c",
+    "rdencd.c",
+    "rdtext.c",
+    "sgp4ev_c.c",
+    "sgp4in_c.c",
+    "spksub.c",
+    "trcmod_c.c",
+    "trcpkg.c",
+    "wrencd.c",
+    "zzbodtrn.c",
+    "zzdafcpa.c",
+    "zzdafwrn.c",
+    "zzdasrdn.c",
+    "zzekjhsh.c",
+    "zzekjtst.c",
+    "zzmkspin.c",
+    "zzprop2v.c",
+    "zzrdlin.c",
+    "zzsgp4.c",
+    "zzxfrio.c",
+];
+
 fn main() {
     let out_path = PathBuf::from(env::var("OUT_DIR").unwrap());
     if std::env::var("DOCS_RS").is_ok() {
@@ -19,6 +61,7 @@ fn main() {
     println!("cargo:rerun-if-env-changed={}", CSPICE_CLANG_TARGET);
     println!("cargo:rerun-if-env-changed={}", CSPICE_CLANG_ROOT);
 
+    let from_fork = Path::new(CSPICE_DIR).is_dir();
     let cspice_dir = PathBuf::from_str(CSPICE_DIR).ok().or_else(locate_cspice);
 
     #[cfg(feature = "downloadcspice")]
@@ -76,13 +119,63 @@ fn main() {
         .write_to_file(out_path.join("bindgen.rs"))
         .expect("Couldn't write bindings!");
 
-    println!(
-        "cargo:rustc-link-search=native={}",
-        cspice_dir.join("lib").display()
-    );
+    let lib_dir = if from_fork && env::var("DOCS_RS").is_err() {
+        build_changed_sources(&cspice_dir, &out_path)
+    } else {
+        cspice_dir.join("lib")
+    };
+    println!("cargo:rustc-link-search=native={}", lib_dir.display());
     println!("cargo:rustc-link-lib=static=cspice");
 }
 
+// Copy the prebuilt library to `<out_dir>/lib`, compile CHANGED_SOURCES with the options used by
+// mkprodct.csh and put them in the copy, returning its directory
+fn build_changed_sources(cspice_dir: &Path, out_dir: &Path) -> PathBuf {
+    println!("cargo:rerun-if-env-changed=CC");
+    println!("cargo:rerun-if-env-changed=AR");
+    let lib_dir = out_dir.join("lib");
+    let obj_dir = out_dir.join("obj");
+    fs::create_dir_all(&lib_dir).expect("Unable to create library directory");
+    fs::create_dir_all(&obj_dir).expect("Unable to create object directory");
+    let library = lib_dir.join("libcspice.a");
+    fs::copy(cspice_dir.join("lib").join("libcspice.a"), &library)
+        .expect("Unable to copy the prebuilt CSPICE library");
+    let src_dir = cspice_dir.join("src").join("cspice");
+    let compiler = env::var("CC").unwrap_or_else(|_| "cc".to_string());
+    let compiling: Vec<_> = CHANGED_SOURCES
+        .iter()
+        .map(|source| {
+            let object = obj_dir.join(Path::new(source).with_extension("o"));
+            let child = Command::new(&compiler)
+                .args(["-c", "-ansi", "-O2", "-fPIC", "-DNON_UNIX_STDIO"])
+                .arg("-I")
+                .arg(&src_dir)
+                .arg(src_dir.join(source))
+                .arg("-o")
+                .arg(&object)
+                .spawn()
+                .expect("Unable to run the C compiler");
+            (source, object, child)
+        })
+        .collect();
+    let mut objects = Vec::with_capacity(compiling.len());
+    for (source, object, mut child) in compiling {
+        let status = child.wait().expect("Unable to run the C compiler");
+        assert!(status.success(), "Failed to compile {source}");
+        objects.push(object);
+    }
+
+    let archiver = env::var("AR").unwrap_or_else(|_| "ar".to_string());
+    let status = Command::new(archiver)
+        .arg("rs")
+        .arg(&library)
+        .args(&objects)
+        .status()
+        .expect("Unable to run ar");
+    assert!(status.success(), "Failed to update the CSPICE library");
+    lib_dir
+}
+
 // Check for CSPICE installation in system library folders
 fn locate_cspice() -> Option<PathBuf> {
     match env::consts::OS {
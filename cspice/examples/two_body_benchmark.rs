@@ -0,0 +1,63 @@
+//! Compares the time taken to propagate many states with prop2b_c one at a time, with the batch
+//! propagator and with the batch propagator on every available thread.
+//!
+//! Run with `cargo run --release --example two_body_benchmark [number of states]`.
+use cspice::spk::State;
+use cspice::two_body::{propagate, propagate_batch, propagate_parallel, StateArrays};
+use std::thread;
+use std::time::Instant;
+
+const GM: f64 = 398600.4418;
+
+fn main() {
+    let len = std::env::args()
+        .nth(1)
+        .map_or(1_000_000, |arg| arg.parse().expect("number of states"));
+    let threads = thread::available_parallelism().map_or(1, |n| n.get());
+
+    let mut seed: u64 = 1;
+    let mut next = || {
+        seed = seed
+            .wrapping_mul(6364136223846793005)
+            .wrapping_add(1442695040888963407);
+        (seed >> 11) as f64 / (1u64 << 53) as f64 * 2.0 - 1.0
+    };
+    let states: Vec<State> = (0..len)
+        .map(|_| {
+            let radius = 6600.0 + 30000.0 * next().abs();
+            State::from([
+                radius * next(),
+                radius * next(),
+                radius * next(),
+                8.0 * next(),
+                8.0 * next(),
+                8.0 * next(),
+            ])
+        })
+        .collect();
+    let arrays = StateArrays::from_states(&states);
+
+    for dt in [60.0, 86400.0] {
+        let start = Instant::now();
+        let scalar: Vec<State> = states
+            .iter()
+            .map(|state| propagate(GM, state, dt).unwrap())
+            .collect();
+        let scalar_time = start.elapsed();
+
+        let start = Instant::now();
+        let batch = propagate_batch(GM, &arrays, dt).unwrap();
+        let batch_time = start.elapsed();
+
+        let start = Instant::now();
+        let parallel = propagate_parallel(GM, &arrays, dt, threads).unwrap();
+        let parallel_time = start.elapsed();
+
+        assert_eq!(batch.to_states(), scalar);
+        assert_eq!(parallel, batch);
+        println!(
+            "dt = {dt} s, {len} states: prop2b_c {scalar_time:?}, batch {batch_time:?}, \
+             {threads} threads {parallel_time:?}"
+        );
+    }
+}
@@ -0,0 +1,147 @@
+//! Translating between body names and NAIF integer IDs.
+//!
+//! Functions taking a body name translate it on every call. A [BodyResolver] remembers the
+//! translation of each name it has been given, so that names used repeatedly, for example in a
+//! loop over times, can be translated once and the ID-based functions such as
+//! [easy_reader()](crate::spk::easy_reader) used instead.
+use crate::error::get_last_error;
+use crate::string::{SpiceStr, StringParam};
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{bodc2n_c, bodctr_c, bods2c_c, SpiceBoolean, SpiceInt, SPICEFALSE};
+use derive_more::{From, Into};
+use std::collections::HashMap;
+
+/// Length of the buffer for body names.
+const BDNMLN: usize = 37;
+
+/// The NAIF integer ID of a body.
+#[derive(Copy, Clone, Debug, PartialEq, Eq, Hash, PartialOrd, Ord, From, Into)]
+pub struct BodyId(pub SpiceInt);
+
+impl BodyId {
+    /// Translate a body name, or a string representation of an integer, to an ID. Returns `None`
+    /// if the name is not known.
+    ///
+    /// See [bods2c_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/bods2c_c.html).
+    pub fn from_name<'n, N: Into<StringParam<'n>>>(name: N) -> Result<Option<Self>, Error> {
+        with_spice_lock_or_panic(|| {
+            let mut code = 0;
+            let mut found: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+            unsafe { bods2c_c(name.into().as_mut_ptr(), &mut code, &mut found) };
+            get_last_error()?;
+            Ok((found != SPICEFALSE as SpiceBoolean).then_some(Self(code)))
+        })
+    }
+
+    /// The name of the body, if one is known.
+    ///
+    /// See [bodc2n_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/bodc2n_c.html).
+    pub fn name(self) -> Result<Option<String>, Error> {
+        with_spice_lock_or_panic(|| {
+            let mut buffer = [0; BDNMLN];
+            let mut found: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+            unsafe {
+                bodc2n_c(
+                    self.0,
+                    buffer.len() as SpiceInt,
+                    buffer.as_mut_ptr(),
+                    &mut found,
+                )
+            };
+            get_last_error()?;
+            Ok((found != SPICEFALSE as SpiceBoolean)
+                .then(|| SpiceStr::from_buffer(&buffer).to_string()))
+        })
+    }
+}
+
+/// Translates body names to IDs, remembering each translation until the body name-code mappings
+/// change.
+///
+/// Names are remembered exactly as given, so `"moon"` and `"MOON"` are translated separately.
+#[derive(Clone, Debug)]
+pub struct BodyResolver {
+    counter: [SpiceInt; 2],
+    ids: HashMap<String, Option<BodyId>>,
+}
+
+impl Default for BodyResolver {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl BodyResolver {
+    pub fn new() -> Self {
+        Self {
+            // Never a value of the state counter, so the first check reports an update
+            counter: [SpiceInt::MAX; 2],
+            ids: HashMap::new(),
+        }
+    }
+
+    /// Translate a body name, or a string representation of an integer, to an ID. Returns `None`
+    /// if the name is not known.
+    ///
+    /// See [bodctr_c](https://github.com/jacob-pro/cspice-rs/blob/master/cspice-fork/src/cspice/bodctr_c.c).
+    pub fn resolve(&mut self, name: &str) -> Result<Option<BodyId>, Error> {
+        with_spice_lock_or_panic(|| {
+            let mut update: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+            unsafe { bodctr_c(self.counter.as_mut_ptr(), &mut update) };
+            get_last_error()?;
+            if update != SPICEFALSE as SpiceBoolean {
+                self.ids.clear();
+            }
+            if let Some(&id) = self.ids.get(name) {
+                return Ok(id);
+            }
+            let id = BodyId::from_name(name)?;
+            self.ids.insert(name.to_string(), id);
+            Ok(id)
+        })
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::data::pool::{put_variable, PoolValues};
+    use crate::string::{static_spice_str, StaticSpiceStr};
+    use crate::tests::load_test_data;
+    use cspice_sys::dvpool_c;
+
+    #[test]
+    fn test_body_resolver() {
+        load_test_data();
+        assert_eq!(BodyId::from_name("moon").unwrap(), Some(BodyId(301)));
+        assert_eq!(BodyId(399).name().unwrap(), Some("EARTH".to_string()));
+
+        let mut resolver = BodyResolver::new();
+        assert_eq!(resolver.resolve("moon").unwrap(), Some(BodyId(301)));
+        assert_eq!(resolver.resolve(" Moon ").unwrap(), Some(BodyId(301)));
+        assert_eq!(resolver.resolve("moon").unwrap(), Some(BodyId(301)));
+        assert_eq!(resolver.resolve("499").unwrap(), Some(BodyId(499)));
+        assert_eq!(resolver.resolve("TEST BODY").unwrap(), None);
+
+        // Defining a name in the kernel pool must be seen by a resolver that has already
+        // translated it
+        put_variable(
+            "NAIF_BODY_NAME",
+            &PoolValues::Character(vec!["TEST BODY".to_string()]),
+        )
+        .unwrap();
+        put_variable("NAIF_BODY_CODE", &PoolValues::Numeric(vec![-999.0])).unwrap();
+        assert_eq!(resolver.resolve("TEST BODY").unwrap(), Some(BodyId(-999)));
+        assert_eq!(resolver.resolve("test  body").unwrap(), Some(BodyId(-999)));
+        assert_eq!(BodyId(-999).name().unwrap(), Some("TEST BODY".to_string()));
+
+        // Removing it again must be seen too, and leaves the pool as the other tests expect
+        with_spice_lock_or_panic(|| unsafe {
+            dvpool_c(static_spice_str!("NAIF_BODY_NAME").as_mut_ptr());
+            dvpool_c(static_spice_str!("NAIF_BODY_CODE").as_mut_ptr());
+        });
+        get_last_error().unwrap();
+        assert_eq!(resolver.resolve("TEST BODY").unwrap(), None);
+        assert_eq!(BodyId(-999).name().unwrap(), None);
+    }
+}
@@ -5,10 +5,10 @@ use crate::string::StringParam;
 use crate::{with_spice_lock_or_panic, Error};
 use cspice_sys::{
     _SpiceDataType_SPICE_CHR, _SpiceDataType_SPICE_DP, _SpiceDataType_SPICE_INT, appndc_c,
-    appndd_c, appndi_c, card_c, copy_c, scard_c, wncard_c, wncomd_c, wncond_c, wndifd_c, wnelmd_c,
-    wnexpd_c, wnextd_c, wnfetd_c, wnfild_c, wnfltd_c, wnincd_c, wninsd_c, wnintd_c, wnreld_c,
-    wnsumd_c, wnunid_c, wnvald_c, SpiceBoolean, SpiceChar, SpiceDouble, SpiceInt, SPICEFALSE,
-    SPICETRUE, SPICE_CELL_CTRLSZ,
+    appndd_c, appndi_c, card_c, copy_c, scard_c, size_c, wncard_c, wncomd_c, wncond_c, wndifd_c,
+    wnelmd_c, wnexpd_c, wnextd_c, wnfetd_c, wnfild_c, wnfltd_c, wnincd_c, wninsd_c, wnintd_c,
+    wnreld_c, wnsumd_c, wnunid_c, wnvald_c, SpiceBoolean, SpiceChar, SpiceDouble, SpiceInt,
+    SPICEFALSE, SPICETRUE, SPICE_CELL_CTRLSZ,
 };
 use std::ffi::c_void;
 
@@ -47,7 +47,7 @@ impl<T: CellType> Cell<T> {
     /// See [size_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/size_c.html)
     pub fn get_size(&mut self) -> Result<usize, Error> {
         with_spice_lock_or_panic(|| {
-            let out = unsafe { card_c(self.as_mut_cell()) };
+            let out = unsafe { size_c(self.as_mut_cell()) };
             get_last_error()?;
             Ok(out as usize)
         })
@@ -104,6 +104,12 @@ impl Cell<SpiceDouble> {
             get_last_error()
         })
     }
+
+    /// The elements of a double precision cell, in order.
+    pub fn elements(&self) -> &[SpiceDouble] {
+        let start = SPICE_CELL_CTRLSZ as usize;
+        &self.data[start..start + self.cell.card as usize]
+    }
 }
 
 impl Cell<SpiceInt> {
@@ -135,6 +141,12 @@ impl Cell<SpiceInt> {
             get_last_error()
         })
     }
+
+    /// The elements of an integer cell, in order.
+    pub fn elements(&self) -> &[SpiceInt] {
+        let start = SPICE_CELL_CTRLSZ as usize;
+        &self.data[start..start + self.cell.card as usize]
+    }
 }
 
 impl Cell<SpiceChar> {
@@ -433,3 +445,27 @@ impl Cell<SpiceDouble> {
         })
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_size_and_cardinality() {
+        let mut doubles = Cell::new_double(10);
+        doubles.append(1.0).unwrap();
+        doubles.append(2.0).unwrap();
+        doubles.append(3.0).unwrap();
+        assert_eq!(doubles.get_size().unwrap(), 10);
+        assert_eq!(doubles.get_cardinality().unwrap(), 3);
+
+        let mut ints = Cell::new_int(4);
+        ints.append(1).unwrap();
+        assert_eq!(ints.get_size().unwrap(), 4);
+        assert_eq!(ints.get_cardinality().unwrap(), 1);
+
+        let mut chars = Cell::new_char(5, 8);
+        assert_eq!(chars.get_size().unwrap(), 5);
+        assert_eq!(chars.get_cardinality().unwrap(), 0);
+    }
+}
@@ -0,0 +1,618 @@
+//! Fitting Chebyshev expansions to trajectories, and writing them as SPK type 2 and 3 or PCK type
+//! 2 segments.
+//!
+//! [ChebyshevFit::fit()] samples a state function, such as an integrator or a lookup into a dense
+//! SPK product, and fits an expansion to each record interval, halving the interval length where
+//! the fit does not meet the tolerances. Intervals are fitted in parallel. The SPK type 2 and 3
+//! formats need records of equal length within a segment, so the span is divided into blocks of
+//! the initial interval length, each block is split as finely as it needs, and consecutive blocks
+//! split the same way are written as one segment.
+use crate::error::get_last_error;
+use crate::spk::State;
+use crate::string::SpiceString;
+use crate::time::Et;
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{
+    pckcls_c, pckopn_c, pckw02_c, spkcls_c, spkopn_c, spkw02_c, spkw03_c, SpiceDouble, SpiceInt,
+};
+use std::f64::consts::PI;
+use std::path::Path;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::Mutex;
+use std::thread;
+
+/// The highest degree the SPK and PCK type 2 and 3 writers accept.
+pub const MAX_DEGREE: usize = 27;
+
+/// The most times an interval may be halved, which keeps the record count of a block within a
+/// 32-bit `usize`.
+pub const MAX_SPLITS: u32 = 30;
+
+/// The quantities an expansion represents.
+#[derive(Copy, Clone, Debug, PartialEq, Eq)]
+pub enum FitKind {
+    /// Position only, written as SPK type 2 or PCK type 2. Velocity is the derivative of the
+    /// position expansion.
+    Position,
+    /// Position and velocity, fitted separately and written as SPK type 3.
+    State,
+}
+
+impl FitKind {
+    fn components(self) -> usize {
+        match self {
+            FitKind::Position => 3,
+            FitKind::State => 6,
+        }
+    }
+}
+
+/// How to fit a trajectory.
+#[derive(Clone, Debug, PartialEq)]
+pub struct FitOptions {
+    pub kind: FitKind,
+    /// The degree of each expansion, at most [MAX_DEGREE].
+    pub degree: usize,
+    /// The longest record interval, in seconds.
+    pub interval: SpiceDouble,
+    /// The largest allowed position error, in km (or radians for PCK Euler angles).
+    pub position_tolerance: SpiceDouble,
+    /// The largest allowed velocity error, in km/s (or radians/s).
+    pub velocity_tolerance: SpiceDouble,
+    /// The number of times an interval may be halved to meet the tolerances, at most
+    /// [MAX_SPLITS].
+    pub max_splits: u32,
+    /// The number of threads to fit intervals on.
+    pub threads: usize,
+}
+
+impl FitOptions {
+    /// Options with no velocity tolerance, up to 8 halvings of `interval`, and one thread for each
+    /// available CPU.
+    pub fn new(
+        kind: FitKind,
+        degree: usize,
+        interval: SpiceDouble,
+        position_tolerance: SpiceDouble,
+    ) -> Self {
+        Self {
+            kind,
+            degree,
+            interval,
+            position_tolerance,
+            velocity_tolerance: SpiceDouble::INFINITY,
+            max_splits: 8,
+            threads: thread::available_parallelism().map_or(1, |n| n.get()),
+        }
+    }
+}
+
+/// A run of records of equal length, written as one segment.
+#[derive(Clone, Debug, PartialEq)]
+pub struct FitSegment {
+    first: SpiceDouble,
+    last: SpiceDouble,
+    interval: SpiceDouble,
+    coefficients: Vec<SpiceDouble>,
+    max_position_error: SpiceDouble,
+    max_velocity_error: SpiceDouble,
+}
+
+impl FitSegment {
+    /// The start of the segment's coverage, which is also the start of its first record.
+    pub fn first(&self) -> Et {
+        Et(self.first)
+    }
+
+    /// The end of the segment's coverage.
+    pub fn last(&self) -> Et {
+        Et(self.last)
+    }
+
+    /// The length of each record interval, in seconds.
+    pub fn interval(&self) -> SpiceDouble {
+        self.interval
+    }
+
+    /// The coefficients of every record, in the layout spkw02_c and spkw03_c take: for each
+    /// record, the coefficients of x, y and z (then of dx/dt, dy/dt and dz/dt for SPK type 3).
+    pub fn coefficients(&self) -> &[SpiceDouble] {
+        &self.coefficients
+    }
+
+    /// The largest position error found at the check points of the segment's records.
+    pub fn max_position_error(&self) -> SpiceDouble {
+        self.max_position_error
+    }
+
+    /// The largest velocity error found at the check points of the segment's records.
+    pub fn max_velocity_error(&self) -> SpiceDouble {
+        self.max_velocity_error
+    }
+}
+
+/// One block of the span, fitted at `splits` halvings of the block length.
+struct Block {
+    splits: u32,
+    coefficients: Vec<SpiceDouble>,
+    max_position_error: SpiceDouble,
+    max_velocity_error: SpiceDouble,
+}
+
+/// Chebyshev expansions fitted to a trajectory, divided into segments.
+#[derive(Clone, Debug, PartialEq)]
+pub struct ChebyshevFit {
+    kind: FitKind,
+    degree: usize,
+    segments: Vec<FitSegment>,
+}
+
+impl ChebyshevFit {
+    /// Fit expansions to the states `function` gives from `start` to `end`.
+    ///
+    /// `function` is called from several threads at once. Functions that call SPICE, such as one
+    /// looking up the states of a type 13 SPK with
+    /// [geometric_state()](crate::spk::geometric_state), must wrap the calls in
+    /// [with_spice_lock()](crate::with_spice_lock). The calls are then serialized, but the
+    /// fitting still runs in parallel.
+    ///
+    /// The expansions are fitted through the Chebyshev-Gauss nodes of each interval and checked at
+    /// the points midway between them and at both ends. If an interval cannot meet the tolerances
+    /// within `max_splits` halvings, the error is SPICE(TOLERANCENOTMET).
+    pub fn fit<F>(start: Et, end: Et, options: &FitOptions, function: F) -> Result<Self, Error>
+    where
+        F: Fn(Et) -> Result<State, Error> + Sync,
+    {
+        if options.degree > MAX_DEGREE {
+            return Err(Error::new(
+                "SPICE(INVALIDDEGREE)",
+                format!(
+                    "The degree {} exceeds the maximum degree {}.",
+                    options.degree, MAX_DEGREE
+                ),
+            ));
+        }
+        if options.max_splits > MAX_SPLITS {
+            return Err(Error::new(
+                "SPICE(VALUEOUTOFRANGE)",
+                format!(
+                    "The maximum number of halvings {} exceeds {}.",
+                    options.max_splits, MAX_SPLITS
+                ),
+            ));
+        }
+        if options.interval.is_nan() || options.interval <= 0.0 {
+            return Err(Error::new(
+                "SPICE(INTLENNOTPOS)",
+                format!("The interval length {} is not positive.", options.interval),
+            ));
+        }
+        if start.0.is_nan() || end.0.is_nan() || start.0 >= end.0 {
+            return Err(Error::new(
+                "SPICE(BADDESCRTIMES)",
+                format!(
+                    "The start time {} is not before the end time {}.",
+                    start.0, end.0
+                ),
+            ));
+        }
+        // Blocks tile the span exactly, so no state outside it is needed
+        let blocks = ((end.0 - start.0) / options.interval).ceil().max(1.0) as usize;
+        let length = (end.0 - start.0) / blocks as SpiceDouble;
+
+        let next = AtomicUsize::new(0);
+        let fitted = Mutex::new(Vec::with_capacity(blocks));
+        let errors = Mutex::new(Vec::new());
+        thread::scope(|scope| {
+            for _ in 0..options.threads.clamp(1, blocks) {
+                scope.spawn(|| loop {
+                    let index = next.fetch_add(1, Ordering::Relaxed);
+                    if index >= blocks || !errors.lock().unwrap().is_empty() {
+                        break;
+                    }
+                    let first = start.0 + index as SpiceDouble * length;
+                    match fit_block(first, length, options, &function) {
+                        Ok(block) => fitted.lock().unwrap().push((index, block)),
+                        Err(error) => errors.lock().unwrap().push((index, error)),
+                    }
+                });
+            }
+        });
+        let mut errors = errors.into_inner().unwrap();
+        errors.sort_by_key(|(index, _)| *index);
+        if let Some((_, error)) = errors.into_iter().next() {
+            return Err(error);
+        }
+        let mut fitted = fitted.into_inner().unwrap();
+        fitted.sort_by_key(|(index, _)| *index);
+
+        let mut segments: Vec<FitSegment> = Vec::new();
+        let mut previous_splits = None;
+        for (index, block) in fitted {
+            let interval = length / (1u64 << block.splits) as SpiceDouble;
+            let last = if index + 1 == blocks {
+                end.0
+            } else {
+                start.0 + (index + 1) as SpiceDouble * length
+            };
+            match segments.last_mut() {
+                Some(segment) if previous_splits == Some(block.splits) => {
+                    segment.last = last;
+                    segment.coefficients.extend(block.coefficients);
+                    segment.max_position_error =
+                        segment.max_position_error.max(block.max_position_error);
+                    segment.max_velocity_error =
+                        segment.max_velocity_error.max(block.max_velocity_error);
+                }
+                _ => segments.push(FitSegment {
+                    first: start.0 + index as SpiceDouble * length,
+                    last,
+                    interval,
+                    coefficients: block.coefficients,
+                    max_position_error: block.max_position_error,
+                    max_velocity_error: block.max_velocity_error,
+                }),
+            }
+            previous_splits = Some(block.splits);
+        }
+        Ok(Self {
+            kind: options.kind,
+            degree: options.degree,
+            segments,
+        })
+    }
+
+    /// The quantities the expansions represent.
+    pub fn kind(&self) -> FitKind {
+        self.kind
+    }
+
+    /// The degree of the expansions.
+    pub fn degree(&self) -> usize {
+        self.degree
+    }
+
+    /// The segments, in order of time.
+    pub fn segments(&self) -> &[FitSegment] {
+        &self.segments
+    }
+
+    /// Evaluate the expansions at `et`, as an SPK or PCK reader would. Returns `None` if `et` is
+    /// outside the span that was fitted.
+    pub fn state(&self, et: Et) -> Option<State> {
+        let segment = self
+            .segments
+            .iter()
+            .find(|segment| segment.first <= et.0 && et.0 <= segment.last)?;
+        let size = self.kind.components() * (self.degree + 1);
+        let records = segment.coefficients.len() / size;
+        let record = (((et.0 - segment.first) / segment.interval) as usize).min(records - 1);
+        let radius = segment.interval / 2.0;
+        let mid = segment.first + record as SpiceDouble * segment.interval + radius;
+        Some(evaluate(
+            self.kind,
+            &segment.coefficients[record * size..(record + 1) * size],
+            (et.0 - mid) / radius,
+            radius,
+        ))
+    }
+
+    /// Write the expansions to a new SPK file, as type 2 segments for [FitKind::Position] or type
+    /// 3 segments for [FitKind::State], giving the state of `body` relative to `center` in
+    /// `frame`.
+    ///
+    /// See [spkw02_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkw02_c.html) and
+    /// [spkw03_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkw03_c.html).
+    pub fn write_spk<P: AsRef<Path>>(
+        &self,
+        path: P,
+        body: SpiceInt,
+        center: SpiceInt,
+        frame: &str,
+        segment_id: &str,
+    ) -> Result<(), Error> {
+        let path = SpiceString::from(path.as_ref().to_string_lossy());
+        let frame = SpiceString::from(frame);
+        let segment_id = SpiceString::from(segment_id);
+        with_spice_lock_or_panic(|| {
+            let mut handle = 0;
+            unsafe { spkopn_c(path.as_mut_ptr(), segment_id.as_mut_ptr(), 0, &mut handle) };
+            get_last_error()?;
+            let writer = match self.kind {
+                FitKind::Position => spkw02_c,
+                FitKind::State => spkw03_c,
+            };
+            let result = self.segments.iter().try_for_each(|segment| {
+                unsafe {
+                    writer(
+                        handle,
+                        body,
+                        center,
+                        frame.as_mut_ptr(),
+                        segment.first,
+                        segment.last,
+                        segment_id.as_mut_ptr(),
+                        segment.interval,
+                        self.records(segment),
+                        self.degree as SpiceInt,
+                        segment.coefficients.as_ptr(),
+                        segment.first,
+                    )
+                };
+                get_last_error()
+            });
+            unsafe { spkcls_c(handle) };
+            result?;
+            get_last_error()
+        })
+    }
+
+    /// Write [FitKind::Position] expansions of Euler angles to a new PCK file, as type 2 segments
+    /// giving the orientation of the frame with class ID `class_id` relative to `frame`.
+    ///
+    /// See [pckw02_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/pckw02_c.html).
+    pub fn write_pck<P: AsRef<Path>>(
+        &self,
+        path: P,
+        class_id: SpiceInt,
+        frame: &str,
+        segment_id: &str,
+    ) -> Result<(), Error> {
+        if self.kind != FitKind::Position {
+            return Err(Error::new(
+                "SPICE(INVALIDTYPE)",
+                "PCK type 2 segments hold expansions of the angles only.",
+            ));
+        }
+        let path = SpiceString::from(path.as_ref().to_string_lossy());
+        let frame = SpiceString::from(frame);
+        let segment_id = SpiceString::from(segment_id);
+        with_spice_lock_or_panic(|| {
+            let mut handle = 0;
+            unsafe { pckopn_c(path.as_mut_ptr(), segment_id.as_mut_ptr(), 0, &mut handle) };
+            get_last_error()?;
+            let result = self.segments.iter().try_for_each(|segment| {
+                unsafe {
+                    pckw02_c(
+                        handle,
+                        class_id,
+                        frame.as_mut_ptr(),
+                        segment.first,
+                        segment.last,
+                        segment_id.as_mut_ptr(),
+                        segment.interval,
+                        self.records(segment),
+                        self.degree as SpiceInt,
+                        segment.coefficients.as_ptr() as *mut SpiceDouble,
+                        segment.first,
+                    )
+                };
+                get_last_error()
+            });
+            unsafe { pckcls_c(handle) };
+            result?;
+            get_last_error()
+        })
+    }
+
+    fn records(&self, segment: &FitSegment) -> SpiceInt {
+        (segment.coefficients.len() / (self.kind.components() * (self.degree + 1))) as SpiceInt
+    }
+}
+
+/// Fit one block, halving its intervals until every one of them meets the tolerances.
+fn fit_block<F>(
+    first: SpiceDouble,
+    length: SpiceDouble,
+    options: &FitOptions,
+    function: &F,
+) -> Result<Block, Error>
+where
+    F: Fn(Et) -> Result<State, Error>,
+{
+    let mut worst = (0.0, 0.0, first);
+    for splits in 0..=options.max_splits {
+        let count = 1usize << splits;
+        let radius = length / count as SpiceDouble / 2.0;
+        let mut block = Block {
+            splits,
+            coefficients: Vec::new(),
+            max_position_error: 0.0,
+            max_velocity_error: 0.0,
+        };
+        let mut met = true;
+        for record in 0..count {
+            let mid = first + (2 * record + 1) as SpiceDouble * radius;
+            let (coefficients, position_error, velocity_error) =
+                fit_interval(mid, radius, options, function)?;
+            if position_error > options.position_tolerance
+                || velocity_error > options.velocity_tolerance
+            {
+                worst = (position_error, velocity_error, mid - radius);
+                met = false;
+                break;
+            }
+            block.coefficients.extend(coefficients);
+            block.max_position_error = block.max_position_error.max(position_error);
+            block.max_velocity_error = block.max_velocity_error.max(velocity_error);
+        }
+        if met {
+            return Ok(block);
+        }
+    }
+    Err(Error::new(
+        "SPICE(TOLERANCENOTMET)",
+        format!(
+            "The fit to the interval starting at {} has a position error of {} and a velocity \
+             error of {} after {} halvings of the interval length.",
+            worst.2, worst.0, worst.1, options.max_splits
+        ),
+    ))
+}
+
+/// Fit the expansions of one interval, returning them with the largest position and velocity
+/// errors at the check points.
+fn fit_interval<F>(
+    mid: SpiceDouble,
+    radius: SpiceDouble,
+    options: &FitOptions,
+    function: &F,
+) -> Result<(Vec<SpiceDouble>, SpiceDouble, SpiceDouble), Error>
+where
+    F: Fn(Et) -> Result<State, Error>,
+{
+    let n = options.degree + 1;
+    let components = options.kind.components();
+    let mut samples = Vec::with_capacity(n);
+    for k in 0..n {
+        let x = (PI * (k as SpiceDouble + 0.5) / n as SpiceDouble).cos();
+        samples.push(state_array(&function(Et(mid + radius * x))?));
+    }
+    let mut coefficients = vec![0.0; components * n];
+    for c in 0..components {
+        for j in 0..n {
+            let sum: SpiceDouble = samples
+                .iter()
+                .enumerate()
+                .map(|(k, sample)| {
+                    sample[c]
+                        * (PI * j as SpiceDouble * (k as SpiceDouble + 0.5) / n as SpiceDouble)
+                            .cos()
+                })
+                .sum();
+            coefficients[c * n + j] = sum * if j == 0 { 1.0 } else { 2.0 } / n as SpiceDouble;
+        }
+    }
+
+    let (mut position_error, mut velocity_error): (SpiceDouble, SpiceDouble) = (0.0, 0.0);
+    for j in 0..=n {
+        let x = (PI * j as SpiceDouble / n as SpiceDouble).cos();
+        let expected = state_array(&function(Et(mid + radius * x))?);
+        let fitted = state_array(&evaluate(options.kind, &coefficients, x, radius));
+        let error = |range: std::ops::Range<usize>| {
+            range
+                .map(|i| (fitted[i] - expected[i]).powi(2))
+                .sum::<SpiceDouble>()
+                .sqrt()
+        };
+        position_error = position_error.max(error(0..3));
+        velocity_error = velocity_error.max(error(3..6));
+    }
+    Ok((coefficients, position_error, velocity_error))
+}
+
+/// Evaluate the expansions of one record at `x`, scaled to [-1, 1] over the record interval.
+fn evaluate(
+    kind: FitKind,
+    coefficients: &[SpiceDouble],
+    x: SpiceDouble,
+    radius: SpiceDouble,
+) -> State {
+    let n = coefficients.len() / kind.components();
+    let mut state = [0.0; 6];
+    for c in 0..3 {
+        let (value, derivative) = chebyshev(&coefficients[c * n..(c + 1) * n], x);
+        state[c] = value;
+        state[c + 3] = match kind {
+            FitKind::Position => derivative / radius,
+            FitKind::State => chebyshev(&coefficients[(c + 3) * n..(c + 4) * n], x).0,
+        };
+    }
+    State::from(state)
+}
+
+/// The value and derivative of a Chebyshev expansion, by the recurrences chbder_c uses.
+fn chebyshev(coefficients: &[SpiceDouble], x: SpiceDouble) -> (SpiceDouble, SpiceDouble) {
+    let (mut t0, mut t1) = (1.0, x);
+    let (mut d0, mut d1) = (0.0, 1.0);
+    let mut value = coefficients[0];
+    let mut derivative = 0.0;
+    for &c in &coefficients[1..] {
+        value += c * t1;
+        derivative += c * d1;
+        let t2 = 2.0 * x * t1 - t0;
+        let d2 = 2.0 * t1 + 2.0 * x * d1 - d0;
+        (t0, t1, d0, d1) = (t1, t2, d1, d2);
+    }
+    (value, derivative)
+}
+
+fn state_array(state: &State) -> [SpiceDouble; 6] {
+    [
+        state.position.x,
+        state.position.y,
+        state.position.z,
+        state.velocity.0[0],
+        state.velocity.0[1],
+        state.velocity.0[2],
+    ]
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::tests::load_test_data;
+
+    fn moon(et: Et) -> Result<State, Error> {
+        crate::with_spice_lock(|| crate::spk::geometric_state(301, et, "J2000", 399))
+            .map(|(state, _)| state)
+    }
+
+    #[test]
+    fn test_fit() {
+        load_test_data();
+        let (start, end) = (Et(0.0), Et(10.0 * 86400.0));
+
+        let mut options = FitOptions::new(FitKind::State, 11, 4.0 * 86400.0, 1e-3);
+        options.threads = 3;
+        let fit = ChebyshevFit::fit(start, end, &options, moon).unwrap();
+        assert_eq!(fit.segments().len(), 1);
+        let segment = &fit.segments()[0];
+        assert!(segment.interval() <= 10.0 * 86400.0 / 3.0);
+        assert!(segment.max_position_error() <= 1e-3);
+
+        // A low degree forces the intervals to be halved
+        options.kind = FitKind::Position;
+        options.degree = 5;
+        options.velocity_tolerance = 1e-6;
+        let coarse = ChebyshevFit::fit(start, end, &options, moon).unwrap();
+        assert!(coarse.segments()[0].interval() < segment.interval());
+
+        let path = std::env::temp_dir().join(format!("cspice-fit-{}.bsp", std::process::id()));
+        let _ = std::fs::remove_file(&path);
+        fit.write_spk(&path, -1301, 399, "J2000", "MOON FIT")
+            .unwrap();
+        let path = path.to_string_lossy().to_string();
+        crate::data::furnish(&path).unwrap();
+        for i in 0..=100 {
+            let et = Et(i as SpiceDouble * 8640.0);
+            let (written, _) = crate::spk::geometric_state(-1301, et, "J2000", 399).unwrap();
+            let expected = moon(et).unwrap();
+            let fitted = fit.state(et).unwrap();
+            let difference = |a: &State, b: &State| {
+                ((a.position.x - b.position.x).powi(2)
+                    + (a.position.y - b.position.y).powi(2)
+                    + (a.position.z - b.position.z).powi(2))
+                .sqrt()
+            };
+            assert!(difference(&written, &fitted) < 1e-9);
+            assert!(difference(&written, &expected) < 1e-2);
+            let velocity = coarse.state(et).unwrap().velocity.0;
+            let error = (0..3)
+                .map(|k| (velocity[k] - expected.velocity.0[k]).powi(2))
+                .sum::<SpiceDouble>()
+                .sqrt();
+            assert!(error < 1e-5);
+        }
+        crate::data::unload(&path).unwrap();
+        std::fs::remove_file(&path).unwrap();
+
+        options.max_splits = 0;
+        let error = ChebyshevFit::fit(start, end, &options, moon).unwrap_err();
+        assert_eq!(error.short_message, "SPICE(TOLERANCENOTMET)");
+
+        options.max_splits = 64;
+        let error = ChebyshevFit::fit(start, end, &options, moon).unwrap_err();
+        assert_eq!(error.short_message, "SPICE(VALUEOUTOFRANGE)");
+    }
+}
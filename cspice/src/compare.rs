@@ -0,0 +1,544 @@
+//! Comparing the trajectories or orientations given by two sets of kernels over many epochs, as
+//! the spkdiff and frmdiff programs do, without keeping the differences in memory.
+//!
+//! SPICE holds a single set of loaded kernels, so the epochs are compared in chunks. For each
+//! chunk the kernels of the first set are loaded, every epoch of the chunk is evaluated under a
+//! single acquisition of the SPICE lock, and the kernels are unloaded again; then the same is done
+//! for the second set. The differences are folded into [DifferenceStats] and discarded, so memory
+//! use depends only on the chunk size, however many epochs are compared.
+//!
+//! Kernels loaded before the comparison stay loaded and are seen by both sets, like the kernels
+//! given to spkdiff with `-k`. Because the chunks are independent, a long comparison can also be
+//! split with [EpochGrid::split()] and the parts run in separate processes, with their statistics
+//! combined by [DifferenceStats::merge()].
+use crate::data::{furnish, unload};
+use crate::error::get_last_error;
+use crate::spk::{geometric_states, State};
+use crate::string::SpiceString;
+use crate::time::Et;
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{pxform_c, SpiceDouble, SpiceInt};
+
+/// The smallest and one past the largest binary exponent with bins of their own. Values outside
+/// the range are counted in the first or last bin; the extremes are kept exactly.
+const MIN_EXPONENT: i32 = -70;
+const MAX_EXPONENT: i32 = 70;
+/// The number of bins each power of two is divided into, which sets the resolution of the
+/// percentiles to about 3%.
+const SUB_BINS_LOG2: u32 = 5;
+const SUB_BINS: usize = 1 << SUB_BINS_LOG2;
+const BINS: usize = (MAX_EXPONENT - MIN_EXPONENT) as usize * SUB_BINS;
+
+/// A grid of equally spaced epochs.
+#[derive(Copy, Clone, Debug, PartialEq)]
+pub struct EpochGrid {
+    start: SpiceDouble,
+    step: SpiceDouble,
+    first: usize,
+    count: usize,
+}
+
+impl EpochGrid {
+    /// `count` epochs `step` seconds apart, beginning at `start`.
+    pub fn new(start: Et, step: SpiceDouble, count: usize) -> Self {
+        Self {
+            start: start.0,
+            step,
+            first: 0,
+            count,
+        }
+    }
+
+    /// `count` equally spaced epochs from `start` to `end` inclusive, as spkdiff samples an
+    /// interval with `-n`. A single epoch is at `start`.
+    pub fn spanning(start: Et, end: Et, count: usize) -> Self {
+        let step = if count > 1 {
+            (end.0 - start.0) / (count - 1) as SpiceDouble
+        } else {
+            0.0
+        };
+        Self::new(start, step, count)
+    }
+
+    /// The number of epochs.
+    pub fn len(&self) -> usize {
+        self.count
+    }
+
+    /// Whether the grid has no epochs.
+    pub fn is_empty(&self) -> bool {
+        self.count == 0
+    }
+
+    /// The epoch at `index`.
+    pub fn epoch(&self, index: usize) -> Et {
+        Et(self.start + (self.first + index) as SpiceDouble * self.step)
+    }
+
+    /// Split the grid into at most `parts` consecutive grids with nearly equal numbers of epochs.
+    /// The epochs of the parts are exactly those of the whole grid.
+    pub fn split(&self, parts: usize) -> Vec<EpochGrid> {
+        let parts = parts.clamp(1, self.count.max(1));
+        let mut grids = Vec::with_capacity(parts);
+        let mut first = self.first;
+        for part in 0..parts {
+            let count = self.count / parts + usize::from(part < self.count % parts);
+            grids.push(EpochGrid {
+                first,
+                count,
+                ..*self
+            });
+            first += count;
+        }
+        grids
+    }
+}
+
+/// Statistics of a stream of non-negative differences: their count, extremes, mean, RMS and
+/// percentiles. Memory use is fixed, whatever the number of values.
+///
+/// Percentiles are found from a histogram with bins about 3% wide, and are accurate to about 1.5%.
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct DifferenceStats {
+    count: u64,
+    zeros: u64,
+    min: SpiceDouble,
+    max: SpiceDouble,
+    max_epoch: Option<Et>,
+    sum: SpiceDouble,
+    sum_squares: SpiceDouble,
+    // Allocated with the first non-zero value.
+    bins: Vec<u64>,
+}
+
+fn bin_index(value: SpiceDouble) -> usize {
+    let bits = value.to_bits();
+    let exponent = ((bits >> 52) & 0x7ff) as i32 - 1023;
+    if exponent < MIN_EXPONENT {
+        0
+    } else if exponent >= MAX_EXPONENT {
+        BINS - 1
+    } else {
+        let sub_bin = (bits >> (52 - SUB_BINS_LOG2)) as usize & (SUB_BINS - 1);
+        (exponent - MIN_EXPONENT) as usize * SUB_BINS + sub_bin
+    }
+}
+
+fn bin_middle(index: usize) -> SpiceDouble {
+    let exponent = (index / SUB_BINS) as i32 + MIN_EXPONENT;
+    let sub_bin = (index % SUB_BINS) as SpiceDouble;
+    (2.0f64).powi(exponent) * (1.0 + (sub_bin + 0.5) / SUB_BINS as SpiceDouble)
+}
+
+impl DifferenceStats {
+    /// Add the difference `value` found at epoch `et`.
+    pub fn add(&mut self, et: Et, value: SpiceDouble) {
+        let value = value.abs();
+        if self.count == 0 || value < self.min {
+            self.min = value;
+        }
+        if self.count == 0 || value > self.max {
+            self.max = value;
+            self.max_epoch = Some(et);
+        }
+        self.count += 1;
+        self.sum += value;
+        self.sum_squares += value * value;
+        if value == 0.0 {
+            self.zeros += 1;
+        } else {
+            if self.bins.is_empty() {
+                self.bins = vec![0; BINS];
+            }
+            self.bins[bin_index(value)] += 1;
+        }
+    }
+
+    /// Combine the statistics of another stream of differences with these, as if its values had
+    /// been added here.
+    pub fn merge(&mut self, other: &DifferenceStats) {
+        if other.count == 0 {
+            return;
+        }
+        if self.count == 0 || other.min < self.min {
+            self.min = other.min;
+        }
+        if self.count == 0 || other.max > self.max {
+            self.max = other.max;
+            self.max_epoch = other.max_epoch;
+        }
+        self.count += other.count;
+        self.zeros += other.zeros;
+        self.sum += other.sum;
+        self.sum_squares += other.sum_squares;
+        if !other.bins.is_empty() {
+            if self.bins.is_empty() {
+                self.bins = vec![0; BINS];
+            }
+            for (bin, count) in self.bins.iter_mut().zip(&other.bins) {
+                *bin += count;
+            }
+        }
+    }
+
+    /// The number of differences.
+    pub fn count(&self) -> u64 {
+        self.count
+    }
+
+    /// The smallest difference.
+    pub fn min(&self) -> Option<SpiceDouble> {
+        (self.count > 0).then_some(self.min)
+    }
+
+    /// The largest difference and the first epoch at which it was found.
+    pub fn max(&self) -> Option<(SpiceDouble, Et)> {
+        self.max_epoch.map(|et| (self.max, et))
+    }
+
+    /// The mean of the differences.
+    pub fn mean(&self) -> Option<SpiceDouble> {
+        (self.count > 0).then(|| self.sum / self.count as SpiceDouble)
+    }
+
+    /// The root mean square of the differences.
+    pub fn rms(&self) -> Option<SpiceDouble> {
+        (self.count > 0).then(|| (self.sum_squares / self.count as SpiceDouble).sqrt())
+    }
+
+    /// The difference below which `percent` percent of the differences lie, for `percent` from 0
+    /// to 100. The 0th and 100th percentiles are the exact extremes.
+    pub fn percentile(&self, percent: SpiceDouble) -> Option<SpiceDouble> {
+        if self.count == 0 {
+            return None;
+        }
+        if percent <= 0.0 {
+            return Some(self.min);
+        }
+        let rank = ((percent / 100.0 * self.count as SpiceDouble).ceil() as u64).max(1);
+        if rank >= self.count {
+            return Some(self.max);
+        }
+        if rank <= self.zeros {
+            return Some(0.0);
+        }
+        let mut seen = self.zeros;
+        for (index, count) in self.bins.iter().enumerate() {
+            seen += count;
+            if seen >= rank {
+                return Some(bin_middle(index).clamp(self.min, self.max));
+            }
+        }
+        Some(self.max)
+    }
+}
+
+/// The trajectory of a body relative to a center in a frame, as given by a set of kernels: the
+/// `-b`, `-c`, `-r` and `-k` options of spkdiff for one of its trajectories.
+#[derive(Clone, Debug, PartialEq)]
+pub struct Trajectory {
+    pub target: SpiceInt,
+    pub observer: SpiceInt,
+    pub frame: String,
+    /// The kernels loaded while the trajectory is evaluated.
+    pub kernels: Vec<String>,
+}
+
+impl Trajectory {
+    /// The trajectory of `target` relative to `observer` in `frame`, from the kernels already
+    /// loaded.
+    pub fn new<S: Into<String>>(target: SpiceInt, observer: SpiceInt, frame: S) -> Self {
+        Self {
+            target,
+            observer,
+            frame: frame.into(),
+            kernels: Vec::new(),
+        }
+    }
+}
+
+/// The orientation of one frame relative to another, as given by a set of kernels: the `-f`,
+/// `-t` and `-k` options of frmdiff for one of its rotations.
+#[derive(Clone, Debug, PartialEq)]
+pub struct Orientation {
+    /// The frame the rotation transforms vectors from.
+    pub from: String,
+    /// The frame the rotation transforms vectors to.
+    pub to: String,
+    /// The kernels loaded while the orientation is evaluated.
+    pub kernels: Vec<String>,
+}
+
+impl Orientation {
+    /// The orientation of `to` relative to `from`, from the kernels already loaded.
+    pub fn new<F: Into<String>, T: Into<String>>(from: F, to: T) -> Self {
+        Self {
+            from: from.into(),
+            to: to.into(),
+            kernels: Vec::new(),
+        }
+    }
+}
+
+/// The differences between two trajectories: the magnitudes of the position and velocity
+/// differences, and those magnitudes relative to the magnitudes of the first trajectory's
+/// position and velocity.
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct StateDifferences {
+    pub position: DifferenceStats,
+    pub velocity: DifferenceStats,
+    pub relative_position: DifferenceStats,
+    pub relative_velocity: DifferenceStats,
+}
+
+fn norm(vector: [SpiceDouble; 3]) -> SpiceDouble {
+    vector.iter().map(|c| c * c).sum::<SpiceDouble>().sqrt()
+}
+
+impl StateDifferences {
+    /// Add the difference between the states `first` and `second` at epoch `et`.
+    pub fn add(&mut self, et: Et, first: &State, second: &State) {
+        let r1 = [first.position.x, first.position.y, first.position.z];
+        let r2 = [second.position.x, second.position.y, second.position.z];
+        let v1 = first.velocity.0;
+        let v2 = second.velocity.0;
+        let dr = norm([r2[0] - r1[0], r2[1] - r1[1], r2[2] - r1[2]]);
+        let dv = norm([v2[0] - v1[0], v2[1] - v1[1], v2[2] - v1[2]]);
+        self.position.add(et, dr);
+        self.velocity.add(et, dv);
+        let (r, v) = (norm(r1), norm(v1));
+        if r > 0.0 {
+            self.relative_position.add(et, dr / r);
+        }
+        if v > 0.0 {
+            self.relative_velocity.add(et, dv / v);
+        }
+    }
+
+    /// Combine the differences found over another set of epochs with these.
+    pub fn merge(&mut self, other: &StateDifferences) {
+        self.position.merge(&other.position);
+        self.velocity.merge(&other.velocity);
+        self.relative_position.merge(&other.relative_position);
+        self.relative_velocity.merge(&other.relative_velocity);
+    }
+}
+
+/// Run `f` with `kernels` loaded, unloading them afterwards even if `f` fails.
+fn with_kernels<R, F>(kernels: &[String], f: F) -> Result<R, Error>
+where
+    F: FnOnce() -> Result<R, Error>,
+{
+    let mut loaded = 0;
+    let mut result = Ok(());
+    for kernel in kernels {
+        result = furnish(kernel.as_str());
+        if result.is_err() {
+            break;
+        }
+        loaded += 1;
+    }
+    let value = result.and_then(|_| f());
+    for kernel in kernels[..loaded].iter().rev() {
+        let unloaded = unload(kernel.as_str());
+        if value.is_ok() {
+            unloaded?;
+        }
+    }
+    value
+}
+
+/// Call `compare` with each chunk of at most `chunk` epochs of `epochs`, holding the SPICE lock
+/// throughout so that no other thread changes the loaded kernels.
+fn for_each_chunk<F>(epochs: &EpochGrid, chunk: usize, mut compare: F) -> Result<(), Error>
+where
+    F: FnMut(&[Et]) -> Result<(), Error>,
+{
+    let chunk = chunk.max(1);
+    with_spice_lock_or_panic(|| {
+        let mut ets = Vec::with_capacity(chunk.min(epochs.len()));
+        for begin in (0..epochs.len()).step_by(chunk) {
+            ets.clear();
+            ets.extend((begin..epochs.len().min(begin + chunk)).map(|i| epochs.epoch(i)));
+            compare(&ets)?;
+        }
+        Ok(())
+    })
+}
+
+/// Compare two trajectories at each epoch of a grid, evaluating `chunk` epochs of each trajectory
+/// at a time. Both trajectories must be computable at every epoch.
+///
+/// See [spkgeo_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkgeo_c.html).
+pub fn compare_states(
+    first: &Trajectory,
+    second: &Trajectory,
+    epochs: &EpochGrid,
+    chunk: usize,
+) -> Result<StateDifferences, Error> {
+    let mut differences = StateDifferences::default();
+    for_each_chunk(epochs, chunk, |ets| {
+        let evaluate = |trajectory: &Trajectory| {
+            with_kernels(&trajectory.kernels, || {
+                geometric_states(
+                    trajectory.target,
+                    ets,
+                    trajectory.frame.as_str(),
+                    trajectory.observer,
+                )
+            })
+        };
+        let states1 = evaluate(first)?;
+        let states2 = evaluate(second)?;
+        for ((et, state1), state2) in ets.iter().zip(&states1).zip(&states2) {
+            differences.add(*et, state1, state2);
+        }
+        Ok(())
+    })?;
+    Ok(differences)
+}
+
+type Matrix = [[SpiceDouble; 3]; 3];
+
+fn rotations(orientation: &Orientation, ets: &[Et]) -> Result<Vec<Matrix>, Error> {
+    with_kernels(&orientation.kernels, || {
+        let from = SpiceString::from(orientation.from.as_str());
+        let to = SpiceString::from(orientation.to.as_str());
+        let mut matrices = Vec::with_capacity(ets.len());
+        for et in ets {
+            let mut rotate = [[0.0; 3]; 3];
+            unsafe {
+                pxform_c(
+                    from.as_mut_ptr(),
+                    to.as_mut_ptr(),
+                    et.0,
+                    rotate.as_mut_ptr(),
+                )
+            };
+            get_last_error()?;
+            matrices.push(rotate);
+        }
+        Ok(matrices)
+    })
+}
+
+/// The angle of the rotation `first` followed by the inverse of `second`.
+fn rotation_angle(first: &Matrix, second: &Matrix) -> SpiceDouble {
+    // M = first * second^T; its trace and skew-symmetric part give the cosine and sine.
+    let m = |i: usize, j: usize| {
+        (0..3)
+            .map(|k| first[i][k] * second[j][k])
+            .sum::<SpiceDouble>()
+    };
+    let cos = (m(0, 0) + m(1, 1) + m(2, 2) - 1.0) / 2.0;
+    let sin = norm([m(2, 1) - m(1, 2), m(0, 2) - m(2, 0), m(1, 0) - m(0, 1)]) / 2.0;
+    sin.atan2(cos)
+}
+
+/// Compare two orientations at each epoch of a grid, evaluating `chunk` epochs of each
+/// orientation at a time. The differences are the angles in radians of the rotations taking one
+/// orientation to the other. Both orientations must be computable at every epoch.
+///
+/// See [pxform_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/pxform_c.html).
+pub fn compare_rotations(
+    first: &Orientation,
+    second: &Orientation,
+    epochs: &EpochGrid,
+    chunk: usize,
+) -> Result<DifferenceStats, Error> {
+    let mut differences = DifferenceStats::default();
+    for_each_chunk(epochs, chunk, |ets| {
+        let rotations1 = rotations(first, ets)?;
+        let rotations2 = rotations(second, ets)?;
+        for ((et, rotation1), rotation2) in ets.iter().zip(&rotations1).zip(&rotations2) {
+            differences.add(*et, rotation_angle(rotation1, rotation2));
+        }
+        Ok(())
+    })?;
+    Ok(differences)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::spk::geometric_state;
+    use crate::tests::load_test_data;
+
+    #[test]
+    fn test_stats() {
+        let mut stats = DifferenceStats::default();
+        assert_eq!(stats.percentile(50.0), None);
+        for i in 0..=1000 {
+            stats.add(Et(i as SpiceDouble), i as SpiceDouble);
+        }
+        assert_eq!(stats.count(), 1001);
+        assert_eq!(stats.min(), Some(0.0));
+        assert_eq!(stats.max(), Some((1000.0, Et(1000.0))));
+        assert_eq!(stats.mean(), Some(500.0));
+        assert!((stats.rms().unwrap() - (1000.0 * 2001.0 / 6.0f64).sqrt()).abs() < 1e-9);
+        for percent in [1.0, 10.0, 50.0, 90.0, 99.0] {
+            let value = stats.percentile(percent).unwrap();
+            assert!(
+                (value / (percent * 10.0) - 1.0).abs() < 0.02,
+                "{percent} {value}"
+            );
+        }
+        assert_eq!(stats.percentile(0.0), Some(0.0));
+        assert_eq!(stats.percentile(100.0), Some(1000.0));
+
+        let mut merged = DifferenceStats::default();
+        let mut other = DifferenceStats::default();
+        for i in 0..=1000 {
+            let part = if i % 3 == 0 { &mut merged } else { &mut other };
+            part.add(Et(i as SpiceDouble), i as SpiceDouble);
+        }
+        merged.merge(&other);
+        assert_eq!(merged.count(), stats.count());
+        assert_eq!(merged.max(), stats.max());
+        assert_eq!(merged.percentile(50.0), stats.percentile(50.0));
+    }
+
+    #[test]
+    fn test_compare_states() {
+        load_test_data();
+        // The Moon relative to the Earth and to the Earth-Moon barycenter differ by the position
+        // of the Earth relative to the barycenter.
+        let first = Trajectory::new(301, 399, "J2000");
+        let second = Trajectory::new(301, 3, "J2000");
+        let epochs = EpochGrid::spanning(Et(0.0), Et(86400.0 * 30.0), 1000);
+        let differences = compare_states(&first, &second, &epochs, 128).unwrap();
+        assert_eq!(differences.position.count(), 1000);
+
+        let (max, at) = differences.position.max().unwrap();
+        let (expected, _) = geometric_state(399, at, "J2000", 3).unwrap();
+        let p = expected.position;
+        assert!((max - norm([p.x, p.y, p.z])).abs() < 1e-6);
+        assert!(max > 4000.0 && max < 5000.0);
+
+        let mut parts = StateDifferences::default();
+        for part in epochs.split(3) {
+            parts.merge(&compare_states(&first, &second, &part, 100).unwrap());
+        }
+        assert_eq!(parts.position.count(), 1000);
+        assert_eq!(parts.position.max(), differences.position.max());
+        assert_eq!(parts.velocity.max(), differences.velocity.max());
+
+        let same = compare_states(&first, &first, &epochs, 1000).unwrap();
+        assert_eq!(same.position.max().unwrap().0, 0.0);
+        assert_eq!(same.relative_velocity.percentile(50.0), Some(0.0));
+    }
+
+    #[test]
+    fn test_compare_rotations() {
+        load_test_data();
+        let first = Orientation::new("J2000", "ECLIPJ2000");
+        let second = Orientation::new("J2000", "J2000");
+        let epochs = EpochGrid::new(Et(0.0), 3600.0, 10);
+        let differences = compare_rotations(&first, &second, &epochs, 4).unwrap();
+        assert_eq!(differences.count(), 10);
+        // The obliquity of the ecliptic at J2000, 84381.448 arcseconds.
+        let obliquity = (84381.448 / 3600.0f64).to_radians();
+        assert!((differences.min().unwrap() - obliquity).abs() < 1e-12);
+        assert!((differences.max().unwrap().0 - obliquity).abs() < 1e-12);
+    }
+}
@@ -0,0 +1,518 @@
+//! The coverage of SPK, CK and binary PCK files, and sidecar index files that record it.
+//!
+//! Finding the coverage of a kernel means reading every segment descriptor in it, and for CKs with
+//! interval-level coverage the interval directories too. [CoverageIndex::load()] does this once
+//! per kernel and keeps the result in a small sidecar file next to the kernel (`de432s.bsp.cov`
+//! for `de432s.bsp`). Later calls read the sidecar instead, as long as the kernel's size,
+//! modification time and file record are unchanged, so a query costs two small file reads however
+//! large the kernel is.
+use crate::cell::{Cell, Window};
+use crate::error::get_last_error;
+use crate::string::{static_spice_str, SpiceStr, SpiceString, StaticSpiceStr};
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{
+    ckcov_c, ckobj_c, getfat_c, pckcov_c, pckfrm_c, spkcov_c, spkobj_c, SpiceChar, SpiceDouble,
+    SpiceInt, SPICEFALSE,
+};
+use std::fs::File;
+use std::io::Read;
+use std::path::{Path, PathBuf};
+use std::time::UNIX_EPOCH;
+
+/// Identifies coverage index files, followed by the format version.
+const MAGIC: &[u8; 8] = b"SPCCOVR\0";
+const VERSION: u32 = 1;
+
+/// The number of bytes of the kernel, the DAF file record, covered by the checksum.
+const CHECKSUM_BYTES: u64 = 1024;
+
+/// The initial size of the cells coverage is read into. They grow as needed.
+const INITIAL_CELL_SIZE: usize = 1000;
+
+/// The kinds of kernel that have coverage.
+#[derive(Copy, Clone, Debug, PartialEq, Eq)]
+pub enum KernelType {
+    Spk,
+    Ck,
+    Pck,
+}
+
+impl KernelType {
+    fn code(self) -> u8 {
+        match self {
+            KernelType::Spk => b'S',
+            KernelType::Ck => b'C',
+            KernelType::Pck => b'P',
+        }
+    }
+}
+
+/// The coverage of one body (SPK), instrument or structure (CK) or reference frame class (PCK).
+#[derive(Clone, Debug, PartialEq)]
+pub struct ObjectCoverage {
+    /// The ID code of the object.
+    pub id: SpiceInt,
+    /// The intervals covered, in order. For SPKs and PCKs these are in TDB seconds past J2000. For
+    /// CKs they are in encoded SCLK ticks, so that the index does not depend on the SCLK kernels
+    /// loaded; convert them with `sct2e_c`.
+    pub intervals: Vec<(SpiceDouble, SpiceDouble)>,
+}
+
+/// What identifies the version of a kernel the index was made from.
+#[derive(Copy, Clone, Debug, PartialEq, Eq)]
+struct FileKey {
+    size: u64,
+    modified_seconds: i64,
+    modified_nanos: u32,
+    checksum: u64,
+}
+
+impl FileKey {
+    fn of(path: &Path) -> Result<Self, Error> {
+        let metadata = std::fs::metadata(path).map_err(|error| {
+            Error::new(
+                "SPICE(FILEREADFAILED)",
+                format!("Could not access {}: {error}", path.display()),
+            )
+        })?;
+        let (modified_seconds, modified_nanos) = match metadata.modified() {
+            Ok(time) => match time.duration_since(UNIX_EPOCH) {
+                Ok(after) => (after.as_secs() as i64, after.subsec_nanos()),
+                Err(before) => (
+                    -(before.duration().as_secs() as i64),
+                    before.duration().subsec_nanos(),
+                ),
+            },
+            Err(_) => (0, 0),
+        };
+        let mut head = Vec::with_capacity(CHECKSUM_BYTES as usize);
+        File::open(path)
+            .and_then(|file| file.take(CHECKSUM_BYTES).read_to_end(&mut head))
+            .map_err(|error| {
+                Error::new(
+                    "SPICE(FILEREADFAILED)",
+                    format!("Could not access {}: {error}", path.display()),
+                )
+            })?;
+        // FNV-1a. The file record holds the DAF's free address and summary record pointers, so it
+        // changes whenever segments are added.
+        let checksum = head.iter().fold(0xcbf29ce484222325u64, |hash, &byte| {
+            (hash ^ byte as u64).wrapping_mul(0x100000001b3)
+        });
+        Ok(Self {
+            size: metadata.len(),
+            modified_seconds,
+            modified_nanos,
+            checksum,
+        })
+    }
+}
+
+/// The coverage of every object in a kernel.
+#[derive(Clone, Debug, PartialEq)]
+pub struct CoverageIndex {
+    key: FileKey,
+    kernel_type: KernelType,
+    objects: Vec<ObjectCoverage>,
+}
+
+/// The path of the sidecar index file for `kernel`: the kernel's path with `.cov` appended.
+pub fn sidecar_path<P: AsRef<Path>>(kernel: P) -> PathBuf {
+    let mut path = kernel.as_ref().as_os_str().to_owned();
+    path.push(".cov");
+    PathBuf::from(path)
+}
+
+/// Call `f` with cells of increasing size until they are large enough.
+fn with_cell_size<T, F>(mut f: F) -> Result<T, Error>
+where
+    F: FnMut(usize) -> Result<T, Error>,
+{
+    let mut size = INITIAL_CELL_SIZE;
+    loop {
+        match f(size) {
+            Err(error)
+                if error.short_message == "SPICE(CELLTOOSMALL)"
+                    || error.short_message == "SPICE(WINDOWEXCESS)" =>
+            {
+                size *= 4
+            }
+            result => return result,
+        }
+    }
+}
+
+impl CoverageIndex {
+    /// Find the coverage of every object in the SPK, CK or binary PCK at `path` by reading the
+    /// kernel. CK coverage is at interval level, with no tolerance, whether or not the pointing
+    /// includes angular velocity.
+    ///
+    /// See [spkcov_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkcov_c.html),
+    /// [ckcov_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/ckcov_c.html) and
+    /// [pckcov_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/pckcov_c.html).
+    pub fn scan<P: AsRef<Path>>(path: P) -> Result<Self, Error> {
+        let path = path.as_ref();
+        let key = FileKey::of(path)?;
+        let file = SpiceString::from(path.to_string_lossy());
+        with_spice_lock_or_panic(|| {
+            let mut architecture = [0 as SpiceChar; 8];
+            let mut file_type = [0 as SpiceChar; 8];
+            unsafe {
+                getfat_c(
+                    file.as_mut_ptr(),
+                    architecture.len() as SpiceInt,
+                    file_type.len() as SpiceInt,
+                    architecture.as_mut_ptr(),
+                    file_type.as_mut_ptr(),
+                )
+            };
+            get_last_error()?;
+            let architecture = SpiceStr::from_buffer(&architecture).to_string();
+            let file_type = SpiceStr::from_buffer(&file_type).to_string();
+            // Text PCKs have the type PCK too, but no coverage
+            let kernel_type = match (architecture.as_str(), file_type.as_str()) {
+                ("DAF", "SPK") => KernelType::Spk,
+                ("DAF", "CK") => KernelType::Ck,
+                ("DAF", "PCK") => KernelType::Pck,
+                _ => {
+                    return Err(Error::new(
+                        "SPICE(INVALIDFILETYPE)",
+                        format!(
+                            "{} is a {architecture} {file_type} file, which has no coverage index.",
+                            path.display()
+                        ),
+                    ))
+                }
+            };
+
+            let ids = with_cell_size(|size| {
+                let mut ids = Cell::new_int(size);
+                unsafe {
+                    match kernel_type {
+                        KernelType::Spk => spkobj_c(file.as_mut_ptr(), ids.as_mut_cell()),
+                        KernelType::Ck => ckobj_c(file.as_mut_ptr(), ids.as_mut_cell()),
+                        KernelType::Pck => pckfrm_c(file.as_mut_ptr(), ids.as_mut_cell()),
+                    }
+                };
+                get_last_error()?;
+                Ok(ids.elements().to_vec())
+            })?;
+            let objects = ids
+                .into_iter()
+                .map(|id| {
+                    let intervals = with_cell_size(|size| {
+                        let mut cover = Window::new_double(size);
+                        unsafe {
+                            match kernel_type {
+                                KernelType::Spk => {
+                                    spkcov_c(file.as_mut_ptr(), id, cover.as_mut_cell())
+                                }
+                                KernelType::Ck => ckcov_c(
+                                    file.as_mut_ptr(),
+                                    id,
+                                    SPICEFALSE as _,
+                                    static_spice_str!("INTERVAL").as_mut_ptr(),
+                                    0.0,
+                                    static_spice_str!("SCLK").as_mut_ptr(),
+                                    cover.as_mut_cell(),
+                                ),
+                                KernelType::Pck => {
+                                    pckcov_c(file.as_mut_ptr(), id, cover.as_mut_cell())
+                                }
+                            }
+                        };
+                        get_last_error()?;
+                        Ok(cover
+                            .elements()
+                            .chunks_exact(2)
+                            .map(|interval| (interval[0], interval[1]))
+                            .collect())
+                    })?;
+                    Ok(ObjectCoverage { id, intervals })
+                })
+                .collect::<Result<_, Error>>()?;
+            Ok(Self {
+                key,
+                kernel_type,
+                objects,
+            })
+        })
+    }
+
+    /// The coverage of the kernel at `path`, from its sidecar index file if that was made from the
+    /// kernel as it is now. Otherwise the kernel is scanned, as by [CoverageIndex::scan()], and
+    /// the sidecar is written for next time. A sidecar that cannot be written, for instance
+    /// because the kernel's directory is read-only, is not an error.
+    pub fn load<P: AsRef<Path>>(path: P) -> Result<Self, Error> {
+        let path = path.as_ref();
+        let sidecar = sidecar_path(path);
+        let key = FileKey::of(path)?;
+        if let Ok(index) = Self::read(&sidecar) {
+            if index.key == key {
+                return Ok(index);
+            }
+        }
+        let index = Self::scan(path)?;
+        // Write to a temporary file and rename it, so that other processes never read a partly
+        // written sidecar.
+        let mut temporary = sidecar.clone().into_os_string();
+        temporary.push(format!(".{}", std::process::id()));
+        if index.write(&temporary).is_ok() && std::fs::rename(&temporary, &sidecar).is_err() {
+            let _ = std::fs::remove_file(&temporary);
+        }
+        Ok(index)
+    }
+
+    /// Whether the index was made from the kernel at `path` as it is now.
+    pub fn is_current<P: AsRef<Path>>(&self, path: P) -> Result<bool, Error> {
+        Ok(self.key == FileKey::of(path.as_ref())?)
+    }
+
+    /// The kind of kernel the index describes.
+    pub fn kernel_type(&self) -> KernelType {
+        self.kernel_type
+    }
+
+    /// The coverage of every object in the kernel, in increasing order of ID code.
+    pub fn objects(&self) -> &[ObjectCoverage] {
+        &self.objects
+    }
+
+    /// The intervals covered for the object with ID code `id`, or `None` if the kernel has no data
+    /// for it.
+    pub fn coverage(&self, id: SpiceInt) -> Option<&[(SpiceDouble, SpiceDouble)]> {
+        self.objects
+            .binary_search_by_key(&id, |object| object.id)
+            .ok()
+            .map(|i| self.objects[i].intervals.as_slice())
+    }
+
+    /// Encode the index.
+    ///
+    /// Numbers are written in little-endian order.
+    pub fn to_bytes(&self) -> Vec<u8> {
+        let mut bytes = Vec::new();
+        bytes.extend_from_slice(MAGIC);
+        bytes.extend_from_slice(&VERSION.to_le_bytes());
+        bytes.extend_from_slice(&self.key.size.to_le_bytes());
+        bytes.extend_from_slice(&self.key.modified_seconds.to_le_bytes());
+        bytes.extend_from_slice(&self.key.modified_nanos.to_le_bytes());
+        bytes.extend_from_slice(&self.key.checksum.to_le_bytes());
+        bytes.push(self.kernel_type.code());
+        bytes.extend_from_slice(&(self.objects.len() as u32).to_le_bytes());
+        for object in &self.objects {
+            bytes.extend_from_slice(&object.id.to_le_bytes());
+            bytes.extend_from_slice(&(object.intervals.len() as u32).to_le_bytes());
+            for (start, end) in &object.intervals {
+                bytes.extend_from_slice(&start.to_le_bytes());
+                bytes.extend_from_slice(&end.to_le_bytes());
+            }
+        }
+        bytes
+    }
+
+    /// Decode an index encoded by [CoverageIndex::to_bytes].
+    pub fn from_bytes(bytes: &[u8]) -> Result<Self, Error> {
+        let mut reader = Reader { rest: bytes };
+        if reader.take(MAGIC.len())? != MAGIC {
+            return Err(Error::new(
+                "SPICE(INVALIDFORMAT)",
+                "The data is not a coverage index.",
+            ));
+        }
+        let version = reader.u32()?;
+        if version != VERSION {
+            return Err(Error::new("SPICE(INVALIDFORMAT)", format!(
+                "The coverage index has format version {version}; the supported version is {VERSION}."
+            )));
+        }
+        let key = FileKey {
+            size: reader.u64()?,
+            modified_seconds: reader.u64()? as i64,
+            modified_nanos: reader.u32()?,
+            checksum: reader.u64()?,
+        };
+        let code = reader.take(1)?[0];
+        let kernel_type = [KernelType::Spk, KernelType::Ck, KernelType::Pck]
+            .into_iter()
+            .find(|kernel_type| kernel_type.code() == code)
+            .ok_or_else(|| {
+                Error::new(
+                    "SPICE(INVALIDFORMAT)",
+                    format!("The kernel type code {code} is unknown."),
+                )
+            })?;
+        let count = reader.u32()? as usize;
+        let mut objects = Vec::with_capacity(count.min(bytes.len()));
+        for _ in 0..count {
+            let id = reader.u32()? as SpiceInt;
+            let n = reader.u32()? as usize;
+            let intervals = reader
+                .take(n.saturating_mul(16))?
+                .chunks_exact(16)
+                .map(|b| {
+                    (
+                        f64::from_le_bytes(b[..8].try_into().unwrap()),
+                        f64::from_le_bytes(b[8..].try_into().unwrap()),
+                    )
+                })
+                .collect();
+            objects.push(ObjectCoverage { id, intervals });
+        }
+        Ok(Self {
+            key,
+            kernel_type,
+            objects,
+        })
+    }
+
+    /// Write the index to the file at `path`.
+    pub fn write<P: AsRef<Path>>(&self, path: P) -> Result<(), Error> {
+        let path = path.as_ref();
+        std::fs::write(path, self.to_bytes()).map_err(|error| {
+            Error::new(
+                "SPICE(FILEWRITEFAILED)",
+                format!("Could not access {}: {error}", path.display()),
+            )
+        })
+    }
+
+    /// Read an index from the file at `path`.
+    pub fn read<P: AsRef<Path>>(path: P) -> Result<Self, Error> {
+        let path = path.as_ref();
+        let bytes = std::fs::read(path).map_err(|error| {
+            Error::new(
+                "SPICE(FILEREADFAILED)",
+                format!("Could not access {}: {error}", path.display()),
+            )
+        })?;
+        Self::from_bytes(&bytes)
+    }
+}
+
+/// Reads the fields of an encoded index in order.
+struct Reader<'a> {
+    rest: &'a [u8],
+}
+
+impl<'a> Reader<'a> {
+    fn take(&mut self, n: usize) -> Result<&'a [u8], Error> {
+        if self.rest.len() < n {
+            return Err(Error::new(
+                "SPICE(INVALIDFORMAT)",
+                "The coverage index is truncated.",
+            ));
+        }
+        let (head, tail) = self.rest.split_at(n);
+        self.rest = tail;
+        Ok(head)
+    }
+
+    fn u32(&mut self) -> Result<u32, Error> {
+        Ok(u32::from_le_bytes(self.take(4)?.try_into().unwrap()))
+    }
+
+    fn u64(&mut self) -> Result<u64, Error> {
+        Ok(u64::from_le_bytes(self.take(8)?.try_into().unwrap()))
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use cspice_sys::{ckcls_c, ckopn_c, ckw02_c};
+
+    #[test]
+    fn test_coverage_index() {
+        let directory = std::env::temp_dir().join(format!("cspice-cov-{}", std::process::id()));
+        std::fs::create_dir_all(&directory).unwrap();
+        let kernel = directory.join("de432s.bsp");
+        std::fs::copy(
+            PathBuf::from(env!("CARGO_MANIFEST_DIR")).join("test_data/de432s.bsp"),
+            &kernel,
+        )
+        .unwrap();
+
+        let scanned = CoverageIndex::scan(&kernel).unwrap();
+        assert_eq!(scanned.kernel_type(), KernelType::Spk);
+        let moon = scanned.coverage(301).unwrap();
+        assert_eq!(moon.len(), 1);
+        assert!(moon[0].0 < 0.0 && moon[0].1 > 0.0);
+        assert!(scanned.coverage(-999).is_none());
+
+        // The first load writes the sidecar, and the second reads it
+        let sidecar = sidecar_path(&kernel);
+        assert_eq!(CoverageIndex::load(&kernel).unwrap(), scanned);
+        assert_eq!(CoverageIndex::read(&sidecar).unwrap(), scanned);
+        let mut altered = scanned.clone();
+        altered.objects.truncate(1);
+        altered.write(&sidecar).unwrap();
+        assert_eq!(CoverageIndex::load(&kernel).unwrap(), altered);
+
+        // A changed kernel makes the sidecar stale
+        let file = File::options().write(true).open(&kernel).unwrap();
+        file.set_modified(UNIX_EPOCH).unwrap();
+        drop(file);
+        assert!(!altered.is_current(&kernel).unwrap());
+        assert_eq!(
+            CoverageIndex::load(&kernel).unwrap().objects(),
+            scanned.objects()
+        );
+        assert!(CoverageIndex::read(&sidecar)
+            .unwrap()
+            .is_current(&kernel)
+            .unwrap());
+
+        let error = CoverageIndex::from_bytes(&scanned.to_bytes()[..30]).unwrap_err();
+        assert_eq!(error.short_message, "SPICE(INVALIDFORMAT)");
+        std::fs::remove_dir_all(&directory).unwrap();
+    }
+
+    #[test]
+    fn test_coverage_index_ck() {
+        let kernel = std::env::temp_dir().join(format!("cspice-cov-{}.bc", std::process::id()));
+        let _ = std::fs::remove_file(&kernel);
+        let file = SpiceString::from(kernel.to_string_lossy());
+        // Instrument -1000 has two pointing intervals, and -2000 one, in encoded SCLK
+        let segments: [(SpiceInt, &[(SpiceDouble, SpiceDouble)]); 2] = [
+            (-1000, &[(0.0, 10.0), (20.0, 30.0)]),
+            (-2000, &[(100.0, 200.0)]),
+        ];
+        with_spice_lock_or_panic(|| unsafe {
+            let mut handle = 0;
+            ckopn_c(file.as_mut_ptr(), file.as_mut_ptr(), 0, &mut handle);
+            for (inst, intervals) in segments {
+                let start: Vec<_> = intervals.iter().map(|i| i.0).collect();
+                let stop: Vec<_> = intervals.iter().map(|i| i.1).collect();
+                let quats = vec![[1.0, 0.0, 0.0, 0.0]; intervals.len()];
+                let avvs = vec![[0.0; 3]; intervals.len()];
+                let rates = vec![1.0; intervals.len()];
+                ckw02_c(
+                    handle,
+                    start[0],
+                    stop[stop.len() - 1],
+                    inst,
+                    static_spice_str!("J2000").as_mut_ptr(),
+                    static_spice_str!("TEST").as_mut_ptr(),
+                    intervals.len() as SpiceInt,
+                    start.as_ptr(),
+                    stop.as_ptr(),
+                    quats.as_ptr(),
+                    avvs.as_ptr(),
+                    rates.as_ptr(),
+                );
+            }
+            ckcls_c(handle);
+        });
+        get_last_error().unwrap();
+
+        let scanned = CoverageIndex::scan(&kernel).unwrap();
+        assert_eq!(scanned.kernel_type(), KernelType::Ck);
+        let ids: Vec<_> = scanned.objects().iter().map(|o| o.id).collect();
+        assert_eq!(ids, [-2000, -1000]);
+        for (inst, intervals) in segments {
+            assert_eq!(scanned.coverage(inst).unwrap(), intervals);
+        }
+        std::fs::remove_file(&kernel).unwrap();
+    }
+}
@@ -0,0 +1,431 @@
+//! Loading meta-kernels with the kernels they list read in parallel.
+//!
+//! [furnish()](super::furnish) loads the kernels listed in a meta-kernel one after another, and
+//! most of the time spent loading a large meta-kernel from cold storage is spent waiting for each
+//! file to be opened and its first records read. [furnish_parallel()] reads the meta-kernel itself
+//! first, checks that every kernel it lists can be opened, and reads the parts of each kernel that
+//! loading will touch on several threads at once. The kernels are then loaded by SPICE in the order
+//! in which they are listed, so later kernels still take priority over earlier ones.
+//!
+//! Loading an SPK or CK file only registers it: the segments of a file are not examined until data
+//! for a body or instrument is first requested, so after the files have been read ahead the cost
+//! of loading is dominated by the text kernels.
+use crate::data::furnish;
+use crate::Error;
+use std::collections::HashMap;
+use std::fs::File;
+use std::io::{ErrorKind, Read, Seek, SeekFrom};
+use std::path::{Path, PathBuf};
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::Mutex;
+use std::thread;
+
+/// The length in bytes of a DAF or DAS record.
+const RECORD_LENGTH: usize = 1024;
+
+/// A value assigned to a kernel pool variable.
+#[derive(Clone, Debug, PartialEq)]
+enum Value {
+    String(String),
+    Other,
+}
+
+#[derive(Clone, Debug, PartialEq)]
+enum Token {
+    Name(String),
+    String(String),
+    Assign,
+    Append,
+    Open,
+    Close,
+}
+
+/// Split the data sections of a text kernel into tokens.
+fn tokenize(text: &str) -> Result<Vec<Token>, Error> {
+    let mut tokens = Vec::new();
+    let mut in_data = false;
+    for line in text.lines() {
+        let trimmed = line.trim();
+        if trimmed == "\\begindata" {
+            in_data = true;
+            continue;
+        }
+        if trimmed == "\\begintext" {
+            in_data = false;
+            continue;
+        }
+        if !in_data {
+            continue;
+        }
+        let mut chars = line.chars().peekable();
+        while let Some(c) = chars.next() {
+            match c {
+                c if c.is_whitespace() || c == ',' => {}
+                '(' => tokens.push(Token::Open),
+                ')' => tokens.push(Token::Close),
+                '=' => tokens.push(Token::Assign),
+                '\'' => {
+                    let mut value = String::new();
+                    loop {
+                        match chars.next() {
+                            Some('\'') if chars.peek() == Some(&'\'') => {
+                                chars.next();
+                                value.push('\'');
+                            }
+                            Some('\'') => break,
+                            Some(c) => value.push(c),
+                            None => {
+                                return Err(Error::new(
+                                    "SPICE(UNMATCHEDQUOTE)",
+                                    format!("The line '{line}' contains an unterminated string."),
+                                ))
+                            }
+                        }
+                    }
+                    tokens.push(Token::String(value));
+                }
+                '+' if chars.peek() == Some(&'=') => {
+                    chars.next();
+                    tokens.push(Token::Append);
+                }
+                c => {
+                    let mut name = String::from(c);
+                    while let Some(&c) = chars.peek() {
+                        if c.is_whitespace() || "(),='".contains(c) {
+                            break;
+                        }
+                        if c == '+' {
+                            let mut rest = chars.clone();
+                            rest.next();
+                            if rest.peek() == Some(&'=') {
+                                break;
+                            }
+                        }
+                        name.push(c);
+                        chars.next();
+                    }
+                    tokens.push(Token::Name(name));
+                }
+            }
+        }
+    }
+    Ok(tokens)
+}
+
+/// Parse the assignments in the data sections of a text kernel.
+fn parse_variables(text: &str) -> Result<HashMap<String, Vec<Value>>, Error> {
+    let syntax_error = |message: &str| Error::new("SPICE(BADVARASSIGN)", message.to_string());
+    let mut variables: HashMap<String, Vec<Value>> = HashMap::new();
+    let mut tokens = tokenize(text)?.into_iter();
+    while let Some(token) = tokens.next() {
+        let name = match token {
+            Token::Name(name) => name,
+            _ => return Err(syntax_error("Expected the name of a variable.")),
+        };
+        let append = match tokens.next() {
+            Some(Token::Assign) => false,
+            Some(Token::Append) => true,
+            _ => return Err(syntax_error(&format!("Expected '=' or '+=' after {name}."))),
+        };
+        let mut values = Vec::new();
+        match tokens.next() {
+            Some(Token::String(value)) => values.push(Value::String(value)),
+            Some(Token::Name(_)) => values.push(Value::Other),
+            Some(Token::Open) => loop {
+                match tokens.next() {
+                    Some(Token::String(value)) => values.push(Value::String(value)),
+                    Some(Token::Name(_)) => values.push(Value::Other),
+                    Some(Token::Close) => break,
+                    _ => {
+                        return Err(syntax_error(&format!(
+                            "Unterminated list of values of {name}."
+                        )))
+                    }
+                }
+            },
+            _ => return Err(syntax_error(&format!("Expected a value for {name}."))),
+        }
+        if append {
+            variables.entry(name).or_default().extend(values);
+        } else {
+            variables.insert(name, values);
+        }
+    }
+    Ok(variables)
+}
+
+/// The string values of a variable, with values ending in the continuation marker `+` joined to
+/// the values that follow them, as by [stpool_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/stpool_c.html).
+fn continued_strings(values: &[Value]) -> Vec<String> {
+    let mut strings = Vec::new();
+    let mut current = String::new();
+    let mut continued = false;
+    for value in values {
+        let value = match value {
+            Value::String(value) => value.trim_end(),
+            Value::Other => continue,
+        };
+        match value.strip_suffix('+') {
+            Some(head) => {
+                current.push_str(head);
+                continued = true;
+            }
+            None => {
+                current.push_str(value);
+                strings.push(std::mem::take(&mut current));
+                continued = false;
+            }
+        }
+    }
+    if continued {
+        strings.push(current);
+    }
+    strings
+}
+
+/// Replace each `$SYMBOL` in `name` by the value of the longest matching path symbol.
+fn substitute_symbols(name: &str, symbols: &[(String, String)]) -> String {
+    let mut name = name.to_string();
+    let mut start = 0;
+    while let Some(offset) = name[start..].find('$') {
+        let dollar = start + offset;
+        let rest = &name[dollar + 1..];
+        let matched = symbols
+            .iter()
+            .filter(|(symbol, _)| !symbol.is_empty() && rest.starts_with(symbol.as_str()))
+            .max_by_key(|(symbol, _)| symbol.len());
+        if let Some((symbol, value)) = matched {
+            name.replace_range(dollar..dollar + 1 + symbol.len(), value);
+        }
+        start = dollar + 1;
+        if start >= name.len() {
+            break;
+        }
+    }
+    name
+}
+
+/// The kernels listed in a meta-kernel.
+#[derive(Clone, Debug)]
+pub struct MetaKernel {
+    path: PathBuf,
+    kernels: Vec<PathBuf>,
+}
+
+impl MetaKernel {
+    /// Read the meta-kernel at `path`.
+    pub fn read<P: AsRef<Path>>(path: P) -> Result<Self, Error> {
+        let path = path.as_ref();
+        let text = std::fs::read_to_string(path).map_err(|error| {
+            let short_message = match error.kind() {
+                ErrorKind::NotFound => "SPICE(NOSUCHFILE)",
+                _ => "SPICE(FILEREADFAILED)",
+            };
+            Error::new(
+                short_message,
+                format!(
+                    "The meta-kernel {} could not be read: {error}",
+                    path.display()
+                ),
+            )
+        })?;
+        Self::parse(path, &text)
+    }
+
+    /// Parse the text of the meta-kernel at `path`.
+    pub fn parse<P: AsRef<Path>>(path: P, text: &str) -> Result<Self, Error> {
+        let path = path.as_ref().to_path_buf();
+        let variables = parse_variables(text)?;
+        let symbols = match variables.get("PATH_SYMBOLS") {
+            Some(symbols) => {
+                let symbols: Vec<String> = symbols
+                    .iter()
+                    .filter_map(|value| match value {
+                        Value::String(symbol) => Some(symbol.trim_end().to_string()),
+                        Value::Other => None,
+                    })
+                    .collect();
+                let values = continued_strings(
+                    variables
+                        .get("PATH_VALUES")
+                        .map(Vec::as_slice)
+                        .unwrap_or_default(),
+                );
+                if symbols.len() != values.len() {
+                    return Err(Error::new(
+                        "SPICE(PATHMISMATCH)",
+                        format!(
+                            "Number of path symbols is {}; number of path values is {}; counts must match.",
+                            symbols.len(),
+                            values.len()
+                        ),
+                    ));
+                }
+                symbols.into_iter().zip(values).collect()
+            }
+            None => Vec::new(),
+        };
+        let kernels = continued_strings(
+            variables
+                .get("KERNELS_TO_LOAD")
+                .map(Vec::as_slice)
+                .unwrap_or_default(),
+        )
+        .iter()
+        .map(|name| PathBuf::from(substitute_symbols(name, &symbols)))
+        .collect();
+        Ok(Self { path, kernels })
+    }
+
+    /// The path of the meta-kernel.
+    pub fn path(&self) -> &Path {
+        &self.path
+    }
+
+    /// The kernels to be loaded, in order, with path symbols substituted.
+    pub fn kernels(&self) -> &[PathBuf] {
+        &self.kernels
+    }
+
+    /// Check that every listed kernel can be opened, and read the parts of each kernel that
+    /// loading it will read, using up to `threads` threads.
+    ///
+    /// The error for the first listed kernel that cannot be opened is returned.
+    pub fn prefetch(&self, threads: usize) -> Result<(), Error> {
+        let next = AtomicUsize::new(0);
+        let errors = Mutex::new(Vec::new());
+        thread::scope(|scope| {
+            for _ in 0..threads.clamp(1, self.kernels.len().max(1)) {
+                scope.spawn(|| loop {
+                    let index = next.fetch_add(1, Ordering::Relaxed);
+                    let Some(kernel) = self.kernels.get(index) else {
+                        break;
+                    };
+                    if let Err(error) = self.prefetch_kernel(kernel) {
+                        errors.lock().unwrap().push((index, error));
+                    }
+                });
+            }
+        });
+        let mut errors = errors.into_inner().unwrap();
+        errors.sort_by_key(|(index, _)| *index);
+        match errors.into_iter().next() {
+            Some((_, error)) => Err(error),
+            None => Ok(()),
+        }
+    }
+
+    fn prefetch_kernel(&self, kernel: &Path) -> Result<(), Error> {
+        let mut file = File::open(kernel).map_err(|error| {
+            let short_message = match error.kind() {
+                ErrorKind::NotFound => "SPICE(NOSUCHFILE)",
+                _ => "SPICE(FILEREADFAILED)",
+            };
+            Error::new(
+                short_message,
+                format!(
+                    "The kernel {} listed in meta-kernel {} could not be opened: {error}",
+                    kernel.display(),
+                    self.path.display()
+                ),
+            )
+        })?;
+        let mut record = [0u8; RECORD_LENGTH];
+        let length = read_up_to(&mut file, &mut record);
+        if record[..length].starts_with(b"DAF/") || record[..length].starts_with(b"NAIF/DAF") {
+            // Read the first summary record, which is the first record read when the file is
+            // searched for segments.
+            if length >= 96 {
+                let forward = match &record[88..96] {
+                    b"BIG-IEEE" => i32::from_be_bytes(record[76..80].try_into().unwrap()),
+                    _ => i32::from_le_bytes(record[76..80].try_into().unwrap()),
+                };
+                if forward > 1
+                    && file
+                        .seek(SeekFrom::Start((forward as u64 - 1) * RECORD_LENGTH as u64))
+                        .is_ok()
+                {
+                    read_up_to(&mut file, &mut record);
+                }
+            }
+        } else if !record[..length].starts_with(b"DAS/")
+            && !record[..length].starts_with(b"NAIF/DAS")
+        {
+            // Text kernels are read in full when they are loaded.
+            let mut buffer = Vec::new();
+            let _ = file.read_to_end(&mut buffer);
+        }
+        Ok(())
+    }
+
+    /// Load the meta-kernel, and so the kernels it lists, with [furnish()].
+    pub fn furnish(&self) -> Result<(), Error> {
+        furnish(self.path.to_string_lossy().as_ref())
+    }
+}
+
+/// Read as many bytes as are available, up to the length of `buffer`.
+fn read_up_to(file: &mut File, buffer: &mut [u8]) -> usize {
+    let mut length = 0;
+    while length < buffer.len() {
+        match file.read(&mut buffer[length..]) {
+            Ok(0) | Err(_) => break,
+            Ok(n) => length += n,
+        }
+    }
+    length
+}
+
+/// Load a meta-kernel, first checking and reading ahead the kernels it lists in parallel.
+///
+/// If any listed kernel cannot be opened, an error is returned before any kernel is loaded.
+/// Otherwise the result is the same as that of [furnish()] on the meta-kernel.
+pub fn furnish_parallel<P: AsRef<Path>>(meta_kernel: P) -> Result<(), Error> {
+    let meta_kernel = MetaKernel::read(meta_kernel)?;
+    let threads = thread::available_parallelism().map_or(1, |n| n.get());
+    meta_kernel.prefetch(threads)?;
+    meta_kernel.furnish()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_parse() {
+        let text = "Comments\n\\begindata\nPATH_VALUES = ( '/data/a+'\n 'b', '/x' )\n\
+            PATH_SYMBOLS = ( 'AB', 'A' )\nKERNELS_TO_LOAD = ( '$AB/one.bsp',\n\
+            '$A/two+' 'parts.tls' )\nKERNELS_TO_LOAD += '$B/three.tpc'\n\
+            \\begintext\nKERNELS_TO_LOAD = ( 'ignored' )\n";
+        let meta_kernel = MetaKernel::parse("meta.tm", text).unwrap();
+        assert_eq!(
+            meta_kernel.kernels(),
+            &[
+                PathBuf::from("/data/ab/one.bsp"),
+                PathBuf::from("/x/twoparts.tls"),
+                PathBuf::from("$B/three.tpc"),
+            ]
+        );
+
+        let error = MetaKernel::parse("meta.tm", "\\begindata\nPATH_SYMBOLS = 'A'\n").unwrap_err();
+        assert_eq!(error.short_message, "SPICE(PATHMISMATCH)");
+    }
+
+    #[test]
+    fn test_furnish_parallel() {
+        let path = PathBuf::from(env!("CARGO_MANIFEST_DIR")).join("test_data/testkernel.txt");
+        let meta_kernel = MetaKernel::read(&path).unwrap();
+        assert_eq!(meta_kernel.kernels().len(), 2);
+        furnish_parallel(&path).unwrap();
+
+        let missing = std::env::temp_dir().join(format!("cspice-test-{}.tm", std::process::id()));
+        std::fs::write(
+            &missing,
+            "\\begindata\nKERNELS_TO_LOAD = ( 'test_data/naif0012.tls' 'no_such_kernel.bsp' )\n",
+        )
+        .unwrap();
+        let error = furnish_parallel(&missing).unwrap_err();
+        std::fs::remove_file(&missing).unwrap();
+        assert_eq!(error.short_message, "SPICE(NOSUCHFILE)");
+    }
+}
@@ -0,0 +1,493 @@
+//! Functions for loading and unloading SPICE Kernels, finding their coverage, and tuning how kernels
+//! are written.
+pub mod coverage;
+pub mod meta;
+pub mod pool;
+
+use crate::error::get_last_error;
+use crate::string::StringParam;
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{dafwbs_c, furnsh_c, unload_c, SpiceInt};
+
+/// Load one or more SPICE kernels into a program.
+///
+/// See [furnsh_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/furnsh_c.html).
+pub fn furnish<'f, F: Into<StringParam<'f>>>(file: F) -> Result<(), Error> {
+    with_spice_lock_or_panic(|| {
+        unsafe {
+            furnsh_c(file.into().as_mut_ptr());
+        };
+        get_last_error()
+    })
+}
+
+/// Unload a SPICE kernel.
+///
+/// See [unload_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/unload_c.html).
+pub fn unload<'f, F: Into<StringParam<'f>>>(file: F) -> Result<(), Error> {
+    with_spice_lock_or_panic(|| {
+        unsafe {
+            unload_c(file.into().as_mut_ptr());
+        };
+        get_last_error()
+    })
+}
+
+/// Set the number of 1024-byte records of data that may be held in memory for each segment being
+/// written to an SPK, CK or other DAF-based kernel. Segment data are then written in large runs of
+/// records rather than a few numbers at a time, which greatly speeds up writing large segments.
+/// Zero, the default, disables buffering.
+///
+/// Buffered data are written before the segment's descriptor, so the file never describes data
+/// that have not been written. Fails with `SPICE(VALUEOUTOFRANGE)` if `records` is more than
+/// `SpiceInt::MAX / 128`.
+///
+/// See [dafwbs_c](https://github.com/jacob-pro/cspice-rs/blob/master/cspice-fork/src/cspice/dafwbs_c.c).
+pub fn set_write_buffer(records: usize) -> Result<(), Error> {
+    // A count too large for a SpiceInt is out of range too, and is rejected by dafwbs_c
+    let records = SpiceInt::try_from(records).unwrap_or(SpiceInt::MAX);
+    with_spice_lock_or_panic(|| {
+        unsafe { dafwbs_c(records) };
+        get_last_error()
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::string::SpiceString;
+    use cspice_sys::{
+        dasadd_c, dasadi_c, dascls_c, dasllc_c, dasonw_c, dasopr_c, dasrdd_c, dasrdi_c, daswbr_c,
+        dlabfs_c, dskcls_c, dskmi2_c, dskopn_c, dskw02_c, dskx02_c, ftncls_c, SpiceBoolean,
+        SpiceChar, SpiceDLADescr, SpiceDouble, SPICEFALSE, SPICETRUE, SPICE_DSK02_IXIFIX,
+        SPICE_DSK02_SPADSZ, SPICE_DSK_GENCLS, SPICE_DSK_LATSYS, SPICE_DSK_NSYPAR,
+    };
+    use std::path::PathBuf;
+
+    /// The value of integer `i` (counting from 0) in a DAS file written by [write_das()].
+    fn das_int(seed: usize, i: usize) -> SpiceInt {
+        (seed * 1_000_000 + i) as SpiceInt
+    }
+
+    /// The value of double precision number `i` in a DAS file written by [write_das()].
+    fn das_double(seed: usize, i: usize) -> SpiceDouble {
+        seed as SpiceDouble * 1e6 + i as SpiceDouble / 2.0
+    }
+
+    /// Write a DAS file holding `chunks` alternating clusters of `ints` integers and `doubles`
+    /// double precision numbers. Unless `segregate` is set, the file is closed without
+    /// segregating its records by data type, so its directory describes every cluster.
+    fn write_das(
+        name: &str,
+        seed: usize,
+        chunks: usize,
+        ints: usize,
+        doubles: usize,
+        segregate: bool,
+    ) -> PathBuf {
+        let path =
+            std::env::temp_dir().join(format!("cspice-test-{}-{}.das", std::process::id(), name));
+        let _ = std::fs::remove_file(&path);
+        let file = SpiceString::from(path.to_string_lossy());
+        unsafe {
+            let mut handle = 0;
+            dasonw_c(
+                file.as_mut_ptr(),
+                SpiceString::from("TEST").as_mut_ptr(),
+                file.as_mut_ptr(),
+                0,
+                &mut handle,
+            );
+            for chunk in 0..chunks {
+                let data: Vec<SpiceInt> = (chunk * ints..(chunk + 1) * ints)
+                    .map(|i| das_int(seed, i))
+                    .collect();
+                dasadi_c(handle, ints as SpiceInt, data.as_ptr());
+                let data: Vec<SpiceDouble> = (chunk * doubles..(chunk + 1) * doubles)
+                    .map(|i| das_double(seed, i))
+                    .collect();
+                dasadd_c(handle, doubles as SpiceInt, data.as_ptr());
+            }
+            if segregate {
+                dascls_c(handle);
+            } else {
+                daswbr_c(handle);
+                dasllc_c(handle);
+            }
+        }
+        get_last_error().unwrap();
+        path
+    }
+
+    #[test]
+    fn test_furnish() {
+        let error = furnish("NON_EXISTENT_FILE").err().unwrap();
+        assert_eq!(error.short_message, "SPICE(NOSUCHFILE)");
+    }
+
+    #[test]
+    fn test_set_write_buffer() {
+        let max = (SpiceInt::MAX / 128) as usize;
+        for records in [max + 1, usize::MAX] {
+            let error = set_write_buffer(records).unwrap_err();
+            assert_eq!(error.short_message, "SPICE(VALUEOUTOFRANGE)");
+        }
+        set_write_buffer(0).unwrap();
+    }
+
+    #[test]
+    fn test_das_many_files() {
+        const FILES: usize = 24;
+        const CHUNKS: usize = 6;
+        const INTS: usize = 300;
+        const DOUBLES: usize = 200;
+        let paths: Vec<_> = (0..FILES)
+            .map(|f| write_das(&f.to_string(), f, CHUNKS, INTS, DOUBLES, f % 2 == 0))
+            .collect();
+        let handles: Vec<SpiceInt> = paths
+            .iter()
+            .map(|path| {
+                let mut handle = 0;
+                unsafe {
+                    dasopr_c(
+                        SpiceString::from(path.to_string_lossy()).as_mut_ptr(),
+                        &mut handle,
+                    )
+                };
+                handle
+            })
+            .collect();
+        get_last_error().unwrap();
+
+        // Read ranges that span cluster boundaries from each file in turn, so that every file's
+        // address map is used while more than 20 files are open.
+        let check = |f: usize, handle: SpiceInt, start: usize| {
+            let mut ints = [0; 50];
+            let mut doubles = [0.0; 50];
+            let start_double = start % (CHUNKS * DOUBLES - 50);
+            unsafe {
+                dasrdi_c(
+                    handle,
+                    start as SpiceInt + 1,
+                    start as SpiceInt + 50,
+                    ints.as_mut_ptr(),
+                );
+                dasrdd_c(
+                    handle,
+                    start_double as SpiceInt + 1,
+                    start_double as SpiceInt + 50,
+                    doubles.as_mut_ptr(),
+                );
+            }
+            get_last_error().unwrap();
+            for i in 0..50 {
+                assert_eq!(ints[i], das_int(f, start + i));
+                assert_eq!(doubles[i], das_double(f, start_double + i));
+            }
+        };
+        for start in (0..CHUNKS * INTS - 50).step_by(277) {
+            for (f, &handle) in handles.iter().enumerate() {
+                check(f, handle, start);
+            }
+        }
+
+        // Files closed are removed from the file table, and can be opened again.
+        for &handle in &handles[..FILES / 2] {
+            unsafe { dascls_c(handle) };
+        }
+        for (f, path) in paths.iter().enumerate().take(FILES / 2) {
+            let mut handle = 0;
+            unsafe {
+                dasopr_c(
+                    SpiceString::from(path.to_string_lossy()).as_mut_ptr(),
+                    &mut handle,
+                )
+            };
+            get_last_error().unwrap();
+            check(f, handle, 1234);
+            unsafe { dascls_c(handle) };
+        }
+        for (f, &handle) in handles.iter().enumerate().skip(FILES / 2) {
+            check(f, handle, 1234);
+            unsafe { dascls_c(handle) };
+        }
+        get_last_error().unwrap();
+        for path in paths {
+            let _ = std::fs::remove_file(path);
+        }
+    }
+
+    #[test]
+    fn test_das_sequential_read() {
+        const INTS: usize = 40_000;
+        const DOUBLES: usize = 20_000;
+        let paths = [
+            write_das("sequential-0", 0, 1, INTS, DOUBLES, true),
+            write_das("sequential-1", 1, 4, INTS / 4, DOUBLES / 4, false),
+        ];
+        let handles = paths.clone().map(|path| {
+            let mut handle = 0;
+            unsafe {
+                dasopr_c(
+                    SpiceString::from(path.to_string_lossy()).as_mut_ptr(),
+                    &mut handle,
+                )
+            };
+            handle
+        });
+        get_last_error().unwrap();
+
+        // Scan both files forwards a record at a time, so that records are read ahead, then
+        // backwards, so that buffered records are evicted and read again.
+        let forwards = (0..INTS).step_by(256);
+        let backwards = (0..INTS).step_by(1000).rev();
+        for start in forwards.chain(backwards) {
+            for (f, &handle) in handles.iter().enumerate() {
+                let last = (start + 256).min(INTS);
+                let mut ints = vec![0; last - start];
+                let first_double = start / 2;
+                let last_double = (first_double + 128).min(DOUBLES);
+                let mut doubles = vec![0.0; last_double - first_double];
+                unsafe {
+                    dasrdi_c(
+                        handle,
+                        start as SpiceInt + 1,
+                        last as SpiceInt,
+                        ints.as_mut_ptr(),
+                    );
+                    dasrdd_c(
+                        handle,
+                        first_double as SpiceInt + 1,
+                        last_double as SpiceInt,
+                        doubles.as_mut_ptr(),
+                    );
+                }
+                get_last_error().unwrap();
+                for (i, &value) in ints.iter().enumerate() {
+                    assert_eq!(value, das_int(f, start + i));
+                }
+                for (i, &value) in doubles.iter().enumerate() {
+                    assert_eq!(value, das_double(f, first_double + i));
+                }
+            }
+        }
+
+        for (handle, path) in handles.into_iter().zip(paths) {
+            unsafe { dascls_c(handle) };
+            let _ = std::fs::remove_file(path);
+        }
+        get_last_error().unwrap();
+    }
+
+    extern "C" {
+        fn txtopn_(fname: *const SpiceChar, unit: *mut SpiceInt, fname_len: SpiceInt) -> SpiceInt;
+        fn txtopr_(fname: *const SpiceChar, unit: *mut SpiceInt, fname_len: SpiceInt) -> SpiceInt;
+        fn wrencd_(unit: *mut SpiceInt, n: *mut SpiceInt, data: *mut SpiceDouble) -> SpiceInt;
+        fn rdencd_(unit: *mut SpiceInt, n: *mut SpiceInt, data: *mut SpiceDouble) -> SpiceInt;
+    }
+
+    #[test]
+    fn test_transfer_encoding() {
+        // Values encoded in blocks, and values that fall back to formatted I/O, such as
+        // subnormal numbers
+        let mut values = vec![
+            0.0,
+            -1.0,
+            std::f64::consts::PI,
+            1e300,
+            -1e-300,
+            SpiceDouble::MAX,
+            SpiceDouble::MIN_POSITIVE,
+            5e-324,
+        ];
+        let mut bits = 0x9e3779b97f4a7c15u64;
+        while values.len() < 3000 {
+            bits = bits
+                .wrapping_mul(6364136223846793005)
+                .wrapping_add(1442695040888963407);
+            let value = SpiceDouble::from_bits(bits);
+            if value.is_finite() {
+                values.push(value);
+            }
+        }
+
+        let path = std::env::temp_dir().join(format!("cspice-test-{}.xfr", std::process::id()));
+        let _ = std::fs::remove_file(&path);
+        let name = path.to_string_lossy().into_owned();
+        let name_len = name.len() as SpiceInt;
+        let mut read = vec![0.0; values.len()];
+        unsafe {
+            let mut unit = 0;
+            txtopn_(name.as_ptr() as *const SpiceChar, &mut unit, name_len);
+            // Several writes, so that blocks start part way through the values
+            for chunk in values.chunks_mut(1000) {
+                let mut n = chunk.len() as SpiceInt;
+                wrencd_(&mut unit, &mut n, chunk.as_mut_ptr());
+            }
+            ftncls_c(unit);
+            txtopr_(name.as_ptr() as *const SpiceChar, &mut unit, name_len);
+            for chunk in read.chunks_mut(750) {
+                let mut n = chunk.len() as SpiceInt;
+                rdencd_(&mut unit, &mut n, chunk.as_mut_ptr());
+            }
+            ftncls_c(unit);
+        }
+        get_last_error().unwrap();
+        std::fs::remove_file(&path).unwrap();
+        for (value, read) in values.iter().zip(&read) {
+            assert_eq!(value.to_bits(), read.to_bits());
+        }
+    }
+
+    #[test]
+    fn test_dsk_spatial_index() {
+        // A sphere of unit radius tessellated in latitude bands, with a vertex at each pole
+        const BANDS: usize = 16;
+        const SECTORS: usize = 32;
+        let mut vertices = vec![[0.0, 0.0, 1.0], [0.0, 0.0, -1.0]];
+        for band in 1..BANDS {
+            let colatitude = std::f64::consts::PI * band as f64 / BANDS as f64;
+            for sector in 0..SECTORS {
+                let longitude = std::f64::consts::TAU * sector as f64 / SECTORS as f64;
+                vertices.push([
+                    colatitude.sin() * longitude.cos(),
+                    colatitude.sin() * longitude.sin(),
+                    colatitude.cos(),
+                ]);
+            }
+        }
+        // Vertex and plate IDs count from 1
+        let ring =
+            |band: usize, sector: usize| (3 + (band - 1) * SECTORS + sector % SECTORS) as SpiceInt;
+        let mut plates = Vec::new();
+        for sector in 0..SECTORS {
+            plates.push([1, ring(1, sector), ring(1, sector + 1)]);
+            plates.push([2, ring(BANDS - 1, sector + 1), ring(BANDS - 1, sector)]);
+            for band in 1..BANDS - 1 {
+                plates.push([
+                    ring(band, sector),
+                    ring(band + 1, sector),
+                    ring(band + 1, sector + 1),
+                ]);
+                plates.push([
+                    ring(band, sector),
+                    ring(band + 1, sector + 1),
+                    ring(band, sector + 1),
+                ]);
+            }
+        }
+
+        const WORKSZ: usize = 100_000;
+        const VOXPSZ: SpiceInt = 100_000;
+        const VOXLSZ: SpiceInt = 200_000;
+        let spxisz = SPICE_DSK02_IXIFIX as usize
+            + VOXPSZ as usize
+            + VOXLSZ as usize
+            + 2 * vertices.len()
+            + 3 * plates.len();
+        let mut work = vec![[0; 2]; WORKSZ];
+        let mut spaixd = [0.0; SPICE_DSK02_SPADSZ as usize];
+        let mut spaixi = vec![0; spxisz];
+        let path = std::env::temp_dir().join(format!("cspice-test-{}.bds", std::process::id()));
+        let _ = std::fs::remove_file(&path);
+        let file = SpiceString::from(path.to_string_lossy());
+        unsafe {
+            dskmi2_c(
+                vertices.len() as SpiceInt,
+                vertices.as_ptr(),
+                plates.len() as SpiceInt,
+                plates.as_ptr(),
+                5.0,
+                4,
+                WORKSZ as SpiceInt,
+                VOXPSZ,
+                VOXLSZ,
+                SPICETRUE as SpiceBoolean,
+                spxisz as SpiceInt,
+                work.as_mut_ptr(),
+                spaixd.as_mut_ptr(),
+                spaixi.as_mut_ptr(),
+            );
+            get_last_error().unwrap();
+
+            let mut handle = 0;
+            let corpar = [0.0; SPICE_DSK_NSYPAR as usize];
+            dskopn_c(file.as_mut_ptr(), file.as_mut_ptr(), 0, &mut handle);
+            dskw02_c(
+                handle,
+                499,
+                1,
+                SPICE_DSK_GENCLS as SpiceInt,
+                SpiceString::from("J2000").as_mut_ptr(),
+                SPICE_DSK_LATSYS as SpiceInt,
+                corpar.as_ptr(),
+                -std::f64::consts::PI,
+                std::f64::consts::PI,
+                -std::f64::consts::FRAC_PI_2,
+                std::f64::consts::FRAC_PI_2,
+                0.9,
+                1.0,
+                -1e9,
+                1e9,
+                vertices.len() as SpiceInt,
+                vertices.as_ptr(),
+                plates.len() as SpiceInt,
+                plates.as_ptr(),
+                spaixd.as_ptr(),
+                spaixi.as_ptr(),
+            );
+            dskcls_c(handle, SPICETRUE as SpiceBoolean);
+            get_last_error().unwrap();
+
+            // Every ray aimed at the centre must find, through the voxel-plate lists, a plate
+            // near the point where it meets the tessellated sphere.
+            dasopr_c(file.as_mut_ptr(), &mut handle);
+            let mut dladsc: SpiceDLADescr = std::mem::zeroed();
+            let mut found: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+            dlabfs_c(handle, &mut dladsc, &mut found);
+            assert_ne!(found, SPICEFALSE as SpiceBoolean);
+            for i in 0..40 {
+                for j in 0..40 {
+                    let colatitude = std::f64::consts::PI * (i as f64 + 0.37) / 40.0;
+                    let longitude = std::f64::consts::TAU * (j as f64 + 0.21) / 40.0;
+                    let direction = [
+                        colatitude.sin() * longitude.cos(),
+                        colatitude.sin() * longitude.sin(),
+                        colatitude.cos(),
+                    ];
+                    let vertex = direction.map(|x| 10.0 * x);
+                    let ray = direction.map(|x| -x);
+                    let mut plate = 0;
+                    let mut point = [0.0; 3];
+                    dskx02_c(
+                        handle,
+                        &dladsc,
+                        vertex.as_ptr(),
+                        ray.as_ptr(),
+                        &mut plate,
+                        point.as_mut_ptr(),
+                        &mut found,
+                    );
+                    get_last_error().unwrap();
+                    assert_ne!(found, SPICEFALSE as SpiceBoolean);
+                    let radius = point.iter().map(|x| x * x).sum::<f64>().sqrt();
+                    assert!((0.97..=1.0 + 1e-12).contains(&radius));
+                    let centroid = plates[plate as usize - 1]
+                        .iter()
+                        .map(|&v| vertices[v as usize - 1])
+                        .fold([0.0; 3], |c, v| {
+                            [c[0] + v[0] / 3.0, c[1] + v[1] / 3.0, c[2] + v[2] / 3.0]
+                        });
+                    let distance = (0..3)
+                        .map(|k| (point[k] - centroid[k]).powi(2))
+                        .sum::<f64>()
+                        .sqrt();
+                    assert!(distance < 0.2);
+                }
+            }
+            dascls_c(handle);
+        }
+        get_last_error().unwrap();
+        std::fs::remove_file(&path).unwrap();
+    }
+}
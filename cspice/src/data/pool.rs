@@ -0,0 +1,420 @@
+//! Reading and writing kernel pool variables, and saving the kernel pool to a snapshot file.
+//!
+//! Parsing a large set of text kernels can take much longer than loading the values they define.
+//! A [PoolSnapshot] holds every variable in the kernel pool and can be written to a compact binary
+//! file, so that a later run can restore the pool with a single read instead of parsing the text
+//! kernels again.
+//!
+//! Restoring a snapshot defines the variables as [put_variable()] does: the text kernels the values
+//! came from are not registered as loaded, so they cannot be unloaded with
+//! [unload()](super::unload).
+use crate::error::get_last_error;
+use crate::string::{SpiceStr, SpiceString};
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{
+    dtpool_c, gcpool_c, gdpool_c, gnpool_c, pcpool_c, pdpool_c, SpiceBoolean, SpiceChar, SpiceInt,
+    SPICEFALSE,
+};
+use std::path::Path;
+
+/// The maximum length of the name of a kernel pool variable.
+const MAXLEN: usize = 32;
+
+/// The maximum length of a string value of a kernel pool variable.
+const MAXCHR: usize = 80;
+
+/// The number of names or values fetched from the kernel pool at once.
+const ROOM: usize = 100;
+
+/// Identifies snapshot files, followed by the format version.
+const MAGIC: &[u8; 8] = b"SPCPOOL\0";
+const VERSION: u32 = 1;
+
+/// The values of a kernel pool variable.
+#[derive(Clone, Debug, PartialEq)]
+pub enum PoolValues {
+    Numeric(Vec<f64>),
+    Character(Vec<String>),
+}
+
+/// The names of the kernel pool variables matching `pattern`, which may contain the wildcards `*`
+/// and `%`.
+///
+/// See [gnpool_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gnpool_c.html).
+pub fn variable_names(pattern: &str) -> Result<Vec<String>, Error> {
+    let pattern = SpiceString::from(pattern);
+    with_spice_lock_or_panic(|| {
+        let mut names = Vec::new();
+        let mut buffer = vec![0 as SpiceChar; ROOM * (MAXLEN + 1)];
+        loop {
+            let mut n: SpiceInt = 0;
+            let mut found: SpiceBoolean = 0;
+            unsafe {
+                gnpool_c(
+                    pattern.as_mut_ptr(),
+                    names.len() as SpiceInt,
+                    ROOM as SpiceInt,
+                    (MAXLEN + 1) as SpiceInt,
+                    &mut n,
+                    buffer.as_mut_ptr() as *mut _,
+                    &mut found,
+                );
+            }
+            get_last_error()?;
+            if found == SPICEFALSE as SpiceBoolean || n == 0 {
+                break;
+            }
+            names.extend(
+                buffer
+                    .chunks(MAXLEN + 1)
+                    .take(n as usize)
+                    .map(|name| SpiceStr::from_buffer(name).as_str().into_owned()),
+            );
+            if (n as usize) < ROOM {
+                break;
+            }
+        }
+        Ok(names)
+    })
+}
+
+/// The values of the kernel pool variable `name`, or `None` if it is not defined.
+///
+/// See [gdpool_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gdpool_c.html) and
+/// [gcpool_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gcpool_c.html).
+pub fn get_variable(name: &str) -> Result<Option<PoolValues>, Error> {
+    let name = SpiceString::from(name);
+    with_spice_lock_or_panic(|| {
+        let mut found: SpiceBoolean = 0;
+        let mut size: SpiceInt = 0;
+        let mut kind: SpiceChar = 0;
+        unsafe { dtpool_c(name.as_mut_ptr(), &mut found, &mut size, &mut kind) };
+        get_last_error()?;
+        if found == SPICEFALSE as SpiceBoolean {
+            return Ok(None);
+        }
+        let size = size as usize;
+        let mut n: SpiceInt = 0;
+        if kind as u8 == b'N' {
+            let mut values = vec![0.0; size];
+            unsafe {
+                gdpool_c(
+                    name.as_mut_ptr(),
+                    0,
+                    size as SpiceInt,
+                    &mut n,
+                    values.as_mut_ptr(),
+                    &mut found,
+                )
+            };
+            get_last_error()?;
+            values.truncate(n as usize);
+            Ok(Some(PoolValues::Numeric(values)))
+        } else {
+            let mut buffer = vec![0 as SpiceChar; size * (MAXCHR + 1)];
+            unsafe {
+                gcpool_c(
+                    name.as_mut_ptr(),
+                    0,
+                    size as SpiceInt,
+                    (MAXCHR + 1) as SpiceInt,
+                    &mut n,
+                    buffer.as_mut_ptr() as *mut _,
+                    &mut found,
+                )
+            };
+            get_last_error()?;
+            let values = buffer
+                .chunks(MAXCHR + 1)
+                .take(n as usize)
+                .map(|value| SpiceStr::from_buffer(value).as_str().into_owned())
+                .collect();
+            Ok(Some(PoolValues::Character(values)))
+        }
+    })
+}
+
+/// Define the kernel pool variable `name`, replacing any existing values. A variable must have at
+/// least one value.
+///
+/// See [pdpool_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/pdpool_c.html) and
+/// [pcpool_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/pcpool_c.html).
+pub fn put_variable(name: &str, values: &PoolValues) -> Result<(), Error> {
+    let count = match values {
+        PoolValues::Numeric(values) => values.len(),
+        PoolValues::Character(values) => values.len(),
+    };
+    if count == 0 {
+        return Err(Error::new(
+            "SPICE(BADVARIABLESIZE)",
+            format!("The kernel pool variable {name} must have at least one value."),
+        ));
+    }
+    let name = SpiceString::from(name);
+    with_spice_lock_or_panic(|| {
+        match values {
+            PoolValues::Numeric(values) => unsafe {
+                pdpool_c(name.as_mut_ptr(), values.len() as SpiceInt, values.as_ptr())
+            },
+            PoolValues::Character(values) => {
+                let length = values.iter().map(String::len).max().unwrap_or(0) + 1;
+                let mut buffer = vec![0 as SpiceChar; values.len() * length];
+                for (value, slot) in values.iter().zip(buffer.chunks_mut(length)) {
+                    for (c, b) in slot.iter_mut().zip(value.bytes()) {
+                        *c = b as SpiceChar;
+                    }
+                }
+                unsafe {
+                    pcpool_c(
+                        name.as_mut_ptr(),
+                        values.len() as SpiceInt,
+                        length as SpiceInt,
+                        buffer.as_ptr() as *const _,
+                    )
+                }
+            }
+        }
+        get_last_error()
+    })
+}
+
+/// The contents of the kernel pool.
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct PoolSnapshot {
+    variables: Vec<(String, PoolValues)>,
+}
+
+impl PoolSnapshot {
+    /// Copy every variable in the kernel pool.
+    pub fn capture() -> Result<Self, Error> {
+        with_spice_lock_or_panic(|| {
+            let mut variables = Vec::new();
+            for name in variable_names("*")? {
+                if let Some(values) = get_variable(&name)? {
+                    variables.push((name, values));
+                }
+            }
+            Ok(Self { variables })
+        })
+    }
+
+    /// The variables in the snapshot.
+    pub fn variables(&self) -> &[(String, PoolValues)] {
+        &self.variables
+    }
+
+    /// Define every variable in the snapshot in the kernel pool.
+    pub fn restore(&self) -> Result<(), Error> {
+        with_spice_lock_or_panic(|| {
+            for (name, values) in &self.variables {
+                put_variable(name, values)?;
+            }
+            Ok(())
+        })
+    }
+
+    /// Encode the snapshot.
+    ///
+    /// Numbers are written in little-endian order, and strings are preceded by their length.
+    pub fn to_bytes(&self) -> Vec<u8> {
+        fn put_string(bytes: &mut Vec<u8>, s: &str) {
+            bytes.extend_from_slice(&(s.len() as u32).to_le_bytes());
+            bytes.extend_from_slice(s.as_bytes());
+        }
+        let mut bytes = Vec::new();
+        bytes.extend_from_slice(MAGIC);
+        bytes.extend_from_slice(&VERSION.to_le_bytes());
+        bytes.extend_from_slice(&(self.variables.len() as u32).to_le_bytes());
+        for (name, values) in &self.variables {
+            put_string(&mut bytes, name);
+            match values {
+                PoolValues::Numeric(values) => {
+                    bytes.push(b'N');
+                    bytes.extend_from_slice(&(values.len() as u32).to_le_bytes());
+                    for value in values {
+                        bytes.extend_from_slice(&value.to_le_bytes());
+                    }
+                }
+                PoolValues::Character(values) => {
+                    bytes.push(b'C');
+                    bytes.extend_from_slice(&(values.len() as u32).to_le_bytes());
+                    for value in values {
+                        put_string(&mut bytes, value);
+                    }
+                }
+            }
+        }
+        bytes
+    }
+
+    /// Decode a snapshot encoded by [PoolSnapshot::to_bytes].
+    pub fn from_bytes(bytes: &[u8]) -> Result<Self, Error> {
+        let mut reader = Reader { rest: bytes };
+        if reader.take(MAGIC.len())? != MAGIC {
+            return Err(Error::new(
+                "SPICE(INVALIDFORMAT)",
+                "The data is not a kernel pool snapshot.",
+            ));
+        }
+        let version = reader.u32()?;
+        if version != VERSION {
+            return Err(Error::new("SPICE(INVALIDFORMAT)", format!(
+                "The kernel pool snapshot has format version {version}; the supported version is {VERSION}."
+            )));
+        }
+        let count = reader.u32()? as usize;
+        let mut variables = Vec::with_capacity(count.min(bytes.len()));
+        for _ in 0..count {
+            let name = reader.string()?;
+            let kind = reader.take(1)?[0];
+            let n = reader.u32()? as usize;
+            let values = match kind {
+                b'N' => {
+                    let length = n.checked_mul(8).ok_or_else(|| {
+                        Error::new(
+                            "SPICE(INVALIDFORMAT)",
+                            format!("The kernel pool variable {name} has too many values."),
+                        )
+                    })?;
+                    PoolValues::Numeric(
+                        reader
+                            .take(length)?
+                            .chunks_exact(8)
+                            .map(|b| f64::from_le_bytes(b.try_into().unwrap()))
+                            .collect(),
+                    )
+                }
+                b'C' => PoolValues::Character(
+                    (0..n).map(|_| reader.string()).collect::<Result<_, _>>()?,
+                ),
+                _ => {
+                    return Err(Error::new(
+                        "SPICE(INVALIDFORMAT)",
+                        format!("The kernel pool variable {name} has unknown type code {kind}."),
+                    ))
+                }
+            };
+            variables.push((name, values));
+        }
+        Ok(Self { variables })
+    }
+
+    /// Write the snapshot to the file at `path`.
+    pub fn write<P: AsRef<Path>>(&self, path: P) -> Result<(), Error> {
+        let path = path.as_ref();
+        std::fs::write(path, self.to_bytes()).map_err(|error| {
+            Error::new(
+                "SPICE(FILEWRITEFAILED)",
+                format!("Could not write {}: {error}", path.display()),
+            )
+        })
+    }
+
+    /// Read a snapshot from the file at `path`.
+    pub fn read<P: AsRef<Path>>(path: P) -> Result<Self, Error> {
+        let path = path.as_ref();
+        let bytes = std::fs::read(path).map_err(|error| {
+            Error::new(
+                "SPICE(FILEREADFAILED)",
+                format!("Could not read {}: {error}", path.display()),
+            )
+        })?;
+        Self::from_bytes(&bytes)
+    }
+}
+
+/// Reads the fields of an encoded snapshot in order.
+struct Reader<'a> {
+    rest: &'a [u8],
+}
+
+impl<'a> Reader<'a> {
+    fn take(&mut self, n: usize) -> Result<&'a [u8], Error> {
+        if self.rest.len() < n {
+            return Err(Error::new(
+                "SPICE(INVALIDFORMAT)",
+                "The kernel pool snapshot is truncated.",
+            ));
+        }
+        let (head, tail) = self.rest.split_at(n);
+        self.rest = tail;
+        Ok(head)
+    }
+
+    fn u32(&mut self) -> Result<u32, Error> {
+        Ok(u32::from_le_bytes(self.take(4)?.try_into().unwrap()))
+    }
+
+    fn string(&mut self) -> Result<String, Error> {
+        let length = self.u32()? as usize;
+        Ok(String::from_utf8_lossy(self.take(length)?).into_owned())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::data::{furnish, unload};
+    use crate::tests::load_test_data;
+
+    #[test]
+    fn test_snapshot() {
+        load_test_data();
+        put_variable(
+            "CSPICE_TEST_STRINGS",
+            &PoolValues::Character(vec!["one".to_string(), "it's two".to_string()]),
+        )
+        .unwrap();
+        let snapshot = PoolSnapshot::capture().unwrap();
+        let delta = get_variable("DELTET/DELTA_T_A").unwrap().unwrap();
+        assert_eq!(delta, PoolValues::Numeric(vec![32.184]));
+        assert!(snapshot
+            .variables()
+            .iter()
+            .any(|(name, values)| name == "DELTET/DELTA_T_A" && values == &delta));
+
+        let path = std::env::temp_dir().join(format!("cspice-test-{}.pool", std::process::id()));
+        snapshot.write(&path).unwrap();
+        let read = PoolSnapshot::read(&path).unwrap();
+        std::fs::remove_file(&path).unwrap();
+        assert_eq!(read, snapshot);
+
+        put_variable("DELTET/DELTA_T_A", &PoolValues::Numeric(vec![0.0])).unwrap();
+        read.restore().unwrap();
+        assert_eq!(get_variable("DELTET/DELTA_T_A").unwrap().unwrap(), delta);
+        assert_eq!(
+            get_variable("CSPICE_TEST_STRINGS").unwrap().unwrap(),
+            PoolValues::Character(vec!["one".to_string(), "it's two".to_string()])
+        );
+
+        let error = PoolSnapshot::from_bytes(&read.to_bytes()[..20]).unwrap_err();
+        assert_eq!(error.short_message, "SPICE(INVALIDFORMAT)");
+        let error = put_variable("CSPICE_TEST_EMPTY", &PoolValues::Numeric(vec![])).unwrap_err();
+        assert_eq!(error.short_message, "SPICE(BADVARIABLESIZE)");
+    }
+
+    #[test]
+    fn test_text_kernel_lines() {
+        // A comment line longer than the buffer lines are read through, blank lines, and a last
+        // line with no line terminator.
+        let text = format!(
+            "KPL/PCK\n\n{}\n\n\\begindata\n\nCSPICE_TEST_LINES = ( 1, 2,\n  3 )\n\
+             CSPICE_TEST_TEXT = 'a line'\n\n\\begintext",
+            "x".repeat(3000)
+        );
+        let path = std::env::temp_dir().join(format!("cspice-test-{}.tpc", std::process::id()));
+        std::fs::write(&path, text).unwrap();
+        furnish(path.to_string_lossy()).unwrap();
+        assert_eq!(
+            get_variable("CSPICE_TEST_LINES").unwrap().unwrap(),
+            PoolValues::Numeric(vec![1.0, 2.0, 3.0])
+        );
+        assert_eq!(
+            get_variable("CSPICE_TEST_TEXT").unwrap().unwrap(),
+            PoolValues::Character(vec!["a line".to_string()])
+        );
+        unload(path.to_string_lossy()).unwrap();
+        std::fs::remove_file(&path).unwrap();
+        assert_eq!(get_variable("CSPICE_TEST_LINES").unwrap(), None);
+    }
+}
@@ -0,0 +1,610 @@
+//! Evaluating constraints on E-kernel columns held in memory.
+//!
+//! A [ColumnarTable] reads selected columns of a table in an EK into contiguous arrays, one set of
+//! arrays per segment. A [Predicate] is then evaluated a whole column at a time, producing a
+//! [Bitmap] of the matching rows of each segment, instead of each row being read through the
+//! paged EK readers and tested separately as in [find()](super::find).
+//!
+//! Unlike the query system, a [ColumnarTable] reads a single EK and only supports scalar columns.
+use crate::common::ComparisonOperator;
+use crate::error::get_last_error;
+use crate::string::{SpiceStr, SpiceString, StringParam};
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{
+    _SpiceDataType_SPICE_CHR, _SpiceDataType_SPICE_INT, ekcls_c, eknseg_c, ekopr_c, ekrcec_c,
+    ekrced_c, ekrcei_c, ekssum_c, SpiceBoolean, SpiceChar, SpiceDouble, SpiceEKSegSum, SpiceInt,
+    SPICEFALSE,
+};
+use std::ffi::c_void;
+use std::mem::MaybeUninit;
+
+/// Length of the buffer for character column values.
+const CVALLN: usize = 1025;
+
+/// The number of rows represented by each word of a [Bitmap].
+const WORD: usize = u64::BITS as usize;
+
+/// A set of rows of a segment, one bit per row.
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct Bitmap {
+    words: Vec<u64>,
+    rows: usize,
+}
+
+impl Bitmap {
+    /// A bitmap of `rows` rows, none of which are set.
+    pub fn new(rows: usize) -> Self {
+        Self {
+            words: vec![0; rows.div_ceil(WORD)],
+            rows,
+        }
+    }
+
+    /// Set the bit of each row for which `f` is true of the corresponding value.
+    ///
+    /// The values are tested in blocks of 64 with no branches, which the compiler can vectorize.
+    fn from_values<T: Copy, F: Fn(T) -> bool>(values: &[T], f: F) -> Self {
+        let mut bitmap = Self::new(values.len());
+        for (word, block) in bitmap.words.iter_mut().zip(values.chunks(WORD)) {
+            *word = block
+                .iter()
+                .enumerate()
+                .fold(0, |bits, (i, &value)| bits | ((f(value) as u64) << i));
+        }
+        bitmap
+    }
+
+    /// The number of rows of the segment.
+    pub fn rows(&self) -> usize {
+        self.rows
+    }
+
+    /// Whether `row` is set.
+    pub fn get(&self, row: usize) -> bool {
+        row < self.rows && self.words[row / WORD] & (1 << (row % WORD)) != 0
+    }
+
+    /// Set `row`.
+    pub fn set(&mut self, row: usize) {
+        assert!(row < self.rows, "row out of range");
+        self.words[row / WORD] |= 1 << (row % WORD);
+    }
+
+    /// The number of rows that are set.
+    pub fn count(&self) -> usize {
+        self.words.iter().map(|w| w.count_ones() as usize).sum()
+    }
+
+    /// The indices of the rows that are set, in increasing order.
+    pub fn iter(&self) -> impl Iterator<Item = usize> + '_ {
+        self.words.iter().enumerate().flat_map(|(i, &word)| {
+            let mut bits = word;
+            std::iter::from_fn(move || {
+                if bits == 0 {
+                    return None;
+                }
+                let bit = bits.trailing_zeros() as usize;
+                bits &= bits - 1;
+                Some(i * WORD + bit)
+            })
+        })
+    }
+
+    /// Keep only the rows that are also set in `other`.
+    pub fn and(&mut self, other: &Bitmap) {
+        for (a, b) in self.words.iter_mut().zip(&other.words) {
+            *a &= b;
+        }
+    }
+
+    /// Add the rows that are set in `other`.
+    pub fn or(&mut self, other: &Bitmap) {
+        for (a, b) in self.words.iter_mut().zip(&other.words) {
+            *a |= b;
+        }
+    }
+
+    /// Remove the rows that are set in `other`.
+    pub fn and_not(&mut self, other: &Bitmap) {
+        for (a, b) in self.words.iter_mut().zip(&other.words) {
+            *a &= !b;
+        }
+    }
+
+    /// Set exactly the rows that are not set.
+    pub fn not(&mut self) {
+        for word in self.words.iter_mut() {
+            *word = !*word;
+        }
+        // Clear the bits past the last row
+        let tail = self.rows % WORD;
+        if tail > 0 {
+            if let Some(last) = self.words.last_mut() {
+                *last &= (1 << tail) - 1;
+            }
+        }
+    }
+}
+
+/// A value to which a column is compared.
+#[derive(Clone, Debug, PartialEq)]
+pub enum Value {
+    /// A value compared with an integer, double precision or time column.
+    Double(SpiceDouble),
+    /// A value compared with an integer, double precision or time column.
+    Int(SpiceInt),
+    /// A value compared with a character column.
+    Char(String),
+}
+
+/// A condition on the rows of a [ColumnarTable].
+#[derive(Clone, Debug, PartialEq)]
+pub enum Predicate {
+    /// The column entry is not null and compares with the value as given by the operator.
+    /// Trailing blanks are not significant in character values.
+    Compare {
+        column: String,
+        operator: ComparisonOperator,
+        value: Value,
+    },
+    /// The column entry is null.
+    IsNull(String),
+    /// Both conditions hold.
+    And(Box<Predicate>, Box<Predicate>),
+    /// Either condition holds.
+    Or(Box<Predicate>, Box<Predicate>),
+    /// The condition does not hold. As in SQL, a comparison with a null entry neither holds nor
+    /// fails, so a row whose entry is null matches neither a comparison nor its negation.
+    Not(Box<Predicate>),
+}
+
+impl Predicate {
+    /// The condition that `column` compares with `value` as given by `operator`.
+    pub fn compare<C: Into<String>>(column: C, operator: ComparisonOperator, value: Value) -> Self {
+        Predicate::Compare {
+            column: column.into(),
+            operator,
+            value,
+        }
+    }
+
+    /// The condition that this and `other` both hold.
+    pub fn and(self, other: Predicate) -> Self {
+        Predicate::And(Box::new(self), Box::new(other))
+    }
+
+    /// The condition that this or `other` holds.
+    pub fn or(self, other: Predicate) -> Self {
+        Predicate::Or(Box::new(self), Box::new(other))
+    }
+}
+
+/// The values of a column in a segment. Time values are held as ephemeris times.
+#[derive(Clone, Debug, PartialEq)]
+pub enum Values {
+    Char(Vec<String>),
+    Double(Vec<SpiceDouble>),
+    Int(Vec<SpiceInt>),
+}
+
+#[derive(Clone, Debug)]
+struct Column {
+    values: Values,
+    nulls: Bitmap,
+}
+
+#[derive(Clone, Debug)]
+struct Segment {
+    rows: usize,
+    columns: Vec<Column>,
+}
+
+/// Compare each of `values`, converted by `convert`, with `b`. The operator is matched outside
+/// of the loop over the values so that each comparison can be vectorized.
+fn compare_values<T, U, C>(values: &[T], convert: C, operator: ComparisonOperator, b: U) -> Bitmap
+where
+    T: Copy,
+    U: Copy + PartialOrd,
+    C: Fn(T) -> U,
+{
+    match operator {
+        ComparisonOperator::EQ => Bitmap::from_values(values, |a| convert(a) == b),
+        ComparisonOperator::NE => Bitmap::from_values(values, |a| convert(a) != b),
+        ComparisonOperator::LEQ => Bitmap::from_values(values, |a| convert(a) <= b),
+        ComparisonOperator::LT => Bitmap::from_values(values, |a| convert(a) < b),
+        ComparisonOperator::GEQ => Bitmap::from_values(values, |a| convert(a) >= b),
+        ComparisonOperator::GT => Bitmap::from_values(values, |a| convert(a) > b),
+    }
+}
+
+/// Selected columns of a table in an EK, held in memory.
+#[derive(Clone, Debug)]
+pub struct ColumnarTable {
+    columns: Vec<String>,
+    segments: Vec<Segment>,
+}
+
+impl ColumnarTable {
+    /// Read `columns` of each segment of `table` in the EK `file`.
+    ///
+    /// Table and column names are not case sensitive. Only scalar columns can be read.
+    pub fn load<'f, F: Into<StringParam<'f>>>(
+        file: F,
+        table: &str,
+        columns: &[&str],
+    ) -> Result<Self, Error> {
+        let columns: Vec<String> = columns.iter().map(|c| c.to_uppercase()).collect();
+        let table = table.to_uppercase();
+        with_spice_lock_or_panic(|| {
+            let mut handle = 0;
+            unsafe { ekopr_c(file.into().as_mut_ptr(), &mut handle) };
+            get_last_error()?;
+            let result = Self::read(handle, &table, &columns);
+            unsafe { ekcls_c(handle) };
+            let segments = result?;
+            get_last_error()?;
+            Ok(Self { columns, segments })
+        })
+    }
+
+    fn read(handle: SpiceInt, table: &str, columns: &[String]) -> Result<Vec<Segment>, Error> {
+        let mut segments = Vec::new();
+        let nseg = unsafe { eknseg_c(handle) };
+        get_last_error()?;
+        for segno in 0..nseg {
+            let summary = unsafe {
+                let mut summary = MaybeUninit::<SpiceEKSegSum>::zeroed();
+                ekssum_c(handle, segno, summary.as_mut_ptr());
+                summary.assume_init()
+            };
+            get_last_error()?;
+            if SpiceStr::from_buffer(&summary.tabnam).as_str() != table {
+                continue;
+            }
+            let rows = summary.nrows as usize;
+            let mut segment = Segment {
+                rows,
+                columns: Vec::with_capacity(columns.len()),
+            };
+            for column in columns {
+                let index = (0..summary.ncols as usize)
+                    .find(|&i| SpiceStr::from_buffer(&summary.cnames[i]).as_str() == *column)
+                    .ok_or_else(|| {
+                        Error::new(
+                            "SPICE(NOCOLUMN)",
+                            format!("Column {column} was not found in table {table}."),
+                        )
+                    })?;
+                let descriptor = summary.cdescrs[index];
+                if descriptor.size != 1 {
+                    return Err(Error::new(
+                        "SPICE(NOTSUPPORTED)",
+                        format!("Column {column} of table {table} is not scalar."),
+                    ));
+                }
+                segment.columns.push(Self::read_column(
+                    handle,
+                    segno,
+                    rows,
+                    descriptor.dtype,
+                    column,
+                )?);
+            }
+            segments.push(segment);
+        }
+        Ok(segments)
+    }
+
+    fn read_column(
+        handle: SpiceInt,
+        segno: SpiceInt,
+        rows: usize,
+        dtype: cspice_sys::SpiceEKDataType,
+        column: &str,
+    ) -> Result<Column, Error> {
+        let name = SpiceString::from(column);
+        let mut nulls = Bitmap::new(rows);
+        let mut nvals = 0;
+        let mut isnull: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+        let values = if dtype == _SpiceDataType_SPICE_CHR {
+            let mut values = Vec::with_capacity(rows);
+            let mut buffer = [0 as SpiceChar; CVALLN];
+            for row in 0..rows {
+                unsafe {
+                    ekrcec_c(
+                        handle,
+                        segno,
+                        row as SpiceInt,
+                        name.as_mut_ptr(),
+                        CVALLN as SpiceInt,
+                        &mut nvals,
+                        buffer.as_mut_ptr() as *mut c_void,
+                        &mut isnull,
+                    )
+                };
+                values.push(
+                    SpiceStr::from_buffer(&buffer)
+                        .as_str()
+                        .trim_end_matches(' ')
+                        .to_string(),
+                );
+                if isnull != SPICEFALSE as SpiceBoolean {
+                    nulls.set(row);
+                }
+            }
+            Values::Char(values)
+        } else if dtype == _SpiceDataType_SPICE_INT {
+            let mut values = vec![0; rows];
+            for (row, value) in values.iter_mut().enumerate() {
+                unsafe {
+                    ekrcei_c(
+                        handle,
+                        segno,
+                        row as SpiceInt,
+                        name.as_mut_ptr(),
+                        &mut nvals,
+                        value,
+                        &mut isnull,
+                    )
+                };
+                if isnull != SPICEFALSE as SpiceBoolean {
+                    nulls.set(row);
+                }
+            }
+            Values::Int(values)
+        } else {
+            let mut values = vec![0.0; rows];
+            for (row, value) in values.iter_mut().enumerate() {
+                unsafe {
+                    ekrced_c(
+                        handle,
+                        segno,
+                        row as SpiceInt,
+                        name.as_mut_ptr(),
+                        &mut nvals,
+                        value,
+                        &mut isnull,
+                    )
+                };
+                if isnull != SPICEFALSE as SpiceBoolean {
+                    nulls.set(row);
+                }
+            }
+            Values::Double(values)
+        };
+        get_last_error()?;
+        Ok(Column { values, nulls })
+    }
+
+    /// The number of segments of the table.
+    pub fn segments(&self) -> usize {
+        self.segments.len()
+    }
+
+    /// The number of rows in a segment.
+    pub fn rows(&self, segment: usize) -> usize {
+        self.segments[segment].rows
+    }
+
+    /// The values of a column in a segment. Null entries have unspecified values.
+    pub fn values(&self, segment: usize, column: &str) -> Result<&Values, Error> {
+        Ok(&self.segments[segment].columns[self.column_index(column)?].values)
+    }
+
+    /// The null entries of a column in a segment.
+    pub fn nulls(&self, segment: usize, column: &str) -> Result<&Bitmap, Error> {
+        Ok(&self.segments[segment].columns[self.column_index(column)?].nulls)
+    }
+
+    fn column_index(&self, column: &str) -> Result<usize, Error> {
+        let column = column.to_uppercase();
+        self.columns
+            .iter()
+            .position(|c| *c == column)
+            .ok_or_else(|| {
+                Error::new(
+                    "SPICE(NOCOLUMN)",
+                    format!("Column {column} has not been loaded."),
+                )
+            })
+    }
+
+    /// Evaluate `predicate`, returning the matching rows of each segment.
+    pub fn select(&self, predicate: &Predicate) -> Result<Vec<Bitmap>, Error> {
+        (0..self.segments.len())
+            .map(|segment| Ok(self.evaluate(segment, predicate)?.0))
+            .collect()
+    }
+
+    /// The total number of rows matching `predicate`.
+    pub fn count(&self, predicate: &Predicate) -> Result<usize, Error> {
+        Ok(self.select(predicate)?.iter().map(Bitmap::count).sum())
+    }
+
+    /// Evaluate `predicate` with three-valued logic, returning the rows for which it holds and the
+    /// rows for which it fails. The rows in neither are those for which it is unknown, because a
+    /// column entry compared is null.
+    fn evaluate(&self, segment: usize, predicate: &Predicate) -> Result<(Bitmap, Bitmap), Error> {
+        match predicate {
+            Predicate::Compare {
+                column,
+                operator,
+                value,
+            } => {
+                let column = &self.segments[segment].columns[self.column_index(column)?];
+                let mut bitmap = match (&column.values, value) {
+                    (Values::Double(values), Value::Double(b)) => {
+                        compare_values(values, |a| a, *operator, *b)
+                    }
+                    (Values::Double(values), Value::Int(b)) => {
+                        compare_values(values, |a| a, *operator, *b as SpiceDouble)
+                    }
+                    (Values::Int(values), Value::Int(b)) => {
+                        compare_values(values, |a| a, *operator, *b)
+                    }
+                    (Values::Int(values), Value::Double(b)) => {
+                        compare_values(values, |a| a as SpiceDouble, *operator, *b)
+                    }
+                    (Values::Char(values), Value::Char(b)) => {
+                        let b = b.trim_end_matches(' ');
+                        let values: Vec<&str> = values.iter().map(String::as_str).collect();
+                        compare_values(&values, |a| a, *operator, b)
+                    }
+                    _ => {
+                        return Err(Error::new(
+                            "SPICE(INVALIDTYPE)",
+                            format!("The type of {value:?} does not match the column type."),
+                        ))
+                    }
+                };
+                let mut failing = bitmap.clone();
+                failing.not();
+                bitmap.and_not(&column.nulls);
+                failing.and_not(&column.nulls);
+                Ok((bitmap, failing))
+            }
+            Predicate::IsNull(column) => {
+                let nulls = &self.segments[segment].columns[self.column_index(column)?].nulls;
+                let mut failing = nulls.clone();
+                failing.not();
+                Ok((nulls.clone(), failing))
+            }
+            Predicate::And(a, b) => {
+                let (mut holding, mut failing) = self.evaluate(segment, a)?;
+                let (holding_b, failing_b) = self.evaluate(segment, b)?;
+                holding.and(&holding_b);
+                failing.or(&failing_b);
+                Ok((holding, failing))
+            }
+            Predicate::Or(a, b) => {
+                let (mut holding, mut failing) = self.evaluate(segment, a)?;
+                let (holding_b, failing_b) = self.evaluate(segment, b)?;
+                holding.or(&holding_b);
+                failing.and(&failing_b);
+                Ok((holding, failing))
+            }
+            Predicate::Not(a) => {
+                let (holding, failing) = self.evaluate(segment, a)?;
+                Ok((failing, holding))
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::ek::tests::{load_test_ek, test_ek_path, ROWS};
+    use crate::ek::{find, get_double};
+
+    #[test]
+    fn test_bitmap() {
+        let mut bitmap = Bitmap::from_values(&(0..130).collect::<Vec<_>>(), |i| i % 3 == 0);
+        assert_eq!(bitmap.count(), 44);
+        assert!(bitmap.get(129));
+        assert!(!bitmap.get(130));
+        bitmap.not();
+        assert_eq!(bitmap.count(), 86);
+        assert_eq!(bitmap.iter().take(3).collect::<Vec<_>>(), vec![1, 2, 4]);
+    }
+
+    #[test]
+    fn test_null_logic() {
+        // VALUE is 0, null, 2, null, 4 in rows 0 to 4
+        let mut nulls = Bitmap::new(5);
+        nulls.set(1);
+        nulls.set(3);
+        let table = ColumnarTable {
+            columns: vec!["VALUE".to_string()],
+            segments: vec![Segment {
+                rows: 5,
+                columns: vec![Column {
+                    values: Values::Int(vec![0, 0, 2, 0, 4]),
+                    nulls,
+                }],
+            }],
+        };
+        let rows = |predicate: Predicate| -> Vec<usize> {
+            table.select(&predicate).unwrap()[0].iter().collect()
+        };
+        let gt = || Predicate::compare("VALUE", ComparisonOperator::GT, Value::Int(1));
+        let is_null = || Predicate::IsNull("VALUE".to_string());
+
+        assert_eq!(rows(gt()), vec![2, 4]);
+        assert_eq!(rows(Predicate::Not(Box::new(gt()))), vec![0]);
+        assert_eq!(rows(Predicate::Not(Box::new(is_null()))), vec![0, 2, 4]);
+        assert_eq!(rows(Predicate::Not(Box::new(gt().or(is_null())))), vec![0]);
+        assert_eq!(
+            rows(Predicate::Not(Box::new(Predicate::Not(Box::new(gt()))))),
+            vec![2, 4]
+        );
+        assert_eq!(
+            rows(Predicate::Not(Box::new(gt().and(is_null())))),
+            vec![0, 2, 4]
+        );
+    }
+
+    #[test]
+    fn test_columnar_select() {
+        load_test_ek();
+        let table = ColumnarTable::load(
+            test_ek_path().to_string_lossy(),
+            "events",
+            &["time", "instrument_id", "event_type"],
+        )
+        .unwrap();
+        assert_eq!(table.segments(), 1);
+        assert_eq!(table.rows(0), ROWS);
+
+        let predicate = Predicate::compare("INSTRUMENT_ID", ComparisonOperator::EQ, Value::Int(1))
+            .and(Predicate::compare(
+                "EVENT_TYPE",
+                ComparisonOperator::EQ,
+                Value::Char("A".to_string()),
+            ))
+            .and(Predicate::compare(
+                "TIME",
+                ComparisonOperator::LT,
+                Value::Double(6000.0),
+            ));
+        let selected = table.select(&predicate).unwrap();
+
+        let expected: Vec<usize> = (0..ROWS)
+            .filter(|i| i % 3 == 1 && i % 2 == 0 && 60 * i < 6000)
+            .collect();
+        assert_eq!(selected[0].iter().collect::<Vec<_>>(), expected);
+
+        let rows = find(
+            "SELECT TIME FROM EVENTS WHERE INSTRUMENT_ID = 1 AND EVENT_TYPE = 'A' ORDER BY TIME",
+        )
+        .unwrap();
+        let predicate = Predicate::compare("INSTRUMENT_ID", ComparisonOperator::EQ, Value::Int(1))
+            .and(Predicate::compare(
+                "EVENT_TYPE",
+                ComparisonOperator::EQ,
+                Value::Char("A".to_string()),
+            ));
+        assert_eq!(table.count(&predicate).unwrap(), rows);
+        let times = table.values(0, "TIME").unwrap();
+        let Values::Double(times) = times else {
+            panic!("TIME should be read as double precision values");
+        };
+        for (row, index) in table.select(&predicate).unwrap()[0].iter().enumerate() {
+            assert_eq!(get_double(0, row, 0).unwrap(), Some(times[index]));
+        }
+
+        let error = table
+            .select(&Predicate::compare(
+                "EVENT_TYPE",
+                ComparisonOperator::EQ,
+                Value::Int(1),
+            ))
+            .err()
+            .unwrap();
+        assert_eq!(error.short_message, "SPICE(INVALIDTYPE)");
+        let error = ColumnarTable::load(test_ek_path().to_string_lossy(), "EVENTS", &["NOTHING"])
+            .err()
+            .unwrap();
+        assert_eq!(error.short_message, "SPICE(NOCOLUMN)");
+    }
+}
@@ -0,0 +1,607 @@
+//! Functions relating to the E-kernel (EK) subsystem of SPICE.
+pub mod columnar;
+
+use crate::error::get_last_error;
+use crate::string::{SpiceStr, StringParam};
+use crate::time::Et;
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{
+    ekfind_c, ekgc_c, ekgd_c, ekgi_c, ekpbdc_c, ekpbdd_c, ekpcls_c, ekpfnd_c, ekpqry_c,
+    SpiceBoolean, SpiceChar, SpiceDouble, SpiceInt, SPICEFALSE,
+};
+
+/// Length of the buffer for query error messages.
+const ERRMLN: usize = 1024;
+
+/// Length of the buffer for character column values.
+const CVALLN: usize = 1025;
+
+/// Convert the error message of a query that failed to parse or execute into an [Error].
+///
+/// A query error is not signalled through the SPICE error subsystem, so there is no short message
+/// or traceback: the message returned by `ekfind_c` is kept as the long message.
+fn query_error(errmsg: &[SpiceChar]) -> Error {
+    Error::new("", SpiceStr::from_buffer(errmsg).as_str())
+}
+
+/// Find E-kernel data that satisfy a query, returning the number of matching rows. The data can
+/// then be fetched using [get_char()], [get_double()] and [get_int()].
+///
+/// See [ekfind_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/ekfind_c.html).
+pub fn find<'q, Q: Into<StringParam<'q>>>(query: Q) -> Result<usize, Error> {
+    with_spice_lock_or_panic(|| {
+        let mut rows = 0;
+        let mut error: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+        let mut errmsg = [0; ERRMLN];
+        unsafe {
+            ekfind_c(
+                query.into().as_mut_ptr(),
+                errmsg.len() as SpiceInt,
+                &mut rows,
+                &mut error,
+                errmsg.as_mut_ptr(),
+            )
+        };
+        get_last_error()?;
+        if error != SPICEFALSE as SpiceBoolean {
+            return Err(query_error(&errmsg));
+        }
+        Ok(rows as usize)
+    })
+}
+
+/// Return an element of a character column entry in a row found by the last query. Returns
+/// `None` if the entry is null.
+///
+/// See [ekgc_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/ekgc_c.html).
+pub fn get_char(select_index: usize, row: usize, element: usize) -> Result<Option<String>, Error> {
+    with_spice_lock_or_panic(|| {
+        let mut value = [0; CVALLN];
+        let mut null: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+        let mut found: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+        unsafe {
+            ekgc_c(
+                select_index as SpiceInt,
+                row as SpiceInt,
+                element as SpiceInt,
+                value.len() as SpiceInt,
+                value.as_mut_ptr(),
+                &mut null,
+                &mut found,
+            )
+        };
+        get_last_error()?;
+        if null != SPICEFALSE as SpiceBoolean || found == SPICEFALSE as SpiceBoolean {
+            return Ok(None);
+        }
+        Ok(Some(SpiceStr::from_buffer(&value).as_str().into_owned()))
+    })
+}
+
+/// Return an element of a double precision or time column entry in a row found by the last
+/// query. Returns `None` if the entry is null.
+///
+/// See [ekgd_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/ekgd_c.html).
+pub fn get_double(
+    select_index: usize,
+    row: usize,
+    element: usize,
+) -> Result<Option<SpiceDouble>, Error> {
+    with_spice_lock_or_panic(|| {
+        let mut value = 0.0;
+        let mut null: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+        let mut found: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+        unsafe {
+            ekgd_c(
+                select_index as SpiceInt,
+                row as SpiceInt,
+                element as SpiceInt,
+                &mut value,
+                &mut null,
+                &mut found,
+            )
+        };
+        get_last_error()?;
+        if null != SPICEFALSE as SpiceBoolean || found == SPICEFALSE as SpiceBoolean {
+            return Ok(None);
+        }
+        Ok(Some(value))
+    })
+}
+
+/// Return an element of an integer column entry in a row found by the last query. Returns `None`
+/// if the entry is null.
+///
+/// See [ekgi_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/ekgi_c.html).
+pub fn get_int(select_index: usize, row: usize, element: usize) -> Result<Option<SpiceInt>, Error> {
+    with_spice_lock_or_panic(|| {
+        let mut value = 0;
+        let mut null: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+        let mut found: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+        unsafe {
+            ekgi_c(
+                select_index as SpiceInt,
+                row as SpiceInt,
+                element as SpiceInt,
+                &mut value,
+                &mut null,
+                &mut found,
+            )
+        };
+        get_last_error()?;
+        if null != SPICEFALSE as SpiceBoolean || found == SPICEFALSE as SpiceBoolean {
+            return Ok(None);
+        }
+        Ok(Some(value))
+    })
+}
+
+/// An EK query that has been parsed and checked once, and can be executed many times with
+/// different values bound to its `?` placeholders.
+///
+/// The query refers to the tables of the EKs loaded when it was prepared. After EKs are loaded or
+/// unloaded, [execute()](Self::execute) fails with `SPICE(STALEQUERY)` and the query must be
+/// prepared again.
+#[derive(Debug)]
+pub struct PreparedQuery {
+    handle: SpiceInt,
+    parameters: usize,
+}
+
+impl PreparedQuery {
+    /// Prepare a query in which constraint values may be replaced by `?` placeholders, for
+    /// example `SELECT EVENT_TYPE FROM EVENTS WHERE TIME BETWEEN ? AND ?`.
+    pub fn prepare<'q, Q: Into<StringParam<'q>>>(query: Q) -> Result<Self, Error> {
+        with_spice_lock_or_panic(|| {
+            let mut handle = 0;
+            let mut parameters = 0;
+            let mut error: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+            let mut errmsg = [0; ERRMLN];
+            unsafe {
+                ekpqry_c(
+                    query.into().as_mut_ptr(),
+                    errmsg.len() as SpiceInt,
+                    &mut handle,
+                    &mut parameters,
+                    &mut error,
+                    errmsg.as_mut_ptr(),
+                )
+            };
+            get_last_error()?;
+            if error != SPICEFALSE as SpiceBoolean {
+                return Err(query_error(&errmsg));
+            }
+            Ok(Self {
+                handle,
+                parameters: parameters as usize,
+            })
+        })
+    }
+
+    /// The number of placeholders in the query.
+    pub fn parameters(&self) -> usize {
+        self.parameters
+    }
+
+    /// Bind a value to a placeholder compared with an integer or double precision column.
+    pub fn bind_double(&mut self, parameter: usize, value: SpiceDouble) -> Result<(), Error> {
+        with_spice_lock_or_panic(|| {
+            unsafe { ekpbdd_c(self.handle, parameter as SpiceInt, value) };
+            get_last_error()
+        })
+    }
+
+    /// Bind a value to a placeholder compared with a time column.
+    pub fn bind_time(&mut self, parameter: usize, value: Et) -> Result<(), Error> {
+        self.bind_double(parameter, value.0)
+    }
+
+    /// Bind a value to a placeholder compared with a character column.
+    pub fn bind_char<'v, V: Into<StringParam<'v>>>(
+        &mut self,
+        parameter: usize,
+        value: V,
+    ) -> Result<(), Error> {
+        with_spice_lock_or_panic(|| {
+            unsafe {
+                ekpbdc_c(
+                    self.handle,
+                    parameter as SpiceInt,
+                    value.into().as_mut_ptr(),
+                )
+            };
+            get_last_error()
+        })
+    }
+
+    /// Find the data satisfying the query with the values currently bound to its placeholders,
+    /// returning the number of matching rows. The data can then be fetched using [get_char()],
+    /// [get_double()] and [get_int()].
+    pub fn execute(&mut self) -> Result<usize, Error> {
+        with_spice_lock_or_panic(|| {
+            let mut rows = 0;
+            let mut error: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+            let mut errmsg = [0; ERRMLN];
+            unsafe {
+                ekpfnd_c(
+                    self.handle,
+                    errmsg.len() as SpiceInt,
+                    &mut rows,
+                    &mut error,
+                    errmsg.as_mut_ptr(),
+                )
+            };
+            get_last_error()?;
+            if error != SPICEFALSE as SpiceBoolean {
+                return Err(query_error(&errmsg));
+            }
+            Ok(rows as usize)
+        })
+    }
+}
+
+impl Drop for PreparedQuery {
+    fn drop(&mut self) {
+        with_spice_lock_or_panic(|| {
+            unsafe { ekpcls_c(self.handle) };
+            // Nothing useful can be done with an error while dropping
+            let _ = get_last_error();
+        })
+    }
+}
+
+#[cfg(test)]
+pub(crate) mod tests {
+    use super::*;
+    use crate::data::{furnish, unload};
+    use crate::string::SpiceString;
+    use cspice_sys::{
+        ekacec_c, ekaced_c, ekacei_c, ekappr_c, ekbseg_c, ekcls_c, ekntab_c, ekopn_c,
+    };
+    use std::ffi::c_void;
+    use std::sync::Once;
+
+    pub(crate) const ROWS: usize = 300;
+    const NAMLEN: usize = 33;
+    const DECLEN: usize = 201;
+
+    /// Pack strings into the fixed length string array expected by the EK writer functions.
+    fn string_array(strings: &[&str], length: usize) -> Vec<SpiceChar> {
+        let mut array = vec![0; strings.len() * length];
+        for (i, s) in strings.iter().enumerate() {
+            for (j, &c) in s.as_bytes().iter().enumerate() {
+                array[i * length + j] = c as SpiceChar;
+            }
+        }
+        array
+    }
+
+    /// The path of the EK written by [load_test_ek()].
+    pub(crate) fn test_ek_path() -> std::path::PathBuf {
+        std::env::temp_dir().join(format!("cspice-test-{}.bes", std::process::id()))
+    }
+
+    /// Write and load (once) an EK containing an EVENTS table, with TIME `60 * i`, INSTRUMENT_ID
+    /// `i % 3` and EVENT_TYPE `A` or `B` in row `i`, and an INSTRUMENTS table with a NAME for each
+    /// INSTRUMENT_ID.
+    pub(crate) fn load_test_ek() {
+        static EK_INIT: Once = Once::new();
+        EK_INIT.call_once(|| {
+            let path = test_ek_path();
+            let _ = std::fs::remove_file(&path);
+            let file = SpiceString::from(path.to_string_lossy());
+            unsafe {
+                let mut handle = 0;
+                ekopn_c(file.as_mut_ptr(), file.as_mut_ptr(), 0, &mut handle);
+
+                let names = string_array(&["TIME", "INSTRUMENT_ID", "EVENT_TYPE"], NAMLEN);
+                let decls = string_array(
+                    &[
+                        "DATATYPE = TIME, INDEXED = TRUE",
+                        "DATATYPE = INTEGER, INDEXED = TRUE",
+                        "DATATYPE = CHARACTER*(32)",
+                    ],
+                    DECLEN,
+                );
+                let mut segno = 0;
+                ekbseg_c(
+                    handle,
+                    SpiceString::from("EVENTS").as_mut_ptr(),
+                    3,
+                    NAMLEN as SpiceInt,
+                    names.as_ptr() as *const c_void,
+                    DECLEN as SpiceInt,
+                    decls.as_ptr() as *const c_void,
+                    &mut segno,
+                );
+                for i in 0..ROWS {
+                    let mut recno = 0;
+                    ekappr_c(handle, segno, &mut recno);
+                    let time = 60.0 * i as SpiceDouble;
+                    let instrument = (i % 3) as SpiceInt;
+                    let event_type = string_array(&[if i % 2 == 0 { "A" } else { "B" }], NAMLEN);
+                    let column = |name: &str| SpiceString::from(name);
+                    ekaced_c(
+                        handle,
+                        segno,
+                        recno,
+                        column("TIME").as_mut_ptr(),
+                        1,
+                        &time,
+                        SPICEFALSE as SpiceBoolean,
+                    );
+                    ekacei_c(
+                        handle,
+                        segno,
+                        recno,
+                        column("INSTRUMENT_ID").as_mut_ptr(),
+                        1,
+                        &instrument,
+                        SPICEFALSE as SpiceBoolean,
+                    );
+                    ekacec_c(
+                        handle,
+                        segno,
+                        recno,
+                        column("EVENT_TYPE").as_mut_ptr(),
+                        1,
+                        NAMLEN as SpiceInt,
+                        event_type.as_ptr() as *const c_void,
+                        SPICEFALSE as SpiceBoolean,
+                    );
+                }
+
+                let names = string_array(&["INSTRUMENT_ID", "NAME"], NAMLEN);
+                let decls = string_array(
+                    &[
+                        "DATATYPE = INTEGER, INDEXED = TRUE",
+                        "DATATYPE = CHARACTER*(32)",
+                    ],
+                    DECLEN,
+                );
+                ekbseg_c(
+                    handle,
+                    SpiceString::from("INSTRUMENTS").as_mut_ptr(),
+                    2,
+                    NAMLEN as SpiceInt,
+                    names.as_ptr() as *const c_void,
+                    DECLEN as SpiceInt,
+                    decls.as_ptr() as *const c_void,
+                    &mut segno,
+                );
+                for (id, name) in ["CAMERA", "SPECTROMETER", "ALTIMETER"].iter().enumerate() {
+                    let mut recno = 0;
+                    ekappr_c(handle, segno, &mut recno);
+                    let id = id as SpiceInt;
+                    let name = string_array(&[name], NAMLEN);
+                    ekacei_c(
+                        handle,
+                        segno,
+                        recno,
+                        SpiceString::from("INSTRUMENT_ID").as_mut_ptr(),
+                        1,
+                        &id,
+                        SPICEFALSE as SpiceBoolean,
+                    );
+                    ekacec_c(
+                        handle,
+                        segno,
+                        recno,
+                        SpiceString::from("NAME").as_mut_ptr(),
+                        1,
+                        NAMLEN as SpiceInt,
+                        name.as_ptr() as *const c_void,
+                        SPICEFALSE as SpiceBoolean,
+                    );
+                }
+                ekcls_c(handle);
+            }
+            get_last_error().unwrap();
+            furnish(path.to_string_lossy()).unwrap();
+        });
+    }
+
+    #[test]
+    fn test_find() {
+        load_test_ek();
+        let rows = find("SELECT TIME, INSTRUMENT_ID, EVENT_TYPE FROM EVENTS WHERE INSTRUMENT_ID = 1 ORDER BY TIME").unwrap();
+        assert_eq!(rows, ROWS / 3);
+        assert_eq!(get_double(0, 0, 0).unwrap(), Some(60.0));
+        assert_eq!(get_int(1, 0, 0).unwrap(), Some(1));
+        assert_eq!(get_char(2, 0, 0).unwrap().as_deref(), Some("B"));
+
+        let error = find("SELECT NOTHING FROM NOWHERE").err().unwrap();
+        assert!(error.short_message.is_empty());
+        assert!(!error.long_message.is_empty());
+    }
+
+    #[test]
+    fn test_join() {
+        load_test_ek();
+        let names = ["CAMERA", "SPECTROMETER", "ALTIMETER"];
+        let rows = find(
+            "SELECT EVENTS.TIME, INSTRUMENTS.NAME FROM EVENTS, INSTRUMENTS \
+             WHERE EVENTS.INSTRUMENT_ID = INSTRUMENTS.INSTRUMENT_ID ORDER BY EVENTS.TIME",
+        )
+        .unwrap();
+        assert_eq!(rows, ROWS);
+        for row in 0..ROWS {
+            assert_eq!(get_double(0, row, 0).unwrap(), Some(60.0 * row as f64));
+            assert_eq!(
+                get_char(1, row, 0).unwrap().as_deref(),
+                Some(names[row % 3])
+            );
+        }
+
+        let rows = find(
+            "SELECT EVENTS.TIME FROM EVENTS, INSTRUMENTS \
+             WHERE EVENTS.INSTRUMENT_ID < INSTRUMENTS.INSTRUMENT_ID",
+        )
+        .unwrap();
+        assert_eq!(rows, ROWS);
+
+        // A self-join on a time column, hashing one full copy of the table.
+        let rows = find(
+            "SELECT E1.TIME, E2.EVENT_TYPE FROM EVENTS E1, EVENTS E2 \
+             WHERE E1.TIME = E2.TIME AND E2.INSTRUMENT_ID = 2 ORDER BY E1.TIME",
+        )
+        .unwrap();
+        assert_eq!(rows, ROWS / 3);
+        for row in 0..ROWS / 3 {
+            let i = 3 * row + 2;
+            assert_eq!(get_double(0, row, 0).unwrap(), Some(60.0 * i as f64));
+            assert_eq!(
+                get_char(1, row, 0).unwrap().as_deref(),
+                Some(if i % 2 == 0 { "A" } else { "B" })
+            );
+        }
+    }
+
+    #[test]
+    fn test_prepared_query() {
+        load_test_ek();
+        let mut query = PreparedQuery::prepare(
+            "SELECT TIME FROM EVENTS WHERE TIME BETWEEN ? AND ? \
+             AND INSTRUMENT_ID = ? AND EVENT_TYPE = ? ORDER BY TIME",
+        )
+        .unwrap();
+        assert_eq!(query.parameters(), 4);
+
+        for start in [0usize, 50, 100] {
+            query.bind_time(0, Et(60.0 * start as f64)).unwrap();
+            query.bind_time(1, Et(60.0 * (start + 59) as f64)).unwrap();
+            query.bind_double(2, 2.0).unwrap();
+            query.bind_char(3, "A").unwrap();
+            let expected: Vec<f64> = (start..start + 60)
+                .filter(|i| i % 3 == 2 && i % 2 == 0)
+                .map(|i| 60.0 * i as f64)
+                .collect();
+            let rows = query.execute().unwrap();
+            assert_eq!(rows, expected.len());
+            for (row, time) in expected.iter().enumerate() {
+                assert_eq!(get_double(0, row, 0).unwrap(), Some(*time));
+            }
+        }
+
+        let error = query.bind_char(0, "A").err().unwrap();
+        assert_eq!(error.short_message, "SPICE(INVALIDTYPE)");
+        let error = PreparedQuery::prepare("SELECT ? FROM EVENTS")
+            .err()
+            .unwrap();
+        assert!(error.short_message.is_empty());
+        assert!(!error.long_message.is_empty());
+    }
+
+    #[test]
+    fn test_prepared_query_stale() {
+        load_test_ek();
+        let mut query =
+            PreparedQuery::prepare("SELECT TIME FROM EVENTS WHERE INSTRUMENT_ID = ?").unwrap();
+        query.bind_double(0, 1.0).unwrap();
+        assert_eq!(query.execute().unwrap(), ROWS / 3);
+
+        let path =
+            std::env::temp_dir().join(format!("cspice-test-{}-stale.bes", std::process::id()));
+        let _ = std::fs::remove_file(&path);
+        let file = SpiceString::from(path.to_string_lossy());
+        let names = string_array(&["VALUE"], NAMLEN);
+        let decls = string_array(&["DATATYPE = INTEGER"], DECLEN);
+        unsafe {
+            let mut handle = 0;
+            let mut segno = 0;
+            ekopn_c(file.as_mut_ptr(), file.as_mut_ptr(), 0, &mut handle);
+            ekbseg_c(
+                handle,
+                SpiceString::from("STALE").as_mut_ptr(),
+                1,
+                NAMLEN as SpiceInt,
+                names.as_ptr() as *const c_void,
+                DECLEN as SpiceInt,
+                decls.as_ptr() as *const c_void,
+                &mut segno,
+            );
+            ekcls_c(handle);
+        }
+        get_last_error().unwrap();
+        furnish(path.to_string_lossy()).unwrap();
+
+        let error = query.execute().err().unwrap();
+        assert_eq!(error.short_message, "SPICE(STALEQUERY)");
+        let mut query =
+            PreparedQuery::prepare("SELECT TIME FROM EVENTS WHERE INSTRUMENT_ID = ?").unwrap();
+        query.bind_double(0, 1.0).unwrap();
+        assert_eq!(query.execute().unwrap(), ROWS / 3);
+
+        unload(path.to_string_lossy()).unwrap();
+        let _ = std::fs::remove_file(&path);
+        let error = query.execute().err().unwrap();
+        assert_eq!(error.short_message, "SPICE(STALEQUERY)");
+    }
+
+    #[test]
+    fn test_many_files() {
+        load_test_ek();
+        const FILES: usize = 24;
+        const TABLES: usize = 5;
+        let names = string_array(&["VALUE"], NAMLEN);
+        let decls = string_array(&["DATATYPE = INTEGER"], DECLEN);
+        let paths: Vec<_> = (0..FILES)
+            .map(|f| {
+                let path = std::env::temp_dir().join(format!(
+                    "cspice-test-{}-{}.bes",
+                    std::process::id(),
+                    f
+                ));
+                let _ = std::fs::remove_file(&path);
+                let file = SpiceString::from(path.to_string_lossy());
+                unsafe {
+                    let mut handle = 0;
+                    ekopn_c(file.as_mut_ptr(), file.as_mut_ptr(), 0, &mut handle);
+                    for t in 0..TABLES {
+                        let mut segno = 0;
+                        ekbseg_c(
+                            handle,
+                            SpiceString::from(format!("T{}_{}", f, t)).as_mut_ptr(),
+                            1,
+                            NAMLEN as SpiceInt,
+                            names.as_ptr() as *const c_void,
+                            DECLEN as SpiceInt,
+                            decls.as_ptr() as *const c_void,
+                            &mut segno,
+                        );
+                        let mut recno = 0;
+                        ekappr_c(handle, segno, &mut recno);
+                        let value = (f * TABLES + t) as SpiceInt;
+                        ekacei_c(
+                            handle,
+                            segno,
+                            recno,
+                            SpiceString::from("VALUE").as_mut_ptr(),
+                            1,
+                            &value,
+                            SPICEFALSE as SpiceBoolean,
+                        );
+                    }
+                    ekcls_c(handle);
+                }
+                get_last_error().unwrap();
+                furnish(path.to_string_lossy()).unwrap();
+                path
+            })
+            .collect();
+
+        let mut tables = 0;
+        unsafe { ekntab_c(&mut tables) };
+        assert_eq!(tables as usize, FILES * TABLES + 2);
+        assert_eq!(find("SELECT VALUE FROM T23_4").unwrap(), 1);
+        assert_eq!(get_int(0, 0, 0).unwrap(), Some(119));
+
+        for path in paths {
+            unload(path.to_string_lossy()).unwrap();
+            let _ = std::fs::remove_file(&path);
+        }
+        unsafe { ekntab_c(&mut tables) };
+        assert_eq!(tables, 2);
+        assert_eq!(find("SELECT TIME FROM EVENTS").unwrap(), ROWS);
+    }
+}
@@ -1,10 +1,10 @@
 //! Functions relating to error handling.
 use crate::common::{GET, SET};
-use crate::string::{SpiceStr, SpiceString};
+use crate::string::{SpiceStr, SpiceString, StaticSpiceStr};
 use crate::with_spice_lock_or_panic;
 use cspice_sys::{
-    erract_c, errdev_c, failed_c, getmsg_c, qcktrc_c, reset_c, SpiceInt, SPICE_ERROR_LMSGLN,
-    SPICE_ERROR_SMSGLN, SPICE_ERROR_TRCLEN, SPICE_ERROR_XMSGLN,
+    erract_c, errdev_c, failed_c, getmsg_c, qcktrc_c, reset_c, setmsg_c, sigerr_c, trcmod_c,
+    SpiceInt, SPICE_ERROR_LMSGLN, SPICE_ERROR_SMSGLN, SPICE_ERROR_TRCLEN, SPICE_ERROR_XMSGLN,
 };
 use serde::{Deserialize, Serialize};
 use thiserror::Error;
@@ -21,6 +21,19 @@ pub struct Error {
     pub traceback: String,
 }
 
+impl Error {
+    /// An error detected by this crate rather than signalled by SPICE, with a short message in
+    /// the style of SPICE's, such as `SPICE(INVALIDFORMAT)`, and a long message.
+    pub(crate) fn new<M: Into<String>>(short_message: &str, long_message: M) -> Self {
+        Self {
+            short_message: short_message.to_string(),
+            explanation: String::new(),
+            long_message: long_message.into(),
+            traceback: String::new(),
+        }
+    }
+}
+
 /// See [Choosing the Error Response Action](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/req/error.html#Choosing%20the%20Error%20Response%20Action).
 #[derive(Debug, Copy, Clone, Serialize, Deserialize, PartialEq, Eq)]
 #[serde(rename_all = "UPPERCASE")]
@@ -40,6 +53,19 @@ pub enum ErrorDevice {
     Filename(String),
 }
 
+/// How the traceback of an [Error] is recorded as SPICE functions are entered and left.
+#[derive(Debug, Copy, Clone, Serialize, Deserialize, PartialEq, Eq)]
+#[serde(rename_all = "UPPERCASE")]
+pub enum TraceMode {
+    /// Each function name is copied as the function is entered. This is the default.
+    Full,
+    /// Only a reference to each function name is kept, and the names are copied when a traceback
+    /// is needed. Tracebacks are the same as in `Full` mode.
+    Lazy,
+    /// No traceback is kept, and the traceback of each [Error] is empty.
+    Off,
+}
+
 /// Tests, retrieves, and resets the last error if it is present. Otherwise returns Ok.
 ///
 /// For context see [CSPICE Error Handling](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/req/error.html#Testing%20the%20Error%20Status).
@@ -89,6 +115,15 @@ pub fn get_last_error() -> Result<(), Error> {
     })
 }
 
+/// Signal an error from within a callback passed to SPICE, so that the calling SPICE function
+/// returns and the error is reported by [get_last_error()]. The caller must hold the SPICE lock.
+///
+/// See [sigerr_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/sigerr_c.html).
+pub(crate) unsafe fn signal_error(short_message: &StaticSpiceStr, long_message: &StaticSpiceStr) {
+    setmsg_c(long_message.as_mut_ptr());
+    sigerr_c(short_message.as_mut_ptr());
+}
+
 /// Set the action when an error occurs in a SPICE function.
 ///
 /// See [erract_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/erract_c.html).
@@ -119,6 +154,17 @@ pub fn get_error_action() -> Result<ErrorAction, Error> {
     Ok(serde_plain::from_str(&action.as_str()).unwrap())
 }
 
+/// Set how the traceback is recorded.
+///
+/// See [trcmod_c](https://github.com/jacob-pro/cspice-rs/blob/master/cspice-fork/src/cspice/trcmod_c.c).
+pub fn set_trace_mode(mode: TraceMode) -> Result<(), Error> {
+    let mode = SpiceString::from(serde_plain::to_string(&mode).unwrap());
+    with_spice_lock_or_panic(|| {
+        unsafe { trcmod_c(mode.as_mut_ptr()) };
+        get_last_error()
+    })
+}
+
 /// Set Error Output Device.
 ///
 /// See [errdev_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/errdev_c.html).
@@ -192,4 +238,19 @@ mod tests {
         // Reset so we don't interfere with other tests
         set_error_defaults();
     }
+
+    #[test]
+    fn test_set_trace_mode() {
+        let traceback = |mode| {
+            set_trace_mode(mode).unwrap();
+            crate::data::furnish("missing.bsp").err().unwrap().traceback
+        };
+        let full = traceback(TraceMode::Full);
+        assert!(full.starts_with("furnsh_c"));
+        assert_eq!(traceback(TraceMode::Lazy), full);
+        assert_eq!(traceback(TraceMode::Off), "");
+
+        // Reset so we don't interfere with other tests
+        set_trace_mode(TraceMode::Full).unwrap();
+    }
 }
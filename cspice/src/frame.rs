@@ -0,0 +1,104 @@
+//! Translating between reference frame names and IDs.
+//!
+//! Functions taking a frame name convert it to a C string on every call. A [Frame] holds a frame's
+//! ID together with its name already converted, and can be passed wherever a frame name is
+//! expected, so repeated calls with the same frame do no conversion or allocation.
+use crate::error::get_last_error;
+use crate::string::{SpiceStr, SpiceString, StringParam};
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{frmnam_c, namfrm_c, SpiceInt};
+use derive_more::{From, Into};
+
+/// Length of the buffer for frame names.
+const FRNMLN: usize = 33;
+
+/// The ID of a reference frame.
+#[derive(Copy, Clone, Debug, PartialEq, Eq, Hash, PartialOrd, Ord, From, Into)]
+pub struct FrameId(pub SpiceInt);
+
+impl FrameId {
+    /// Translate a frame name to an ID. Returns `None` if the name is not known.
+    ///
+    /// See [namfrm_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/namfrm_c.html).
+    pub fn from_name<'n, N: Into<StringParam<'n>>>(name: N) -> Result<Option<Self>, Error> {
+        with_spice_lock_or_panic(|| {
+            let mut code = 0;
+            unsafe { namfrm_c(name.into().as_mut_ptr(), &mut code) };
+            get_last_error()?;
+            Ok((code != 0).then_some(Self(code)))
+        })
+    }
+
+    /// The name of the frame, if one is known.
+    ///
+    /// See [frmnam_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/frmnam_c.html).
+    pub fn name(self) -> Result<Option<String>, Error> {
+        with_spice_lock_or_panic(|| {
+            let mut buffer = [0; FRNMLN];
+            unsafe { frmnam_c(self.0, buffer.len() as SpiceInt, buffer.as_mut_ptr()) };
+            get_last_error()?;
+            let name = SpiceStr::from_buffer(&buffer).to_string();
+            Ok((!name.is_empty()).then_some(name))
+        })
+    }
+}
+
+/// A reference frame, resolved once.
+#[derive(Debug)]
+pub struct Frame {
+    id: FrameId,
+    name: SpiceString,
+}
+
+impl Frame {
+    /// The frame with the given name. Returns `None` if the name is not known.
+    pub fn from_name<'n, N: Into<StringParam<'n>>>(name: N) -> Result<Option<Self>, Error> {
+        with_spice_lock_or_panic(|| match FrameId::from_name(name)? {
+            Some(id) => Self::from_id(id),
+            None => Ok(None),
+        })
+    }
+
+    /// The frame with the given ID. Returns `None` if the ID is not known.
+    pub fn from_id(id: FrameId) -> Result<Option<Self>, Error> {
+        Ok(id.name()?.map(|name| Self {
+            id,
+            name: SpiceString::from(name),
+        }))
+    }
+
+    /// The ID of the frame.
+    pub fn id(&self) -> FrameId {
+        self.id
+    }
+
+    /// The name of the frame, as known to SPICE.
+    pub fn name(&self) -> &SpiceString {
+        &self.name
+    }
+}
+
+impl<'a> From<&'a Frame> for StringParam<'a> {
+    fn from(frame: &'a Frame) -> Self {
+        StringParam::Ref(&frame.name)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::tests::load_test_data;
+
+    #[test]
+    fn test_frame() {
+        load_test_data();
+        assert_eq!(FrameId::from_name("j2000").unwrap(), Some(FrameId(1)));
+        assert_eq!(FrameId::from_name("NO SUCH FRAME").unwrap(), None);
+        assert_eq!(FrameId(17).name().unwrap(), Some("ECLIPJ2000".to_string()));
+        assert_eq!(FrameId(-123456).name().unwrap(), None);
+
+        let frame = Frame::from_name("eclipj2000").unwrap().unwrap();
+        assert_eq!(frame.id(), FrameId(17));
+        assert_eq!(frame.name().to_string(), "ECLIPJ2000");
+    }
+}
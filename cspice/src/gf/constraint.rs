@@ -0,0 +1,212 @@
+//! Searching for the times at which several Geometry Finder conditions hold at once.
+//!
+//! Rather than searching the whole confinement window for each condition and intersecting the
+//! results, the conditions are searched one after another, each confined to the times at which
+//! all of the previous conditions hold. Conditions are searched in order of their estimated cost,
+//! so expensive searches such as occultation searches only examine the time ranges that the
+//! cheaper conditions have not already excluded.
+use crate::cell::Window;
+use crate::common::AberrationCorrection;
+use crate::gf::partition::window_intervals;
+use crate::gf::quantity::Quantity;
+use crate::gf::step::Step;
+use crate::gf::{
+    event_search, occultation_search, OccultationType, RelationalOperator, Shape, TargetShape,
+};
+use crate::string::SpiceString;
+use crate::Error;
+use cspice_sys::SpiceDouble;
+
+/// A condition to be satisfied by a [combined_search()].
+#[derive(Clone, Debug)]
+pub enum Constraint {
+    /// A geometric quantity satisfies a numerical relationship.
+    ///
+    /// See [event_search()].
+    Event {
+        quantity: Quantity,
+        relational_operator: RelationalOperator,
+        refval: SpiceDouble,
+        adjust: SpiceDouble,
+        step: Step,
+    },
+    /// One target is occulted by, or in transit across, another.
+    ///
+    /// See [occultation_search()].
+    Occultation {
+        occultation_type: OccultationType,
+        front: SpiceString,
+        front_shape: TargetShape,
+        front_frame: SpiceString,
+        back: SpiceString,
+        back_shape: TargetShape,
+        back_frame: SpiceString,
+        aberration_correction: AberrationCorrection,
+        observer: SpiceString,
+        step_size: SpiceDouble,
+    },
+}
+
+impl Constraint {
+    /// The relative cost of evaluating the condition at a single time.
+    pub fn cost(&self) -> u32 {
+        match &self {
+            Constraint::Event { quantity, .. } => match quantity {
+                Quantity::Distance { .. } | Quantity::RangeRate { .. } => 1,
+                Quantity::AngularSeparation { shape1, shape2, .. } => match (shape1, shape2) {
+                    (Shape::Point, Shape::Point) => 2,
+                    _ => 3,
+                },
+            },
+            Constraint::Occultation { .. } => 10,
+        }
+    }
+
+    /// Search for the times within `confine` at which the condition holds.
+    pub fn search(
+        &self,
+        intervals: usize,
+        confine: &mut Window,
+        output: &mut Window,
+    ) -> Result<(), Error> {
+        match &self {
+            Constraint::Event {
+                quantity,
+                relational_operator,
+                refval,
+                adjust,
+                step,
+            } => event_search(
+                quantity,
+                *relational_operator,
+                *refval,
+                *adjust,
+                *step,
+                intervals,
+                confine,
+                output,
+            ),
+            Constraint::Occultation {
+                occultation_type,
+                front,
+                front_shape,
+                front_frame,
+                back,
+                back_shape,
+                back_frame,
+                aberration_correction,
+                observer,
+                step_size,
+            } => occultation_search(
+                *occultation_type,
+                front,
+                *front_shape,
+                front_frame,
+                back,
+                *back_shape,
+                back_frame,
+                *aberration_correction,
+                observer,
+                *step_size,
+                confine,
+                output,
+            ),
+        }
+    }
+}
+
+/// Determine the time intervals within `confine` at which all of the constraints are satisfied.
+///
+/// The result is the intersection of the results of searching for each constraint separately,
+/// provided that every constraint can be decided from the geometry at each instant. Absolute
+/// extrema are found relative to the times that remain when that constraint is searched.
+///
+/// `intervals` is the maximum number of intervals in the result of each individual search.
+pub fn combined_search(
+    constraints: &[Constraint],
+    intervals: usize,
+    confine: &mut Window,
+    output: &mut Window,
+) -> Result<(), Error> {
+    let mut order: Vec<&Constraint> = constraints.iter().collect();
+    order.sort_by_key(|c| c.cost());
+
+    let mut remaining = Window::new_double(2 * window_intervals(confine)?.len().max(1));
+    confine.copy(&mut remaining)?;
+    for constraint in order {
+        if remaining.window_cardinality()? == 0 {
+            break;
+        }
+        let mut found = Window::new_double(2 * intervals);
+        constraint.search(intervals, &mut remaining, &mut found)?;
+        remaining = found;
+    }
+    remaining.copy(output)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::gf::partition::window_from_intervals;
+    use crate::tests::load_test_data;
+    use crate::time::Et;
+
+    const EPSILON: f64 = 1e-3;
+
+    fn separation() -> Constraint {
+        Constraint::Event {
+            quantity: Quantity::AngularSeparation {
+                target1: SpiceString::from("MOON"),
+                shape1: Shape::Point,
+                target2: SpiceString::from("SUN"),
+                shape2: Shape::Point,
+                observer: SpiceString::from("EARTH"),
+                aberration_correction: AberrationCorrection::LT,
+            },
+            relational_operator: RelationalOperator::GT,
+            refval: 1.5,
+            adjust: 0.0,
+            step: Step::Fixed(3600.0),
+        }
+    }
+
+    fn distance() -> Constraint {
+        Constraint::Event {
+            quantity: Quantity::Distance {
+                target: SpiceString::from("MOON"),
+                observer: SpiceString::from("EARTH"),
+                aberration_correction: AberrationCorrection::LT,
+            },
+            relational_operator: RelationalOperator::LT,
+            refval: 380000.0,
+            adjust: 0.0,
+            step: Step::Fixed(3600.0),
+        }
+    }
+
+    #[test]
+    fn test_combined_search() {
+        load_test_data();
+        let start = Et::from_string("2020-01-01").unwrap().0;
+        let end = Et::from_string("2020-07-01").unwrap().0;
+        let mut confine = window_from_intervals(&[(start, end)]).unwrap();
+
+        let mut a = Window::new_double(200);
+        separation().search(100, &mut confine, &mut a).unwrap();
+        let mut b = Window::new_double(200);
+        distance().search(100, &mut confine, &mut b).unwrap();
+        let mut expected = Window::new_double(200);
+        a.window_intersect(&mut b, &mut expected).unwrap();
+        let expected = window_intervals(&mut expected).unwrap();
+        assert!(!expected.is_empty());
+
+        let mut result = Window::new_double(200);
+        combined_search(&[separation(), distance()], 100, &mut confine, &mut result).unwrap();
+        let result = window_intervals(&mut result).unwrap();
+        assert_eq!(result.len(), expected.len());
+        for (a, b) in result.iter().zip(expected.iter()) {
+            assert!((a.0 - b.0).abs() < EPSILON);
+            assert!((a.1 - b.1).abs() < EPSILON);
+        }
+    }
+}
@@ -0,0 +1,360 @@
+//! Geometry Finder functions.
+pub mod constraint;
+pub mod partition;
+pub mod proxy;
+pub mod quantity;
+pub mod step;
+pub mod stream;
+
+use crate::cell::Window;
+use crate::common::AberrationCorrection;
+use crate::error::get_last_error;
+use crate::string::StaticSpiceStr;
+use crate::string::{static_spice_str, StringParam};
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{
+    gfbail_c, gfevnt_c, gfoclt_c, gfrefn_c, gfrepf_c, gfrepi_c, gfrepu_c, gfsep_c, SpiceBoolean,
+    SpiceChar, SpiceDouble, SpiceInt, SPICEFALSE, SPICE_GFEVNT_MAXPAR, SPICE_GF_CNVTOL,
+};
+use quantity::{Quantity, LNSIZE};
+use std::ffi::c_void;
+use step::Step;
+
+#[derive(Copy, Clone, Debug)]
+pub enum Shape {
+    Sphere,
+    Point,
+}
+
+impl Shape {
+    pub(crate) unsafe fn as_spice_char(&self) -> *mut SpiceChar {
+        match &self {
+            Shape::Sphere => static_spice_str!("SPHERE"),
+            Shape::Point => static_spice_str!("POINT"),
+        }
+        .as_mut_ptr()
+    }
+}
+
+#[derive(Copy, Clone, Debug)]
+pub enum RelationalOperator {
+    GT,
+    EQ,
+    LT,
+    AbsMax,
+    AbsMin,
+    LocalMax,
+    LocalMin,
+}
+
+impl RelationalOperator {
+    pub(crate) unsafe fn as_spice_char(&self) -> *mut SpiceChar {
+        match &self {
+            RelationalOperator::GT => static_spice_str!(">"),
+            RelationalOperator::EQ => static_spice_str!("="),
+            RelationalOperator::LT => static_spice_str!("<"),
+            RelationalOperator::AbsMax => static_spice_str!("ABSMAX"),
+            RelationalOperator::AbsMin => static_spice_str!("ABSMIN"),
+            RelationalOperator::LocalMax => static_spice_str!("LOCMAX"),
+            RelationalOperator::LocalMin => static_spice_str!("LOCMIN"),
+        }
+        .as_mut_ptr()
+    }
+}
+
+/// Determine time intervals when the angular separation between the position vectors of two target
+/// bodies relative to an observer satisfies a numerical relationship.
+///
+/// See [gfsep_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gfsep_c.html)
+#[allow(clippy::too_many_arguments)]
+pub fn separation_search<'b1, 'f1, 'b2, 'f2, 'o, B1, F1, B2, F2, O>(
+    body1: B1,
+    shape1: Shape,
+    frame1: F1,
+    body2: B2,
+    shape2: Shape,
+    frame2: F2,
+    aberration_correction: AberrationCorrection,
+    observing_body: O,
+    relational_operator: RelationalOperator,
+    refval: SpiceDouble,
+    adjust: SpiceDouble,
+    step_size: SpiceDouble,
+    intervals: usize,
+    confine: &mut Window,
+    output: &mut Window,
+) -> Result<(), Error>
+where
+    B1: Into<StringParam<'b1>>,
+    F1: Into<StringParam<'f1>>,
+    B2: Into<StringParam<'b2>>,
+    F2: Into<StringParam<'f2>>,
+    O: Into<StringParam<'o>>,
+{
+    with_spice_lock_or_panic(|| {
+        unsafe {
+            gfsep_c(
+                body1.into().as_mut_ptr(),
+                shape1.as_spice_char(),
+                frame1.into().as_mut_ptr(),
+                body2.into().as_mut_ptr(),
+                shape2.as_spice_char(),
+                frame2.into().as_mut_ptr(),
+                aberration_correction.as_spice_char(),
+                observing_body.into().as_mut_ptr(),
+                relational_operator.as_spice_char(),
+                refval,
+                adjust,
+                step_size,
+                intervals as SpiceInt,
+                confine.as_mut_cell(),
+                output.as_mut_cell(),
+            );
+        };
+        get_last_error()
+    })
+}
+
+#[derive(Copy, Clone, Debug, PartialEq, Eq)]
+pub enum OccultationType {
+    Full,
+    Annular,
+    Partial,
+    Any,
+}
+
+impl OccultationType {
+    pub(crate) unsafe fn as_spice_char(&self) -> *mut SpiceChar {
+        match &self {
+            OccultationType::Full => static_spice_str!("FULL"),
+            OccultationType::Annular => static_spice_str!("ANNULAR"),
+            OccultationType::Partial => static_spice_str!("PARTIAL"),
+            OccultationType::Any => static_spice_str!("ANY"),
+        }
+        .as_mut_ptr()
+    }
+}
+
+/// The shape model of an occulting or occulted body.
+#[derive(Copy, Clone, Debug, PartialEq, Eq)]
+pub enum TargetShape {
+    Ellipsoid,
+    Point,
+}
+
+impl TargetShape {
+    pub(crate) unsafe fn as_spice_char(&self) -> *mut SpiceChar {
+        match &self {
+            TargetShape::Ellipsoid => static_spice_str!("ELLIPSOID"),
+            TargetShape::Point => static_spice_str!("POINT"),
+        }
+        .as_mut_ptr()
+    }
+}
+
+/// Determine time intervals when a geometric quantity satisfies a numerical relationship, using
+/// either a fixed or an adaptive step size.
+///
+/// See [gfevnt_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gfevnt_c.html)
+#[allow(clippy::too_many_arguments)]
+pub fn event_search(
+    quantity: &Quantity,
+    relational_operator: RelationalOperator,
+    refval: SpiceDouble,
+    adjust: SpiceDouble,
+    step: Step,
+    intervals: usize,
+    confine: &mut Window,
+    output: &mut Window,
+) -> Result<(), Error> {
+    let (qnpars, qpnams, qcpars) = quantity.parameters();
+    let qdpars = [0.0f64; SPICE_GFEVNT_MAXPAR as usize];
+    let qipars = [0; SPICE_GFEVNT_MAXPAR as usize];
+    let qlpars = [0; SPICE_GFEVNT_MAXPAR as usize];
+    with_spice_lock_or_panic(|| {
+        let udstep = step::prepare(step, quantity, confine)?;
+        unsafe {
+            gfevnt_c(
+                Some(udstep),
+                Some(gfrefn_c),
+                quantity.as_spice_char(),
+                qnpars as SpiceInt,
+                LNSIZE as SpiceInt,
+                qpnams.as_ptr() as *const c_void,
+                qcpars.as_ptr() as *const c_void,
+                qdpars.as_ptr(),
+                qipars.as_ptr(),
+                qlpars.as_ptr(),
+                relational_operator.as_spice_char(),
+                refval,
+                SPICE_GF_CNVTOL,
+                adjust,
+                SPICEFALSE as SpiceBoolean,
+                Some(gfrepi_c),
+                Some(gfrepu_c),
+                Some(gfrepf_c),
+                intervals as SpiceInt,
+                SPICEFALSE as SpiceBoolean,
+                Some(gfbail_c),
+                confine.as_mut_cell(),
+                output.as_mut_cell(),
+            );
+        };
+        step::finish();
+        get_last_error()
+    })
+}
+
+/// Determine time intervals when an observer sees one target occulted by, or in transit across,
+/// another.
+///
+/// See [gfoclt_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gfoclt_c.html)
+#[allow(clippy::too_many_arguments)]
+pub fn occultation_search<'f, 'ff, 'b, 'bf, 'o, F, FF, B, BF, O>(
+    occultation_type: OccultationType,
+    front: F,
+    front_shape: TargetShape,
+    front_frame: FF,
+    back: B,
+    back_shape: TargetShape,
+    back_frame: BF,
+    aberration_correction: AberrationCorrection,
+    observing_body: O,
+    step_size: SpiceDouble,
+    confine: &mut Window,
+    output: &mut Window,
+) -> Result<(), Error>
+where
+    F: Into<StringParam<'f>>,
+    FF: Into<StringParam<'ff>>,
+    B: Into<StringParam<'b>>,
+    BF: Into<StringParam<'bf>>,
+    O: Into<StringParam<'o>>,
+{
+    with_spice_lock_or_panic(|| {
+        unsafe {
+            gfoclt_c(
+                occultation_type.as_spice_char(),
+                front.into().as_mut_ptr(),
+                front_shape.as_spice_char(),
+                front_frame.into().as_mut_ptr(),
+                back.into().as_mut_ptr(),
+                back_shape.as_spice_char(),
+                back_frame.into().as_mut_ptr(),
+                aberration_correction.as_spice_char(),
+                observing_body.into().as_mut_ptr(),
+                step_size,
+                confine.as_mut_cell(),
+                output.as_mut_cell(),
+            );
+        };
+        get_last_error()
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::data::coverage::CoverageIndex;
+    use crate::gf::partition::{window_from_intervals, window_intervals};
+    use crate::gf::step::AdaptiveStep;
+    use crate::string::SpiceString;
+    use crate::tests::load_test_data;
+    use crate::time::Et;
+    use std::path::PathBuf;
+
+    const EPSILON: f64 = 1e-3;
+
+    fn moon_sun_separation() -> Quantity {
+        Quantity::AngularSeparation {
+            target1: SpiceString::from("MOON"),
+            shape1: Shape::Point,
+            target2: SpiceString::from("SUN"),
+            shape2: Shape::Point,
+            observer: SpiceString::from("EARTH"),
+            aberration_correction: AberrationCorrection::LT,
+        }
+    }
+
+    fn search(step: Step) -> Vec<(SpiceDouble, SpiceDouble)> {
+        let start = Et::from_string("2020-01-01").unwrap().0;
+        let end = Et::from_string("2020-07-01").unwrap().0;
+        search_within(&moon_sun_separation(), 2.0, step, start, end)
+    }
+
+    fn search_within(
+        quantity: &Quantity,
+        refval: SpiceDouble,
+        step: Step,
+        start: SpiceDouble,
+        end: SpiceDouble,
+    ) -> Vec<(SpiceDouble, SpiceDouble)> {
+        let mut confine = window_from_intervals(&[(start, end)]).unwrap();
+        let mut output = Window::new_double(200);
+        event_search(
+            quantity,
+            RelationalOperator::GT,
+            refval,
+            0.0,
+            step,
+            100,
+            &mut confine,
+            &mut output,
+        )
+        .unwrap();
+        window_intervals(&mut output).unwrap()
+    }
+
+    #[test]
+    fn test_adaptive_step_search() {
+        load_test_data();
+        let expected = search(Step::Fixed(3600.0));
+        assert!(!expected.is_empty());
+        let result = search(Step::Adaptive(AdaptiveStep {
+            max_rate_change: 1e-10,
+            safety_factor: 0.5,
+            min_step: 3600.0,
+            max_step: 5.0 * 86400.0,
+        }));
+        assert_eq!(result.len(), expected.len());
+        for (a, b) in result.iter().zip(expected.iter()) {
+            assert!((a.0 - b.0).abs() < EPSILON);
+            assert!((a.1 - b.1).abs() < EPSILON);
+        }
+    }
+
+    #[test]
+    fn test_adaptive_step_coverage_edge() {
+        load_test_data();
+        // The rate is never sampled outside of the confinement window, which here starts where the
+        // ephemeris does
+        let kernel = PathBuf::from(env!("CARGO_MANIFEST_DIR")).join("test_data/de432s.bsp");
+        let index = CoverageIndex::scan(kernel).unwrap();
+        let start = index.coverage(301).unwrap()[0].0;
+        let end = start + 60.0 * 86400.0;
+        let distance = Quantity::Distance {
+            target: SpiceString::from("MOON"),
+            observer: SpiceString::from("EARTH"),
+            aberration_correction: AberrationCorrection::NONE,
+        };
+        let expected = search_within(&distance, 390000.0, Step::Fixed(3600.0), start, end);
+        assert!(!expected.is_empty());
+        let result = search_within(
+            &distance,
+            390000.0,
+            Step::Adaptive(AdaptiveStep {
+                max_rate_change: 1e-6,
+                safety_factor: 0.5,
+                min_step: 3600.0,
+                max_step: 86400.0,
+            }),
+            start,
+            end,
+        );
+        assert_eq!(result.len(), expected.len());
+        for (a, b) in result.iter().zip(expected.iter()) {
+            assert!((a.0 - b.0).abs() < EPSILON);
+            assert!((a.1 - b.1).abs() < EPSILON);
+        }
+    }
+}
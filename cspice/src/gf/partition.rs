@@ -0,0 +1,182 @@
+//! Splitting a Geometry Finder search into independent sub-searches over parts of the confinement
+//! window.
+//!
+//! A search over a long confinement window can be divided into consecutive chunks of roughly equal
+//! measure, with each chunk searched on its own and the results merged afterwards. Intervals that
+//! straddle a chunk boundary are returned as two touching intervals by the individual searches and
+//! are joined again when the results are merged.
+//!
+//! The SPICE library keeps its state (loaded kernels, the kernel pool and the GF internals) in
+//! global variables, so in a single process the chunks are searched one after another under the
+//! SPICE lock. Because the chunks are independent they can also be distributed across processes,
+//! with [partition_window()] producing the work items and [merge_windows()] combining the results.
+//!
+//! Partitioning is only valid for conditions that can be decided from the geometry at each
+//! instant, such as the relational operators and local extrema. Absolute extrema must be searched
+//! over the whole confinement window.
+use crate::cell::Window;
+use crate::Error;
+use cspice_sys::SpiceDouble;
+
+/// Collect the intervals of a window.
+pub(crate) fn window_intervals(
+    window: &mut Window,
+) -> Result<Vec<(SpiceDouble, SpiceDouble)>, Error> {
+    let count = window.window_cardinality()? as usize;
+    (0..count).map(|i| window.window_interval(i)).collect()
+}
+
+/// Create a window containing the given intervals.
+pub(crate) fn window_from_intervals(
+    intervals: &[(SpiceDouble, SpiceDouble)],
+) -> Result<Window, Error> {
+    let mut window = Window::new_double(2 * intervals.len().max(1));
+    for &(left, right) in intervals {
+        window.window_insert_interval(left, right)?;
+    }
+    Ok(window)
+}
+
+/// Split a confinement window into at most `parts` consecutive windows of roughly equal measure.
+///
+/// Adjacent parts share their boundary point, so that an interval which satisfies a condition
+/// across a boundary is found as two touching intervals.
+pub fn partition_window(confine: &mut Window, parts: usize) -> Result<Vec<Window>, Error> {
+    let intervals = window_intervals(confine)?;
+    let measure: SpiceDouble = intervals.iter().map(|(left, right)| right - left).sum();
+    let parts = parts.max(1);
+    let target = measure / parts as SpiceDouble;
+    if target <= 0.0 {
+        return Ok(vec![window_from_intervals(&intervals)?]);
+    }
+
+    let mut windows = Vec::with_capacity(parts);
+    let mut current = Vec::new();
+    let mut current_measure = 0.0;
+    for (start, right) in intervals {
+        let mut left = start;
+        while windows.len() + 1 < parts && current_measure + (right - left) >= target {
+            let cut = left + (target - current_measure);
+            current.push((left, cut));
+            windows.push(window_from_intervals(&current)?);
+            current.clear();
+            current_measure = 0.0;
+            left = cut;
+        }
+        // Keep singleton intervals of the original window, but not the empty remainder of a cut
+        if right > left || left == start {
+            current_measure += right - left;
+            current.push((left, right));
+        }
+    }
+    if !current.is_empty() {
+        windows.push(window_from_intervals(&current)?);
+    }
+    Ok(windows)
+}
+
+/// Merge the results of searches over the parts of a confinement window into a single window,
+/// joining intervals that touch at the part boundaries.
+pub fn merge_windows(results: &mut [Window]) -> Result<Window, Error> {
+    let mut intervals = Vec::new();
+    for result in results.iter_mut() {
+        intervals.extend(window_intervals(result)?);
+    }
+    window_from_intervals(&intervals)
+}
+
+/// Run a search separately over `parts` consecutive parts of the confinement window and merge the
+/// results.
+///
+/// `search` is called with the confinement window of each part and an output window able to hold
+/// `intervals` intervals, and should run a search such as [separation_search()](super::separation_search).
+/// Because the result of each part is merged as soon as it is found, `intervals` only needs to be
+/// large enough for the results within a single part.
+pub fn partitioned_search<F>(
+    confine: &mut Window,
+    parts: usize,
+    intervals: usize,
+    mut search: F,
+) -> Result<Window, Error>
+where
+    F: FnMut(&mut Window, &mut Window) -> Result<(), Error>,
+{
+    let mut found = Vec::new();
+    for mut part in partition_window(confine, parts)? {
+        let mut output = Window::new_double(2 * intervals);
+        search(&mut part, &mut output)?;
+        found.extend(window_intervals(&mut output)?);
+    }
+    window_from_intervals(&found)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::common::AberrationCorrection;
+    use crate::gf::{separation_search, RelationalOperator, Shape};
+    use crate::tests::load_test_data;
+    use crate::time::Et;
+
+    const EPSILON: f64 = 1e-3;
+
+    fn search(confine: &mut Window, output: &mut Window) -> Result<(), Error> {
+        separation_search(
+            "MOON",
+            Shape::Point,
+            "NULL",
+            "SUN",
+            Shape::Point,
+            "NULL",
+            AberrationCorrection::LT,
+            "EARTH",
+            RelationalOperator::GT,
+            2.0,
+            0.0,
+            3600.0,
+            100,
+            confine,
+            output,
+        )
+    }
+
+    #[test]
+    fn test_partition_window() {
+        let mut confine = window_from_intervals(&[(0.0, 10.0), (20.0, 50.0)]).unwrap();
+        let mut parts = partition_window(&mut confine, 4).unwrap();
+        assert_eq!(parts.len(), 4);
+        let intervals: Vec<_> = parts
+            .iter_mut()
+            .map(|p| window_intervals(p).unwrap())
+            .collect();
+        assert_eq!(intervals[0], vec![(0.0, 10.0)]);
+        assert_eq!(intervals[1], vec![(20.0, 30.0)]);
+        assert_eq!(intervals[3], vec![(40.0, 50.0)]);
+        let mut merged = merge_windows(&mut parts).unwrap();
+        assert_eq!(
+            window_intervals(&mut merged).unwrap(),
+            vec![(0.0, 10.0), (20.0, 50.0)]
+        );
+    }
+
+    #[test]
+    fn test_partitioned_separation_search() {
+        load_test_data();
+        let start = Et::from_string("2020-01-01").unwrap().0;
+        let end = Et::from_string("2020-03-01").unwrap().0;
+        let mut confine = window_from_intervals(&[(start, end)]).unwrap();
+
+        let mut expected = Window::new_double(200);
+        search(&mut confine, &mut expected).unwrap();
+        let expected = window_intervals(&mut expected).unwrap();
+        assert!(!expected.is_empty());
+
+        let mut result = partitioned_search(&mut confine, 7, 100, search).unwrap();
+        let result = window_intervals(&mut result).unwrap();
+        assert_eq!(result.len(), expected.len());
+        for (a, b) in result.iter().zip(expected.iter()) {
+            assert!((a.0 - b.0).abs() < EPSILON);
+            assert!((a.1 - b.1).abs() < EPSILON);
+        }
+    }
+}
@@ -0,0 +1,518 @@
+//! Geometry Finder searches over a Chebyshev approximation ("proxy") of a quantity.
+//!
+//! Evaluating a geometric quantity requires aberration corrected states and frame
+//! transformations, and a GF search evaluates it at every step and every refinement. In proxy mode
+//! the quantity is instead sampled once over the confinement window and fitted with piecewise
+//! Chebyshev expansions, splitting segments until the truncation error is within a tolerance. The
+//! search is then run over the proxy, and only the boundaries of the intervals found are refined
+//! against the true quantity, in small windows around each boundary.
+use crate::cell::Window;
+use crate::error::{get_last_error, signal_error};
+use crate::gf::partition::{window_from_intervals, window_intervals};
+use crate::gf::quantity::Quantity;
+use crate::gf::step::Step;
+use crate::gf::{event_search, RelationalOperator};
+use crate::string::{static_spice_str, StaticSpiceStr};
+use crate::time::Et;
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{chbint_c, gfuds_c, SpiceBoolean, SpiceDouble, SpiceInt, SPICEFALSE, SPICETRUE};
+use std::cell::RefCell;
+use std::f64::consts::PI;
+
+/// The number of times the window used to refine a boundary is widened before giving up and
+/// keeping the boundary found on the proxy.
+const MAX_REFINEMENTS: usize = 8;
+
+/// Parameters controlling the fit of a [Proxy].
+#[derive(Copy, Clone, Debug, PartialEq)]
+pub struct ProxyOptions {
+    /// The length in seconds of the segments that are initially fitted.
+    pub segment_length: SpiceDouble,
+    /// Segments are not split any further once they are shorter than this.
+    pub min_segment_length: SpiceDouble,
+    /// The degree of the Chebyshev expansion of each segment.
+    pub degree: usize,
+    /// The maximum estimated error of the fit, in the units of the quantity.
+    pub tolerance: SpiceDouble,
+}
+
+/// A Chebyshev expansion of a quantity over one segment of time.
+#[derive(Clone, Debug, PartialEq)]
+struct Segment {
+    /// Midpoint and radius of the segment, as expected by `chbint_c`.
+    x2s: [SpiceDouble; 2],
+    coefficients: Vec<SpiceDouble>,
+}
+
+impl Segment {
+    fn start(&self) -> SpiceDouble {
+        self.x2s[0] - self.x2s[1]
+    }
+
+    fn end(&self) -> SpiceDouble {
+        self.x2s[0] + self.x2s[1]
+    }
+
+    /// The estimated truncation error of the expansion.
+    fn error(&self) -> SpiceDouble {
+        self.coefficients
+            .iter()
+            .rev()
+            .take(2)
+            .map(|c| c.abs())
+            .sum()
+    }
+}
+
+/// A piecewise Chebyshev approximation of a quantity over a window.
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct Proxy {
+    segments: Vec<Segment>,
+}
+
+impl Proxy {
+    /// Sample and fit a quantity over a confinement window.
+    pub fn fit(
+        quantity: &Quantity,
+        confine: &mut Window,
+        options: &ProxyOptions,
+    ) -> Result<Self, Error> {
+        let intervals = window_intervals(confine)?;
+        with_spice_lock_or_panic(|| {
+            let mut segments = Vec::new();
+            for (left, right) in intervals {
+                let count = ((right - left) / options.segment_length).ceil().max(1.0) as usize;
+                let length = (right - left) / count as SpiceDouble;
+                for i in 0..count {
+                    let start = left + i as SpiceDouble * length;
+                    let end = if i + 1 == count {
+                        right
+                    } else {
+                        start + length
+                    };
+                    fit_segment(quantity, start, end, options, &mut segments)?;
+                }
+            }
+            Ok(Self { segments })
+        })
+    }
+
+    /// The number of segments in the approximation.
+    pub fn len(&self) -> usize {
+        self.segments.len()
+    }
+
+    /// Whether the approximation contains no segments.
+    pub fn is_empty(&self) -> bool {
+        self.segments.is_empty()
+    }
+
+    /// Evaluate the approximation and its derivative at an epoch. Epochs outside of the fitted
+    /// window are evaluated using the nearest segment.
+    pub fn value_and_rate(&self, et: SpiceDouble) -> (SpiceDouble, SpiceDouble) {
+        with_spice_lock_or_panic(|| unsafe { self.evaluate(et) })
+    }
+
+    unsafe fn evaluate(&self, et: SpiceDouble) -> (SpiceDouble, SpiceDouble) {
+        let index = self.segments.partition_point(|s| s.end() < et);
+        let segment = match self.segments.get(index).or_else(|| self.segments.last()) {
+            Some(s) => s,
+            None => return (0.0, 0.0),
+        };
+        let x = et.clamp(segment.start(), segment.end());
+        let (mut value, mut rate) = (0.0, 0.0);
+        chbint_c(
+            segment.coefficients.as_ptr(),
+            (segment.coefficients.len() - 1) as SpiceInt,
+            segment.x2s.as_ptr(),
+            x,
+            &mut value,
+            &mut rate,
+        );
+        (value, rate)
+    }
+}
+
+/// Fit a segment, splitting it in half until the fit is within tolerance.
+fn fit_segment(
+    quantity: &Quantity,
+    start: SpiceDouble,
+    end: SpiceDouble,
+    options: &ProxyOptions,
+    segments: &mut Vec<Segment>,
+) -> Result<(), Error> {
+    let n = options.degree + 1;
+    let x2s = [(start + end) / 2.0, (end - start) / 2.0];
+    let mut samples = Vec::with_capacity(n);
+    for k in 0..n {
+        let node = (PI * (k as SpiceDouble + 0.5) / n as SpiceDouble).cos();
+        samples.push(unsafe { quantity.evaluate(x2s[0] + node * x2s[1]) });
+    }
+    get_last_error()?;
+    let coefficients = (0..n)
+        .map(|j| {
+            let sum: SpiceDouble = samples
+                .iter()
+                .enumerate()
+                .map(|(k, f)| {
+                    f * (PI * j as SpiceDouble * (k as SpiceDouble + 0.5) / n as SpiceDouble).cos()
+                })
+                .sum();
+            if j == 0 {
+                sum / n as SpiceDouble
+            } else {
+                2.0 * sum / n as SpiceDouble
+            }
+        })
+        .collect();
+    let segment = Segment { x2s, coefficients };
+    if segment.error() > options.tolerance && end - start > options.min_segment_length {
+        let mid = x2s[0];
+        fit_segment(quantity, start, mid, options, segments)?;
+        fit_segment(quantity, mid, end, options, segments)
+    } else {
+        segments.push(segment);
+        Ok(())
+    }
+}
+
+thread_local! {
+    /// The approximation used by the callbacks of the proxy search in progress.
+    static PROXY: RefCell<Option<Proxy>> = const { RefCell::new(None) };
+}
+
+static NO_SEARCH: StaticSpiceStr = static_spice_str!("SPICE(BUG)");
+static NO_SEARCH_MESSAGE: StaticSpiceStr =
+    static_spice_str!("A proxy search callback was called with no search in progress.");
+
+/// Call `f` with the approximation of the search in progress, or signal an error if there is none.
+fn with_proxy(f: impl FnOnce(&Proxy)) {
+    PROXY.with(|proxy| match proxy.borrow().as_ref() {
+        Some(proxy) => f(proxy),
+        None => unsafe { signal_error(&NO_SEARCH, &NO_SEARCH_MESSAGE) },
+    })
+}
+
+/// Quantity function passed to `gfuds_c`.
+extern "C" fn proxy_value(et: SpiceDouble, value: *mut SpiceDouble) {
+    with_proxy(|proxy| unsafe { *value = proxy.evaluate(et).0 })
+}
+
+/// Decreasing test passed to `gfuds_c`, using the derivative of the expansion.
+extern "C" fn proxy_decreasing(
+    _udfuns: Option<unsafe extern "C" fn(SpiceDouble, *mut SpiceDouble)>,
+    et: SpiceDouble,
+    isdecr: *mut SpiceBoolean,
+) {
+    with_proxy(|proxy| {
+        let decreasing = unsafe { proxy.evaluate(et).1 } < 0.0;
+        unsafe {
+            *isdecr = if decreasing { SPICETRUE } else { SPICEFALSE } as SpiceBoolean;
+        }
+    })
+}
+
+/// Determine time intervals when a geometric quantity satisfies a numerical relationship, by
+/// searching a Chebyshev approximation of the quantity and refining the boundaries found against
+/// the quantity itself.
+///
+/// `step` is used for the search over the approximation, and has the same meaning as in
+/// [event_search()]. Boundaries are refined with the default GF convergence tolerance.
+///
+/// See [gfuds_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gfuds_c.html)
+#[allow(clippy::too_many_arguments)]
+pub fn proxy_search(
+    quantity: &Quantity,
+    relational_operator: RelationalOperator,
+    refval: SpiceDouble,
+    adjust: SpiceDouble,
+    step: SpiceDouble,
+    intervals: usize,
+    options: &ProxyOptions,
+    confine: &mut Window,
+    output: &mut Window,
+) -> Result<(), Error> {
+    let proxy = Proxy::fit(quantity, confine, options)?;
+    let bounds = window_intervals(confine)?;
+
+    let mut approximate = Window::new_double(2 * intervals);
+    // The approximation is lent to the callbacks for the duration of the search
+    let proxy = with_spice_lock_or_panic(|| {
+        PROXY.with(|p| *p.borrow_mut() = Some(proxy));
+        unsafe {
+            gfuds_c(
+                Some(proxy_value),
+                Some(proxy_decreasing),
+                relational_operator.as_spice_char(),
+                refval,
+                adjust,
+                step,
+                intervals as SpiceInt,
+                confine.as_mut_cell(),
+                approximate.as_mut_cell(),
+            );
+        };
+        let proxy = PROXY.with(|p| p.borrow_mut().take()).unwrap_or_default();
+        get_last_error().map(|_| proxy)
+    })?;
+
+    // The value at which the boundaries of non-singleton intervals are found, and the operator
+    // whose result starts or ends at those boundaries
+    let (crossing_operator, crossing_value) = match relational_operator {
+        RelationalOperator::AbsMax => (
+            RelationalOperator::GT,
+            absolute_extremum(quantity, &proxy, &bounds, true)?,
+        ),
+        RelationalOperator::AbsMin => (
+            RelationalOperator::LT,
+            absolute_extremum(quantity, &proxy, &bounds, false)?,
+        ),
+        op => (op, refval),
+    };
+    let crossing_value = match relational_operator {
+        RelationalOperator::AbsMax => crossing_value - adjust,
+        RelationalOperator::AbsMin => crossing_value + adjust,
+        _ => crossing_value,
+    };
+    let singleton_operator = match relational_operator {
+        RelationalOperator::LocalMax | RelationalOperator::AbsMax => RelationalOperator::LocalMax,
+        RelationalOperator::LocalMin | RelationalOperator::AbsMin => RelationalOperator::LocalMin,
+        op => op,
+    };
+
+    let mut refined = Vec::new();
+    for (left, right) in window_intervals(&mut approximate)? {
+        let limits = bounds
+            .iter()
+            .copied()
+            .find(|(l, r)| *l <= left && right <= *r)
+            .unwrap_or((left, right));
+        if left == right {
+            let t = refine(quantity, singleton_operator, refval, left, limits, &proxy)?;
+            refined.push((t, t));
+        } else {
+            let boundary = |t: SpiceDouble| {
+                if t == limits.0 || t == limits.1 {
+                    Ok(t)
+                } else {
+                    refine(
+                        quantity,
+                        crossing_operator,
+                        crossing_value,
+                        t,
+                        limits,
+                        &proxy,
+                    )
+                }
+            };
+            let (l, r) = (boundary(left)?, boundary(right)?);
+            refined.push((l.min(r), r.max(l)));
+        }
+    }
+
+    output.set_cardinality(0)?;
+    for (left, right) in refined {
+        output.window_insert_interval(left, right)?;
+    }
+    Ok(())
+}
+
+/// The absolute maximum or minimum of the quantity. The extremum is located on the approximation,
+/// and its time is refined by a search for the local extremum of the quantity near it, at which
+/// the value of the quantity itself is taken.
+fn absolute_extremum(
+    quantity: &Quantity,
+    proxy: &Proxy,
+    bounds: &[(SpiceDouble, SpiceDouble)],
+    maximum: bool,
+) -> Result<SpiceDouble, Error> {
+    let mut best = if maximum {
+        SpiceDouble::NEG_INFINITY
+    } else {
+        SpiceDouble::INFINITY
+    };
+    let mut best_time = 0.0;
+    for segment in &proxy.segments {
+        // Sample each segment densely enough to resolve the extrema of its expansion
+        let samples = 4 * segment.coefficients.len();
+        for i in 0..=samples {
+            let t = segment.start() + (segment.end() - segment.start()) * i as f64 / samples as f64;
+            let (value, _) = proxy.value_and_rate(t);
+            if (maximum && value > best) || (!maximum && value < best) {
+                best = value;
+                best_time = t;
+            }
+        }
+    }
+    let limits = bounds
+        .iter()
+        .copied()
+        .find(|(l, r)| *l <= best_time && best_time <= *r)
+        .unwrap_or((best_time, best_time));
+    // An extremum at the edge of the window is not a local extremum of the quantity
+    let time = if best_time == limits.0 || best_time == limits.1 {
+        best_time
+    } else {
+        let local = if maximum {
+            RelationalOperator::LocalMax
+        } else {
+            RelationalOperator::LocalMin
+        };
+        refine(quantity, local, 0.0, best_time, limits, proxy)?
+    };
+    quantity.value(Et(time))
+}
+
+/// Refine a boundary found on the approximation, by searching for the event nearest to it in a
+/// small window around it using the quantity itself. The window is widened a few times if no event
+/// is found, after which the boundary is an error rather than left unrefined.
+fn refine(
+    quantity: &Quantity,
+    relational_operator: RelationalOperator,
+    refval: SpiceDouble,
+    t: SpiceDouble,
+    limits: (SpiceDouble, SpiceDouble),
+    proxy: &Proxy,
+) -> Result<SpiceDouble, Error> {
+    // The proxy error translates to a time error of roughly error / rate at a crossing
+    let (_, rate) = proxy.value_and_rate(t);
+    let error = proxy
+        .segments
+        .iter()
+        .map(|s| s.error())
+        .fold(0.0, SpiceDouble::max);
+    let mut delta = (4.0 * error / rate.abs()).clamp(1.0, 3600.0);
+    for _ in 0..MAX_REFINEMENTS {
+        let (left, right) = ((t - delta).max(limits.0), (t + delta).min(limits.1));
+        let mut confine = window_from_intervals(&[(left, right)])?;
+        let mut output = Window::new_double(8);
+        event_search(
+            quantity,
+            relational_operator,
+            refval,
+            0.0,
+            Step::Fixed(delta / 2.0),
+            4,
+            &mut confine,
+            &mut output,
+        )?;
+        let found = window_intervals(&mut output)?
+            .into_iter()
+            .flat_map(|(l, r)| [l, r])
+            .filter(|&x| x > left && x < right)
+            .min_by(|a, b| (a - t).abs().total_cmp(&(b - t).abs()));
+        if let Some(found) = found {
+            return Ok(found);
+        }
+        delta *= 2.0;
+    }
+    Err(Error::new(
+        "SPICE(NOCONVERGENCE)",
+        format!(
+            "No event was found within {} seconds of the boundary at {t} found on the approximation.",
+            delta / 2.0
+        ),
+    ))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::common::AberrationCorrection;
+    use crate::gf::Shape;
+    use crate::string::SpiceString;
+    use crate::tests::load_test_data;
+
+    const EPSILON: f64 = 1e-3;
+
+    fn moon_sun_separation() -> Quantity {
+        Quantity::AngularSeparation {
+            target1: SpiceString::from("MOON"),
+            shape1: Shape::Point,
+            target2: SpiceString::from("SUN"),
+            shape2: Shape::Point,
+            observer: SpiceString::from("EARTH"),
+            aberration_correction: AberrationCorrection::LT,
+        }
+    }
+
+    const OPTIONS: ProxyOptions = ProxyOptions {
+        segment_length: 86400.0,
+        min_segment_length: 600.0,
+        degree: 12,
+        tolerance: 1e-8,
+    };
+
+    fn compare(relational_operator: RelationalOperator, refval: SpiceDouble, adjust: SpiceDouble) {
+        let start = Et::from_string("2020-01-01").unwrap().0;
+        let end = Et::from_string("2020-03-01").unwrap().0;
+        let quantity = moon_sun_separation();
+
+        let mut confine = window_from_intervals(&[(start, end)]).unwrap();
+        let mut expected = Window::new_double(200);
+        event_search(
+            &quantity,
+            relational_operator,
+            refval,
+            adjust,
+            Step::Fixed(3600.0),
+            100,
+            &mut confine,
+            &mut expected,
+        )
+        .unwrap();
+        let expected = window_intervals(&mut expected).unwrap();
+        assert!(!expected.is_empty());
+
+        let mut result = Window::new_double(200);
+        proxy_search(
+            &quantity,
+            relational_operator,
+            refval,
+            adjust,
+            3600.0,
+            100,
+            &OPTIONS,
+            &mut confine,
+            &mut result,
+        )
+        .unwrap();
+        let result = window_intervals(&mut result).unwrap();
+        assert_eq!(result.len(), expected.len());
+        for (a, b) in result.iter().zip(expected.iter()) {
+            assert!((a.0 - b.0).abs() < EPSILON);
+            assert!((a.1 - b.1).abs() < EPSILON);
+        }
+    }
+
+    #[test]
+    fn test_proxy_fit() {
+        load_test_data();
+        let quantity = moon_sun_separation();
+        let start = Et::from_string("2020-01-01").unwrap().0;
+        let mut confine = window_from_intervals(&[(start, start + 10.0 * 86400.0)]).unwrap();
+        let proxy = Proxy::fit(&quantity, &mut confine, &OPTIONS).unwrap();
+        assert!(proxy.len() >= 10);
+        for i in 0..100 {
+            let et = start + i as f64 * 8640.0 + 17.0;
+            let (value, _) = proxy.value_and_rate(et);
+            assert!((value - quantity.value(Et(et)).unwrap()).abs() < 1e-7);
+        }
+    }
+
+    #[test]
+    fn test_proxy_search() {
+        load_test_data();
+        compare(RelationalOperator::GT, 2.0, 0.0);
+        compare(RelationalOperator::LocalMin, 0.0, 0.0);
+    }
+
+    #[test]
+    fn test_proxy_search_absolute() {
+        load_test_data();
+        compare(RelationalOperator::AbsMax, 0.0, 0.0);
+        compare(RelationalOperator::AbsMin, 0.0, 0.0);
+        compare(RelationalOperator::AbsMax, 0.0, 0.05);
+        compare(RelationalOperator::AbsMin, 0.0, 0.05);
+    }
+}
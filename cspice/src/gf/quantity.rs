@@ -0,0 +1,257 @@
+//! Geometric quantities that can be searched for using [event_search()](super::event_search).
+use crate::common::AberrationCorrection;
+use crate::error::get_last_error;
+use crate::gf::Shape;
+use crate::string::{static_spice_str, SpiceString, StaticSpiceStr};
+use crate::time::Et;
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{bodvrd_c, spkezr_c, spkpos_c, vnorm_c, vsep_c, SpiceChar, SpiceDouble, SpiceInt};
+use std::ffi::CStr;
+
+static J2000: StaticSpiceStr = static_spice_str!("J2000");
+static RADII: StaticSpiceStr = static_spice_str!("RADII");
+static NULL: StaticSpiceStr = static_spice_str!("NULL");
+
+/// Length of the strings passed to [gfevnt_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gfevnt_c.html)
+/// in the parameter name and value arrays.
+pub(crate) const LNSIZE: usize = 80;
+
+/// A scalar geometric quantity.
+///
+/// See the `gquant` argument of [gfevnt_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gfevnt_c.html).
+#[derive(Clone, Debug)]
+pub enum Quantity {
+    /// The apparent angular separation of two target bodies as seen from an observing body.
+    ///
+    /// Unlike `gfevnt_c` this takes no body-fixed frames, as they are not used for points and
+    /// spheres, the only shapes supported.
+    AngularSeparation {
+        target1: SpiceString,
+        shape1: Shape,
+        target2: SpiceString,
+        shape2: Shape,
+        observer: SpiceString,
+        aberration_correction: AberrationCorrection,
+    },
+    /// The apparent distance between a target body and an observer.
+    Distance {
+        target: SpiceString,
+        observer: SpiceString,
+        aberration_correction: AberrationCorrection,
+    },
+    /// The rate of change of the apparent distance between a target body and an observer.
+    RangeRate {
+        target: SpiceString,
+        observer: SpiceString,
+        aberration_correction: AberrationCorrection,
+    },
+}
+
+impl Quantity {
+    pub(crate) unsafe fn as_spice_char(&self) -> *mut SpiceChar {
+        match &self {
+            Quantity::AngularSeparation { .. } => static_spice_str!("ANGULAR SEPARATION"),
+            Quantity::Distance { .. } => static_spice_str!("DISTANCE"),
+            Quantity::RangeRate { .. } => static_spice_str!("RANGE RATE"),
+        }
+        .as_mut_ptr()
+    }
+
+    /// The names and values of the quantity definition parameters, packed into the fixed length
+    /// string arrays expected by `gfevnt_c`.
+    pub(crate) fn parameters(&self) -> (usize, Vec<SpiceChar>, Vec<SpiceChar>) {
+        let shape = |shape: &Shape| unsafe { CStr::from_ptr(shape.as_spice_char()) };
+        let abcorr =
+            |abcorr: &AberrationCorrection| unsafe { CStr::from_ptr(abcorr.as_spice_char()) };
+        let null = unsafe { CStr::from_ptr(NULL.as_mut_ptr()) };
+        let params: Vec<(&str, &CStr)> = match &self {
+            Quantity::AngularSeparation {
+                target1,
+                shape1,
+                target2,
+                shape2,
+                observer,
+                aberration_correction,
+            } => vec![
+                ("TARGET1", &target1.0),
+                ("FRAME1", null),
+                ("SHAPE1", shape(shape1)),
+                ("TARGET2", &target2.0),
+                ("FRAME2", null),
+                ("SHAPE2", shape(shape2)),
+                ("OBSERVER", &observer.0),
+                ("ABCORR", abcorr(aberration_correction)),
+            ],
+            Quantity::Distance {
+                target,
+                observer,
+                aberration_correction,
+            }
+            | Quantity::RangeRate {
+                target,
+                observer,
+                aberration_correction,
+            } => vec![
+                ("TARGET", &target.0),
+                ("OBSERVER", &observer.0),
+                ("ABCORR", abcorr(aberration_correction)),
+            ],
+        };
+        let mut names = vec![0; params.len() * LNSIZE];
+        let mut values = vec![0; params.len() * LNSIZE];
+        for (i, (name, value)) in params.iter().enumerate() {
+            let value = value.to_bytes();
+            for (j, &c) in name.as_bytes().iter().take(LNSIZE - 1).enumerate() {
+                names[i * LNSIZE + j] = c as SpiceChar;
+            }
+            for (j, &c) in value.iter().take(LNSIZE - 1).enumerate() {
+                values[i * LNSIZE + j] = c as SpiceChar;
+            }
+        }
+        (params.len(), names, values)
+    }
+
+    /// Compute the value of the quantity at an epoch.
+    pub fn value(&self, et: Et) -> Result<SpiceDouble, Error> {
+        with_spice_lock_or_panic(|| {
+            let value = unsafe { self.evaluate(et.0) };
+            get_last_error()?;
+            Ok(value)
+        })
+    }
+
+    /// Compute the value of the quantity without checking for errors, so that it can be used
+    /// within the callbacks of a GF search. The caller must hold the SPICE lock.
+    pub(crate) unsafe fn evaluate(&self, et: SpiceDouble) -> SpiceDouble {
+        let mut light_time = 0.0;
+        match &self {
+            Quantity::AngularSeparation {
+                target1,
+                shape1,
+                target2,
+                shape2,
+                observer,
+                aberration_correction,
+            } => {
+                let mut pos1 = [0.0f64; 3];
+                let mut pos2 = [0.0f64; 3];
+                spkpos_c(
+                    target1.as_mut_ptr(),
+                    et,
+                    J2000.as_mut_ptr(),
+                    aberration_correction.as_spice_char(),
+                    observer.as_mut_ptr(),
+                    pos1.as_mut_ptr(),
+                    &mut light_time,
+                );
+                spkpos_c(
+                    target2.as_mut_ptr(),
+                    et,
+                    J2000.as_mut_ptr(),
+                    aberration_correction.as_spice_char(),
+                    observer.as_mut_ptr(),
+                    pos2.as_mut_ptr(),
+                    &mut light_time,
+                );
+                vsep_c(pos1.as_mut_ptr(), pos2.as_mut_ptr())
+                    - angular_radius(target1, shape1, &mut pos1)
+                    - angular_radius(target2, shape2, &mut pos2)
+            }
+            Quantity::Distance {
+                target,
+                observer,
+                aberration_correction,
+            } => {
+                let mut pos = [0.0f64; 3];
+                spkpos_c(
+                    target.as_mut_ptr(),
+                    et,
+                    J2000.as_mut_ptr(),
+                    aberration_correction.as_spice_char(),
+                    observer.as_mut_ptr(),
+                    pos.as_mut_ptr(),
+                    &mut light_time,
+                );
+                vnorm_c(pos.as_mut_ptr())
+            }
+            Quantity::RangeRate {
+                target,
+                observer,
+                aberration_correction,
+            } => {
+                let mut state = [0.0f64; 6];
+                spkezr_c(
+                    target.as_mut_ptr(),
+                    et,
+                    J2000.as_mut_ptr(),
+                    aberration_correction.as_spice_char(),
+                    observer.as_mut_ptr(),
+                    state.as_mut_ptr(),
+                    &mut light_time,
+                );
+                let range = vnorm_c(state.as_mut_ptr());
+                if range == 0.0 {
+                    return 0.0;
+                }
+                (state[0] * state[3] + state[1] * state[4] + state[2] * state[5]) / range
+            }
+        }
+    }
+}
+
+/// The apparent angular radius of a body modelled as a sphere with its largest radius, as in
+/// `gfevnt_c`.
+unsafe fn angular_radius(
+    body: &SpiceString,
+    shape: &Shape,
+    position: &mut [SpiceDouble; 3],
+) -> SpiceDouble {
+    if let Shape::Point = shape {
+        return 0.0;
+    }
+    let mut dim: SpiceInt = 0;
+    let mut radii = [0.0f64; 3];
+    bodvrd_c(
+        body.as_mut_ptr(),
+        RADII.as_mut_ptr(),
+        radii.len() as SpiceInt,
+        &mut dim,
+        radii.as_mut_ptr(),
+    );
+    let distance = vnorm_c(position.as_mut_ptr());
+    let radius = radii[0].max(radii[1]).max(radii[2]);
+    if radius >= distance {
+        return std::f64::consts::FRAC_PI_2;
+    }
+    (radius / distance).asin()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::tests::load_test_data;
+    use crate::vector::Vector3D;
+
+    const EPSILON: f64 = 1e-10;
+
+    #[test]
+    fn test_separation_value() {
+        load_test_data();
+        let quantity = Quantity::AngularSeparation {
+            target1: SpiceString::from("MOON"),
+            shape1: Shape::Point,
+            target2: SpiceString::from("SUN"),
+            shape2: Shape::Point,
+            observer: SpiceString::from("EARTH"),
+            aberration_correction: AberrationCorrection::LT,
+        };
+        let (moon, _) =
+            crate::spk::position("MOON", Et(0.0), "J2000", AberrationCorrection::LT, "EARTH")
+                .unwrap();
+        let (sun, _) =
+            crate::spk::position("SUN", Et(0.0), "J2000", AberrationCorrection::LT, "EARTH")
+                .unwrap();
+        let expected = Vector3D::from(moon).separation_angle(&Vector3D::from(sun));
+        assert!((quantity.value(Et(0.0)).unwrap() - expected).abs() < EPSILON);
+    }
+}
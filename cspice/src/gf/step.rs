@@ -0,0 +1,160 @@
+//! Step size selection for Geometry Finder searches.
+use crate::cell::Window;
+use crate::error::signal_error;
+use crate::gf::partition::window_intervals;
+use crate::gf::quantity::Quantity;
+use crate::string::{static_spice_str, StaticSpiceStr};
+use crate::Error;
+use cspice_sys::{gfsstp_c, gfstep_c, SpiceDouble};
+use std::cell::RefCell;
+
+/// The time on either side of an epoch at which the quantity is sampled to estimate its rate of
+/// change.
+const RATE_DELTA: SpiceDouble = 1.0;
+
+/// How a GF search advances through the confinement window while looking for the intervals on
+/// which the quantity is monotone.
+///
+/// See the `udstep` argument of [gfevnt_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gfevnt_c.html).
+#[derive(Copy, Clone, Debug, PartialEq)]
+pub enum Step {
+    /// A constant step size in seconds.
+    ///
+    /// See [gfsstp_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/gfsstp_c.html).
+    Fixed(SpiceDouble),
+    /// A step size chosen at each step from the rate of change of the quantity.
+    Adaptive(AdaptiveStep),
+}
+
+/// Parameters of an adaptive step.
+///
+/// The search looks for the times at which the rate of change of the quantity changes sign. With
+/// `max_rate_change` an upper bound on the magnitude of the second derivative of the quantity, the
+/// rate cannot reach zero in less than `|rate| / max_rate_change` seconds, so the search can safely
+/// advance by that amount while the quantity is changing quickly. The step is scaled by
+/// `safety_factor` and limited to the range `min_step..=max_step`.
+///
+/// `min_step` must satisfy the same requirement as a fixed step: no two extrema of the quantity
+/// may be separated by less than `min_step`.
+///
+/// The GF rate routines only report whether the quantity is decreasing, so the rate is instead
+/// estimated from samples of the quantity [RATE_DELTA] seconds either side of each step. The
+/// samples are limited to the interval of the confinement window containing the step, so the
+/// quantity is never evaluated outside of the window.
+#[derive(Copy, Clone, Debug, PartialEq)]
+pub struct AdaptiveStep {
+    pub max_rate_change: SpiceDouble,
+    pub safety_factor: SpiceDouble,
+    pub min_step: SpiceDouble,
+    pub max_step: SpiceDouble,
+}
+
+impl AdaptiveStep {
+    /// The step to take from a point where the quantity has the given rate of change.
+    pub fn step(&self, rate: SpiceDouble) -> SpiceDouble {
+        let step = self.safety_factor * rate.abs() / self.max_rate_change;
+        if step.is_finite() {
+            step.clamp(self.min_step, self.max_step.max(self.min_step))
+        } else {
+            self.min_step
+        }
+    }
+}
+
+/// The state used by [adaptive_step()] for the search in progress.
+struct AdaptiveState {
+    quantity: Quantity,
+    params: AdaptiveStep,
+    /// The intervals of the confinement window.
+    intervals: Vec<(SpiceDouble, SpiceDouble)>,
+}
+
+impl AdaptiveState {
+    /// The step to take from an epoch, estimating the rate of change of the quantity from samples
+    /// within the interval of the confinement window containing the epoch.
+    unsafe fn step(&self, et: SpiceDouble) -> SpiceDouble {
+        let (left, right) = self
+            .intervals
+            .iter()
+            .copied()
+            .find(|(left, right)| *left <= et && et <= *right)
+            .unwrap_or((et, et));
+        let t0 = (et - RATE_DELTA).max(left);
+        let t1 = (et + RATE_DELTA).min(right);
+        if t1 <= t0 {
+            return self.params.min_step;
+        }
+        let rate = (self.quantity.evaluate(t1) - self.quantity.evaluate(t0)) / (t1 - t0);
+        self.params.step(rate)
+    }
+}
+
+thread_local! {
+    static ADAPTIVE_STEP: RefCell<Option<AdaptiveState>> = const { RefCell::new(None) };
+}
+
+static NO_SEARCH: StaticSpiceStr = static_spice_str!("SPICE(BUG)");
+static NO_SEARCH_MESSAGE: StaticSpiceStr =
+    static_spice_str!("The adaptive step function was called with no search in progress.");
+
+/// Step function passed to `gfevnt_c` for [Step::Adaptive] searches.
+extern "C" fn adaptive_step(et: SpiceDouble, step: *mut SpiceDouble) {
+    ADAPTIVE_STEP.with(|state| {
+        let state = state.borrow();
+        unsafe {
+            match state.as_ref() {
+                Some(state) => *step = state.step(et),
+                None => signal_error(&NO_SEARCH, &NO_SEARCH_MESSAGE),
+            }
+        }
+    })
+}
+
+pub(crate) type StepFn = unsafe extern "C" fn(SpiceDouble, *mut SpiceDouble);
+
+/// Prepare the step function for a search over `quantity` within `confine`. The caller must hold
+/// the SPICE lock until the search has finished and [finish()] has been called.
+pub(crate) fn prepare(
+    step: Step,
+    quantity: &Quantity,
+    confine: &mut Window,
+) -> Result<StepFn, Error> {
+    match step {
+        Step::Fixed(step) => {
+            unsafe { gfsstp_c(step) };
+            Ok(gfstep_c)
+        }
+        Step::Adaptive(params) => {
+            let state = AdaptiveState {
+                quantity: quantity.clone(),
+                params,
+                intervals: window_intervals(confine)?,
+            };
+            ADAPTIVE_STEP.with(|s| *s.borrow_mut() = Some(state));
+            Ok(adaptive_step)
+        }
+    }
+}
+
+/// Release the state used by the step function after a search.
+pub(crate) fn finish() {
+    ADAPTIVE_STEP.with(|state| *state.borrow_mut() = None);
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_adaptive_step_size() {
+        let params = AdaptiveStep {
+            max_rate_change: 1e-10,
+            safety_factor: 0.5,
+            min_step: 60.0,
+            max_step: 86400.0,
+        };
+        assert_eq!(params.step(0.0), 60.0);
+        assert!((params.step(-2e-6) - 10000.0).abs() < 1e-6);
+        assert_eq!(params.step(1.0), 86400.0);
+    }
+}
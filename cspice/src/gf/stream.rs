@@ -0,0 +1,151 @@
+//! Reporting the results of a Geometry Finder search interval by interval.
+//!
+//! The confinement window is searched in consecutive parts, as in
+//! [partitioned_search()](super::partition::partitioned_search), and each interval is passed to a
+//! callback as soon as it is known to be complete. An interval that ends at the end of a part may
+//! continue into the next part, so it is held back until the next part has been searched.
+//!
+//! Only the intervals of a single part are kept in memory at once. If the output window of a part
+//! is too small, the part is split in two and searched again, so `intervals` does not need to be
+//! chosen for the whole search.
+use crate::cell::Window;
+use crate::gf::partition::{partition_window, window_intervals};
+use crate::Error;
+use cspice_sys::SpiceDouble;
+
+/// The maximum number of times a part is split after its output window overflows.
+const MAX_SPLITS: usize = 16;
+
+/// Search `confine` in `parts` consecutive parts, passing each interval of the result to `found`
+/// in increasing order of time.
+///
+/// `search` is called with the confinement window of each part and an output window able to hold
+/// `intervals` intervals, and should run a search such as [separation_search()](super::separation_search).
+/// As with partitioned searches, absolute extrema cannot be found this way.
+pub fn streaming_search<F, G>(
+    confine: &mut Window,
+    parts: usize,
+    intervals: usize,
+    mut search: F,
+    mut found: G,
+) -> Result<(), Error>
+where
+    F: FnMut(&mut Window, &mut Window) -> Result<(), Error>,
+    G: FnMut(SpiceDouble, SpiceDouble) -> Result<(), Error>,
+{
+    let mut pending: Option<(SpiceDouble, SpiceDouble)> = None;
+    for mut part in partition_window(confine, parts)? {
+        let end = match window_intervals(&mut part)?.last() {
+            Some(&(_, right)) => right,
+            None => continue,
+        };
+        for (left, right) in search_part(&mut part, intervals, &mut search, 0)? {
+            pending = match pending {
+                Some((pending_left, pending_right)) if pending_right >= left => {
+                    Some((pending_left, pending_right.max(right)))
+                }
+                Some((pending_left, pending_right)) => {
+                    found(pending_left, pending_right)?;
+                    Some((left, right))
+                }
+                None => Some((left, right)),
+            };
+        }
+        if let Some((left, right)) = pending {
+            if right < end {
+                found(left, right)?;
+                pending = None;
+            }
+        }
+    }
+    if let Some((left, right)) = pending {
+        found(left, right)?;
+    }
+    Ok(())
+}
+
+/// Search a single part, splitting it in two if the output window overflows.
+fn search_part<F>(
+    part: &mut Window,
+    intervals: usize,
+    search: &mut F,
+    splits: usize,
+) -> Result<Vec<(SpiceDouble, SpiceDouble)>, Error>
+where
+    F: FnMut(&mut Window, &mut Window) -> Result<(), Error>,
+{
+    let mut output = Window::new_double(2 * intervals);
+    match search(part, &mut output) {
+        Ok(()) => window_intervals(&mut output),
+        Err(error) if error.short_message == "SPICE(WINDOWEXCESS)" && splits < MAX_SPLITS => {
+            let halves = partition_window(part, 2)?;
+            if halves.len() < 2 {
+                return Err(error);
+            }
+            let mut result = Vec::new();
+            for mut half in halves {
+                result.extend(search_part(&mut half, intervals, search, splits + 1)?);
+            }
+            Ok(result)
+        }
+        Err(error) => Err(error),
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::common::AberrationCorrection;
+    use crate::gf::partition::window_from_intervals;
+    use crate::gf::{separation_search, RelationalOperator, Shape};
+    use crate::tests::load_test_data;
+    use crate::time::Et;
+
+    const EPSILON: f64 = 1e-3;
+
+    fn search(confine: &mut Window, output: &mut Window) -> Result<(), Error> {
+        let intervals = output.get_size()? / 2;
+        separation_search(
+            "MOON",
+            Shape::Point,
+            "NULL",
+            "SUN",
+            Shape::Point,
+            "NULL",
+            AberrationCorrection::LT,
+            "EARTH",
+            RelationalOperator::GT,
+            2.0,
+            0.0,
+            3600.0,
+            intervals,
+            confine,
+            output,
+        )
+    }
+
+    #[test]
+    fn test_streaming_separation_search() {
+        load_test_data();
+        let start = Et::from_string("2020-01-01").unwrap().0;
+        let end = Et::from_string("2020-07-01").unwrap().0;
+        let mut confine = window_from_intervals(&[(start, end)]).unwrap();
+
+        let mut expected = Window::new_double(200);
+        search(&mut confine, &mut expected).unwrap();
+        let expected = window_intervals(&mut expected).unwrap();
+        assert!(expected.len() > 2);
+
+        let mut result = Vec::new();
+        streaming_search(&mut confine, 2, 2, search, |left, right| {
+            result.push((left, right));
+            Ok(())
+        })
+        .unwrap();
+        assert_eq!(result.len(), expected.len());
+        for (a, b) in result.iter().zip(expected.iter()) {
+            assert!((a.0 - b.0).abs() < EPSILON);
+            assert!((a.1 - b.1).abs() < EPSILON);
+        }
+    }
+}
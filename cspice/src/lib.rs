@@ -1,12 +1,19 @@
+pub mod body;
 pub mod cell;
+pub mod chebyshev;
 pub mod common;
+pub mod compare;
 pub mod coordinates;
 pub mod data;
+pub mod ek;
 pub mod error;
+pub mod frame;
 pub mod gf;
 pub mod spk;
 pub mod string;
 pub mod time;
+pub mod tle;
+pub mod two_body;
 pub mod vector;
 
 use crate::error::set_error_defaults;
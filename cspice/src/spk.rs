@@ -1,4 +1,7 @@
 //! Functions relating to the Spacecraft and Planet Ephemeris (SPK) subsystem of SPICE.
+//!
+//! The functions taking body IDs accept a [BodyId](crate::body::BodyId), and every frame name may
+//! be given as a [Frame](crate::frame::Frame), so that repeated calls do no string conversion.
 use crate::common::AberrationCorrection;
 use crate::coordinates::Rectangular;
 use crate::error::get_last_error;
@@ -6,7 +9,9 @@ use crate::string::StringParam;
 use crate::time::Et;
 use crate::vector::Vector3D;
 use crate::{with_spice_lock_or_panic, Error};
-use cspice_sys::{spkez_c, spkezp_c, spkezr_c, spkpos_c, SpiceDouble};
+use cspice_sys::{
+    spkez_c, spkezp_c, spkezr_c, spkgeo_c, spkgps_c, spkpos_c, SpiceDouble, SpiceInt,
+};
 use derive_more::Into;
 
 /// A Cartesian state vector representing the position and velocity of the target body
@@ -66,26 +71,28 @@ where
 /// time (planetary aberration) and stellar aberration.
 ///
 /// See [spkez_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkez_c.html).
-pub fn easy_reader<'r, R>(
-    target: i32,
+pub fn easy_reader<'r, T, R, O>(
+    target: T,
     et: Et,
     reference_frame: R,
     aberration_correction: AberrationCorrection,
-    observing_body: i32,
+    observing_body: O,
 ) -> Result<(State, SpiceDouble), Error>
 where
+    T: Into<SpiceInt>,
     R: Into<StringParam<'r>>,
+    O: Into<SpiceInt>,
 {
     with_spice_lock_or_panic(|| {
         let mut pos_vel: [SpiceDouble; 6] = [0.0; 6];
         let mut light_time = 0.0;
         unsafe {
             spkez_c(
-                target,
+                target.into(),
                 et.0,
                 reference_frame.into().as_mut_ptr(),
                 aberration_correction.as_spice_char(),
-                observing_body,
+                observing_body.into(),
                 pos_vel.as_mut_ptr(),
                 &mut light_time,
             )
@@ -100,26 +107,28 @@ where
 /// and stellar aberration.
 ///
 /// See [spkezp_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkezp_c.html).
-pub fn easy_position<'r, R>(
-    target: i32,
+pub fn easy_position<'r, T, R, O>(
+    target: T,
     et: Et,
     reference_frame: R,
     aberration_correction: AberrationCorrection,
-    observing_body: i32,
+    observing_body: O,
 ) -> Result<(Rectangular, SpiceDouble), Error>
 where
+    T: Into<SpiceInt>,
     R: Into<StringParam<'r>>,
+    O: Into<SpiceInt>,
 {
     with_spice_lock_or_panic(|| {
         let mut position = [0.0f64; 3];
         let mut light_time = 0.0;
         unsafe {
             spkezp_c(
-                target,
+                target.into(),
                 et.0,
                 reference_frame.into().as_mut_ptr(),
                 aberration_correction.as_spice_char(),
-                observing_body,
+                observing_body.into(),
                 position.as_mut_ptr(),
                 &mut light_time,
             )
@@ -165,10 +174,124 @@ where
     })
 }
 
+/// Return the geometric state (position and velocity) of a target body relative to an observing
+/// body.
+///
+/// See [spkgeo_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkgeo_c.html).
+pub fn geometric_state<'r, T, R, O>(
+    target: T,
+    et: Et,
+    reference_frame: R,
+    observing_body: O,
+) -> Result<(State, SpiceDouble), Error>
+where
+    T: Into<SpiceInt>,
+    R: Into<StringParam<'r>>,
+    O: Into<SpiceInt>,
+{
+    with_spice_lock_or_panic(|| {
+        let mut pos_vel = [0.0f64; 6];
+        let mut light_time = 0.0;
+        unsafe {
+            spkgeo_c(
+                target.into(),
+                et.0,
+                reference_frame.into().as_mut_ptr(),
+                observing_body.into(),
+                pos_vel.as_mut_ptr(),
+                &mut light_time,
+            )
+        };
+        get_last_error()?;
+        Ok((State::from(pos_vel), light_time))
+    })
+}
+
+/// Return the geometric states of a target body relative to an observing body at each of the
+/// given epochs, holding the SPICE lock and converting the frame name only once.
+///
+/// Evaluation stops at the first epoch for which the state cannot be computed.
+///
+/// See [spkgeo_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkgeo_c.html).
+pub fn geometric_states<'r, T, R, O>(
+    target: T,
+    ets: &[Et],
+    reference_frame: R,
+    observing_body: O,
+) -> Result<Vec<State>, Error>
+where
+    T: Into<SpiceInt>,
+    R: Into<StringParam<'r>>,
+    O: Into<SpiceInt>,
+{
+    let target = target.into();
+    let reference_frame = reference_frame.into();
+    let observing_body = observing_body.into();
+    with_spice_lock_or_panic(|| {
+        let mut states = Vec::with_capacity(ets.len());
+        for et in ets {
+            let mut pos_vel = [0.0f64; 6];
+            let mut light_time = 0.0;
+            unsafe {
+                spkgeo_c(
+                    target,
+                    et.0,
+                    reference_frame.as_mut_ptr(),
+                    observing_body,
+                    pos_vel.as_mut_ptr(),
+                    &mut light_time,
+                )
+            };
+            get_last_error()?;
+            states.push(State::from(pos_vel));
+        }
+        Ok(states)
+    })
+}
+
+/// Return the geometric position of a target body relative to an observing body.
+///
+/// See [spkgps_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkgps_c.html).
+pub fn geometric_position<'r, T, R, O>(
+    target: T,
+    et: Et,
+    reference_frame: R,
+    observing_body: O,
+) -> Result<(Rectangular, SpiceDouble), Error>
+where
+    T: Into<SpiceInt>,
+    R: Into<StringParam<'r>>,
+    O: Into<SpiceInt>,
+{
+    with_spice_lock_or_panic(|| {
+        let mut position = [0.0f64; 3];
+        let mut light_time = 0.0;
+        unsafe {
+            spkgps_c(
+                target.into(),
+                et.0,
+                reference_frame.into().as_mut_ptr(),
+                observing_body.into(),
+                position.as_mut_ptr(),
+                &mut light_time,
+            )
+        };
+        get_last_error()?;
+        Ok((position.into(), light_time))
+    })
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
+    use crate::body::BodyId;
+    use crate::frame::Frame;
+    use crate::string::SpiceString;
     use crate::tests::load_test_data;
+    use cspice_sys::{
+        dafbfs_c, dafcls_c, daffna_c, dafgda_c, dafgs_c, dafopr_c, dafus_c, spkcls_c, spkopn_c,
+        spksub_c, SpiceBoolean, SPICEFALSE,
+    };
     const EPSILON: f64 = 1e-10;
     const ETS: [Et; 3] = [Et(0.0), Et(3600.0), Et(120000.0)];
     const LTS: [SpiceDouble; 3] = [
@@ -271,4 +394,107 @@ mod tests {
             assert!((lt - LTS[i]).abs() < EPSILON);
         }
     }
+
+    #[test]
+    fn moon_earth_resolved_test() {
+        load_test_data();
+        let moon = BodyId::from_name("moon").unwrap().unwrap();
+        let earth = BodyId::from_name("earth").unwrap().unwrap();
+        let j2000 = Frame::from_name("j2000").unwrap().unwrap();
+        for et in ETS {
+            let (expected, expected_lt) =
+                easier_reader("moon", et, "J2000", AberrationCorrection::NONE, "earth").unwrap();
+            let (state, lt) =
+                easy_reader(moon, et, &j2000, AberrationCorrection::NONE, earth).unwrap();
+            assert_eq!(state, expected);
+            assert_eq!(lt, expected_lt);
+            let (state, lt) = geometric_state(moon, et, &j2000, earth).unwrap();
+            assert!((state.position.x - expected.position.x).abs() < EPSILON);
+            assert!((state.velocity[2] - expected.velocity[2]).abs() < EPSILON);
+            assert!((lt - expected_lt).abs() < EPSILON);
+            let (position, _) = geometric_position(moon, et, &j2000, earth).unwrap();
+            assert!((position.y - expected.position.y).abs() < EPSILON);
+        }
+    }
+
+    /// The descriptor of the next segment in the DAF being searched, with its double precision and
+    /// integer components.
+    unsafe fn next_segment() -> Option<([SpiceDouble; 5], [SpiceDouble; 2], [SpiceInt; 6])> {
+        let mut found: SpiceBoolean = SPICEFALSE as SpiceBoolean;
+        daffna_c(&mut found);
+        if found == SPICEFALSE as SpiceBoolean {
+            return None;
+        }
+        let mut descr = [0.0; 5];
+        let mut dc = [0.0; 2];
+        let mut ic = [0; 6];
+        dafgs_c(descr.as_mut_ptr());
+        dafus_c(descr.as_ptr(), 2, 6, dc.as_mut_ptr(), ic.as_mut_ptr());
+        Some((descr, dc, ic))
+    }
+
+    /// The data of the segment with integer components `ic`.
+    unsafe fn segment_data(handle: SpiceInt, ic: &[SpiceInt; 6]) -> Vec<SpiceDouble> {
+        let mut data = vec![0.0; (ic[5] - ic[4] + 1) as usize];
+        dafgda_c(handle, ic[4], ic[5], data.as_mut_ptr());
+        data
+    }
+
+    #[test]
+    fn test_subset() {
+        load_test_data();
+        let source = SpiceString::from(
+            std::path::PathBuf::from(env!("CARGO_MANIFEST_DIR"))
+                .join("test_data/de432s.bsp")
+                .to_string_lossy(),
+        );
+        let path =
+            std::env::temp_dir().join(format!("cspice-test-{}-subset.bsp", std::process::id()));
+        let _ = std::fs::remove_file(&path);
+        let file = SpiceString::from(path.to_string_lossy());
+        unsafe {
+            let mut handle = 0;
+            let mut new = 0;
+            dafopr_c(source.as_mut_ptr(), &mut handle);
+            spkopn_c(file.as_mut_ptr(), file.as_mut_ptr(), 0, &mut new);
+            dafbfs_c(handle);
+            let (mut descr, dc, ic) = next_segment().unwrap();
+            let middle = (dc[0] + dc[1]) / 2.0;
+            // The whole segment is copied in bulk; half of it is subset by segment type
+            spksub_c(
+                handle,
+                descr.as_mut_ptr(),
+                file.as_mut_ptr(),
+                dc[0],
+                dc[1],
+                new,
+            );
+            spksub_c(
+                handle,
+                descr.as_mut_ptr(),
+                file.as_mut_ptr(),
+                dc[0],
+                middle,
+                new,
+            );
+            spkcls_c(new);
+            get_last_error().unwrap();
+
+            let mut copy = 0;
+            dafopr_c(file.as_mut_ptr(), &mut copy);
+            dafbfs_c(copy);
+            let (_, whole_dc, whole_ic) = next_segment().unwrap();
+            assert_eq!(whole_dc, dc);
+            assert_eq!(whole_ic[..4], ic[..4]);
+            assert_eq!(segment_data(copy, &whole_ic), segment_data(handle, &ic));
+            let (_, half_dc, half_ic) = next_segment().unwrap();
+            assert_eq!(half_dc, [dc[0], middle]);
+            assert!(half_ic[5] - half_ic[4] < ic[5] - ic[4]);
+            assert!(next_segment().is_none());
+            dafcls_c(copy);
+            dafcls_c(handle);
+        }
+        get_last_error().unwrap();
+        std::fs::remove_file(&path).unwrap();
+    }
 }
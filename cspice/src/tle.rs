@@ -0,0 +1,601 @@
+//! Propagating NORAD two-line element sets with SGP4.
+//!
+//! [evaluate()] initializes its element set on every call. An [Sgp4Batch] initializes each of a
+//! set of element sets once, and then evaluates all of them at any number of epochs, giving
+//! exactly the states that [evaluate()] would.
+//!
+//! A [Catalog] reads a file of element sets for many objects once, validates and sorts the element
+//! sets of each object in parallel, and writes them to an SPK file as one type 10 segment per
+//! object.
+use crate::error::get_last_error;
+use crate::spk::State;
+use crate::string::{static_spice_str, SpiceString, StaticSpiceStr};
+use crate::time::Et;
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{
+    evsgp4_c, getelm_c, sgp4ev_c, sgp4in_c, spkcls_c, spkopn_c, spkw10_c, SpiceChar, SpiceDouble,
+    SpiceInt, SPICE_SGP4_RECLEN,
+};
+use std::collections::HashMap;
+use std::ffi::c_void;
+use std::io::ErrorKind;
+use std::path::Path;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::Mutex;
+use std::thread;
+
+/// Length of each line buffer passed to getelm_c.
+const TLELLN: usize = 70;
+
+const RECLEN: usize = SPICE_SGP4_RECLEN as usize;
+
+/// Two-digit epoch years are taken to be no earlier than this year, the year of the first launch.
+pub const FIRST_YEAR: SpiceInt = 1957;
+
+/// The geophysical constants used by SGP4, in the order J2, J3, J4, KE, QO, SO, ER, AE.
+///
+/// See [evsgp4_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/evsgp4_c.html) for
+/// their meanings and units.
+pub type GeophysicalConstants = [SpiceDouble; 8];
+
+/// The elements of a two-line element set, as returned by [parse_elements()].
+pub type Elements = [SpiceDouble; 10];
+
+/// The recommended geophysical constants.
+pub const GEOPHYSICAL_CONSTANTS: GeophysicalConstants = [
+    1.082616e-3,
+    -2.53881e-6,
+    -1.65597e-6,
+    7.43669161e-2,
+    120.0,
+    78.0,
+    6378.135,
+    1.0,
+];
+
+/// Parse the two lines of a two-line element set, returning the epoch of the elements and the
+/// elements. Two-digit years are taken to be no earlier than `first_year`.
+///
+/// See [getelm_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/getelm_c.html).
+pub fn parse_elements(first_year: SpiceInt, lines: [&str; 2]) -> Result<(Et, Elements), Error> {
+    let mut buffer = [0 as SpiceChar; 2 * TLELLN];
+    for (line, chunk) in lines.iter().zip(buffer.chunks_mut(TLELLN)) {
+        if line.len() >= TLELLN {
+            return Err(Error::new(
+                "SPICE(STRINGTOOLONG)",
+                format!("The line \"{line}\" is longer than a two-line element set line."),
+            ));
+        }
+        for (c, b) in chunk.iter_mut().zip(line.bytes()) {
+            *c = b as SpiceChar;
+        }
+    }
+    with_spice_lock_or_panic(|| {
+        let mut epoch = 0.0;
+        let mut elements = [0.0; 10];
+        unsafe {
+            getelm_c(
+                first_year,
+                TLELLN as SpiceInt,
+                buffer.as_ptr() as *const c_void,
+                &mut epoch,
+                elements.as_mut_ptr(),
+            )
+        };
+        get_last_error()?;
+        Ok((Et(epoch), elements))
+    })
+}
+
+/// Evaluate a two-line element set at an epoch. The state is relative to the TEME frame.
+///
+/// See [evsgp4_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/evsgp4_c.html).
+pub fn evaluate(
+    et: Et,
+    constants: &GeophysicalConstants,
+    elements: &Elements,
+) -> Result<State, Error> {
+    with_spice_lock_or_panic(|| {
+        let mut state = [0.0; 6];
+        unsafe {
+            evsgp4_c(
+                et.0,
+                constants.as_ptr() as *mut SpiceDouble,
+                elements.as_ptr() as *mut SpiceDouble,
+                state.as_mut_ptr(),
+            )
+        };
+        get_last_error()?;
+        Ok(State::from(state))
+    })
+}
+
+/// A set of two-line element sets, each initialized once for evaluation at many epochs.
+#[derive(Clone, Debug)]
+pub struct Sgp4Batch {
+    constants: GeophysicalConstants,
+    elements: Vec<Elements>,
+    records: Vec<[SpiceDouble; RECLEN]>,
+}
+
+impl Sgp4Batch {
+    /// Initialize each of `elements`.
+    ///
+    /// See [sgp4in_c](https://github.com/jacob-pro/cspice-rs/blob/master/cspice-fork/src/cspice/sgp4in_c.c).
+    pub fn new(constants: &GeophysicalConstants, elements: &[Elements]) -> Result<Self, Error> {
+        let mut records = vec![[0.0; RECLEN]; elements.len()];
+        with_spice_lock_or_panic(|| {
+            unsafe {
+                sgp4in_c(
+                    constants.as_ptr(),
+                    elements.len() as SpiceInt,
+                    elements.as_ptr(),
+                    records.as_mut_ptr(),
+                )
+            };
+            get_last_error()
+        })?;
+        Ok(Self {
+            constants: *constants,
+            elements: elements.to_vec(),
+            records,
+        })
+    }
+
+    /// The number of element sets.
+    pub fn len(&self) -> usize {
+        self.records.len()
+    }
+
+    /// Whether there are no element sets.
+    pub fn is_empty(&self) -> bool {
+        self.records.is_empty()
+    }
+
+    fn evaluate_records(
+        records: &[[SpiceDouble; RECLEN]],
+        ets: &[Et],
+    ) -> Result<Vec<State>, Error> {
+        let ets: Vec<SpiceDouble> = ets.iter().map(|et| et.0).collect();
+        let mut states = vec![[0.0; 6]; records.len() * ets.len()];
+        with_spice_lock_or_panic(|| {
+            unsafe {
+                sgp4ev_c(
+                    records.len() as SpiceInt,
+                    records.as_ptr(),
+                    ets.len() as SpiceInt,
+                    ets.as_ptr(),
+                    states.as_mut_ptr(),
+                )
+            };
+            get_last_error()
+        })?;
+        Ok(states.into_iter().map(State::from).collect())
+    }
+
+    /// Evaluate every element set at every epoch. The state of element set `i` at epoch `j` is at
+    /// index `i * ets.len() + j`. Fails if any evaluation fails.
+    ///
+    /// See [sgp4ev_c](https://github.com/jacob-pro/cspice-rs/blob/master/cspice-fork/src/cspice/sgp4ev_c.c).
+    pub fn propagate(&self, ets: &[Et]) -> Result<Vec<State>, Error> {
+        Self::evaluate_records(&self.records, ets)
+    }
+
+    /// Evaluate each element set at every epoch separately, so that an element set that cannot be
+    /// evaluated, such as one for a decayed orbit, does not prevent the others being evaluated.
+    pub fn propagate_each(&self, ets: &[Et]) -> Vec<Result<Vec<State>, Error>> {
+        self.records
+            .chunks(1)
+            .map(|record| Self::evaluate_records(record, ets))
+            .collect()
+    }
+
+    /// Evaluate every element set at every epoch both with [propagate()](Self::propagate) and
+    /// with [evaluate()], returning the element set and epoch indices of every state that is not
+    /// identical to the last bit.
+    pub fn compare(&self, ets: &[Et]) -> Result<Vec<(usize, usize)>, Error> {
+        let states = self.propagate(ets)?;
+        let mut mismatches = Vec::new();
+        for (i, elements) in self.elements.iter().enumerate() {
+            for (j, &et) in ets.iter().enumerate() {
+                let expected = evaluate(et, &self.constants, elements)?;
+                let state = &states[i * ets.len() + j];
+                let bits = |s: &State| {
+                    [
+                        s.position.x,
+                        s.position.y,
+                        s.position.z,
+                        s.velocity[0],
+                        s.velocity[1],
+                        s.velocity[2],
+                    ]
+                    .map(f64::to_bits)
+                };
+                if bits(state) != bits(&expected) {
+                    mismatches.push((i, j));
+                }
+            }
+        }
+        Ok(mismatches)
+    }
+}
+
+/// The two-line element sets of one object in a [Catalog].
+#[derive(Clone, Debug)]
+pub struct CatalogObject {
+    catalog_number: u32,
+    lines: Vec<[String; 2]>,
+}
+
+impl CatalogObject {
+    /// The NORAD catalog number of the object.
+    pub fn catalog_number(&self) -> u32 {
+        self.catalog_number
+    }
+
+    /// The element sets of the object, in increasing order of epoch, with only the first of any
+    /// element sets having the same epoch.
+    pub fn lines(&self) -> &[[String; 2]] {
+        &self.lines
+    }
+
+    /// The ID of the object in SPK files written by [Catalog::write_spk()]. This is the default
+    /// used by MKSPK.
+    pub fn spk_id(&self) -> SpiceInt {
+        -100000 - self.catalog_number as SpiceInt
+    }
+}
+
+/// A line pair read from a catalog, with the number of its first line.
+struct Entry<'t> {
+    line_number: usize,
+    lines: [&'t str; 2],
+}
+
+/// The checksum of a line of a two-line element set: the sum of its digits, with each minus sign
+/// counting as one, modulo 10.
+fn checksum(line: &str) -> u32 {
+    line.bytes()
+        .take(68)
+        .map(|b| match b {
+            b'0'..=b'9' => (b - b'0') as u32,
+            b'-' => 1,
+            _ => 0,
+        })
+        .sum::<u32>()
+        % 10
+}
+
+/// Check the line pair of `entry`, returning the epoch as a year and day of year for sorting.
+fn check_entry(entry: &Entry, catalog_number: u32) -> Result<(i32, f64), Error> {
+    let bad = |reason: String| {
+        Error::new(
+            "SPICE(BADTLE)",
+            format!(
+                "Error in the two-line element set at line {}: {reason}",
+                entry.line_number
+            ),
+        )
+    };
+    for (i, line) in entry.lines.iter().enumerate() {
+        let expected = line
+            .as_bytes()
+            .get(68)
+            .filter(|b| b.is_ascii_digit())
+            .map(|b| (b - b'0') as u32)
+            .ok_or_else(|| bad(format!("line {} has no checksum.", i + 1)))?;
+        if checksum(line) != expected {
+            return Err(bad(format!(
+                "the checksum of line {} is {}, not {expected}.",
+                i + 1,
+                checksum(line)
+            )));
+        }
+        if line.get(2..7).and_then(|n| n.trim().parse().ok()) != Some(catalog_number) {
+            return Err(bad(format!(
+                "the catalog number of line {} is not {catalog_number}.",
+                i + 1
+            )));
+        }
+    }
+    let year: i32 = entry.lines[0]
+        .get(18..20)
+        .and_then(|y| y.trim().parse().ok())
+        .ok_or_else(|| bad("the epoch year is not an integer.".to_string()))?;
+    let day: f64 = entry.lines[0]
+        .get(20..32)
+        .and_then(|d| d.trim().parse().ok())
+        .ok_or_else(|| bad("the epoch day of year is not a number.".to_string()))?;
+    let century = if 1900 + year < FIRST_YEAR { 2000 } else { 1900 };
+    Ok((century + year, day))
+}
+
+/// The element sets of a catalog of objects, as distributed in two-line element set files.
+#[derive(Clone, Debug)]
+pub struct Catalog {
+    objects: Vec<CatalogObject>,
+}
+
+impl Catalog {
+    /// Read the catalog at `path`, using up to `threads` threads to check and sort the element
+    /// sets of each object.
+    pub fn read<P: AsRef<Path>>(path: P, threads: usize) -> Result<Self, Error> {
+        let path = path.as_ref();
+        let text = std::fs::read_to_string(path).map_err(|error| {
+            let short_message = match error.kind() {
+                ErrorKind::NotFound => "SPICE(NOSUCHFILE)",
+                _ => "SPICE(FILEREADFAILED)",
+            };
+            Error::new(
+                short_message,
+                format!("The catalog {} could not be read: {error}", path.display()),
+            )
+        })?;
+        Self::parse(&text, threads)
+    }
+
+    /// Parse the text of a catalog, using up to `threads` threads to check and sort the element
+    /// sets of each object.
+    ///
+    /// Lines that are not part of an element set, such as object names, are ignored. Every
+    /// element set must have correct checksums; the error for the first one in the text that does
+    /// not is returned.
+    pub fn parse(text: &str, threads: usize) -> Result<Self, Error> {
+        let lines: Vec<&str> = text.lines().map(str::trim_end).collect();
+        let mut groups: HashMap<u32, Vec<Entry>> = HashMap::new();
+        let mut index = 0;
+        while index < lines.len() {
+            if !lines[index].starts_with("1 ") {
+                index += 1;
+                continue;
+            }
+            let entry = Entry {
+                line_number: index + 1,
+                lines: [
+                    lines[index],
+                    lines.get(index + 1).copied().unwrap_or_default(),
+                ],
+            };
+            if !entry.lines[1].starts_with("2 ") {
+                return Err(Error::new(
+                    "SPICE(NOSECONDLINE)",
+                    format!(
+                        "The element set at line {} has no second line.",
+                        entry.line_number
+                    ),
+                ));
+            }
+            let catalog_number = entry.lines[0]
+                .get(2..7)
+                .and_then(|n| n.trim().parse().ok())
+                .ok_or_else(|| {
+                    Error::new(
+                        "SPICE(BADTLE)",
+                        format!(
+                            "The catalog number of the element set at line {} is not an integer.",
+                            entry.line_number
+                        ),
+                    )
+                })?;
+            groups.entry(catalog_number).or_default().push(entry);
+            index += 2;
+        }
+        let mut groups: Vec<(u32, Vec<Entry>)> = groups.into_iter().collect();
+        groups.sort_by_key(|(catalog_number, _)| *catalog_number);
+
+        let next = AtomicUsize::new(0);
+        let objects = Mutex::new(Vec::with_capacity(groups.len()));
+        let errors = Mutex::new(Vec::new());
+        thread::scope(|scope| {
+            for _ in 0..threads.clamp(1, groups.len().max(1)) {
+                scope.spawn(|| loop {
+                    let index = next.fetch_add(1, Ordering::Relaxed);
+                    let Some((catalog_number, entries)) = groups.get(index) else {
+                        break;
+                    };
+                    match Self::sort_entries(*catalog_number, entries) {
+                        Ok(object) => objects.lock().unwrap().push((index, object)),
+                        Err(error) => errors.lock().unwrap().extend(error),
+                    }
+                });
+            }
+        });
+        let mut errors = errors.into_inner().unwrap();
+        errors.sort_by_key(|(line_number, _)| *line_number);
+        if let Some((_, error)) = errors.into_iter().next() {
+            return Err(error);
+        }
+        let mut objects = objects.into_inner().unwrap();
+        objects.sort_by_key(|(index, _)| *index);
+        Ok(Self {
+            objects: objects.into_iter().map(|(_, object)| object).collect(),
+        })
+    }
+
+    /// Check the element sets of one object and sort them by epoch, keeping only the first
+    /// element set with each epoch. Returns the errors with the line numbers they occur at.
+    fn sort_entries(
+        catalog_number: u32,
+        entries: &[Entry],
+    ) -> Result<CatalogObject, Vec<(usize, Error)>> {
+        let mut keyed = Vec::with_capacity(entries.len());
+        let mut errors = Vec::new();
+        for entry in entries {
+            match check_entry(entry, catalog_number) {
+                Ok(epoch) => keyed.push((epoch, entry)),
+                Err(error) => errors.push((entry.line_number, error)),
+            }
+        }
+        if !errors.is_empty() {
+            return Err(errors);
+        }
+        // The sort is stable, so the first of several element sets with the same epoch is kept
+        keyed.sort_by(|(a, _), (b, _)| a.0.cmp(&b.0).then(a.1.total_cmp(&b.1)));
+        keyed.dedup_by(|(a, _), (b, _)| a == b);
+        Ok(CatalogObject {
+            catalog_number,
+            lines: keyed
+                .into_iter()
+                .map(|(_, entry)| entry.lines.map(str::to_string))
+                .collect(),
+        })
+    }
+
+    /// The objects in the catalog, in increasing order of catalog number.
+    pub fn objects(&self) -> &[CatalogObject] {
+        &self.objects
+    }
+
+    /// Write a new SPK file containing a type 10 segment for each object, relative to the Earth
+    /// in the J2000 frame. The coverage of each segment extends `pad` seconds either side of the
+    /// epochs of the object's element sets.
+    ///
+    /// See [spkw10_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkw10_c.html).
+    pub fn write_spk<P: AsRef<Path>>(
+        &self,
+        path: P,
+        constants: &GeophysicalConstants,
+        pad: SpiceDouble,
+    ) -> Result<(), Error> {
+        let path = SpiceString::from(path.as_ref().to_string_lossy());
+        with_spice_lock_or_panic(|| {
+            let mut handle = 0;
+            unsafe {
+                spkopn_c(
+                    path.as_mut_ptr(),
+                    static_spice_str!("TLE CATALOG").as_mut_ptr(),
+                    0,
+                    &mut handle,
+                )
+            };
+            get_last_error()?;
+            let result = self.objects.iter().try_for_each(|object| {
+                let mut epochs = Vec::with_capacity(object.lines.len());
+                let mut elements = Vec::with_capacity(object.lines.len());
+                for lines in &object.lines {
+                    let (epoch, set) = parse_elements(FIRST_YEAR, [&lines[0], &lines[1]])?;
+                    epochs.push(epoch.0);
+                    elements.push(set);
+                }
+                let segment_id = SpiceString::from(format!("NORAD {}", object.catalog_number));
+                unsafe {
+                    spkw10_c(
+                        handle,
+                        object.spk_id(),
+                        399,
+                        static_spice_str!("J2000").as_mut_ptr(),
+                        epochs[0] - pad,
+                        epochs[epochs.len() - 1] + pad,
+                        segment_id.as_mut_ptr(),
+                        constants.as_ptr(),
+                        epochs.len() as SpiceInt,
+                        elements.as_ptr() as *const SpiceDouble,
+                        epochs.as_ptr(),
+                    )
+                };
+                get_last_error()
+            });
+            unsafe { spkcls_c(handle) };
+            result?;
+            get_last_error()
+        })
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::tests::load_test_data;
+
+    const TLES: [[&str; 2]; 2] = [
+        [
+            "1 43908U 18111AJ  20146.60805006  .00000806  00000-0  34965-4 0  9999",
+            "2 43908  97.2676  47.2136 0020001 220.6050 139.3698 15.24999521 78544",
+        ],
+        // A geosynchronous orbit, evaluated with the deep space terms
+        [
+            "1 28626U 05008A   06176.46683397 -.00000205  00000-0  10000-3 0  2190",
+            "2 28626   0.0019 286.9433 0000335  13.7918  55.6504  1.00270176  4891",
+        ],
+    ];
+
+    #[test]
+    fn test_sgp4_batch() {
+        load_test_data();
+        let elements: Vec<Elements> = TLES
+            .iter()
+            .map(|lines| parse_elements(1957, *lines).unwrap().1)
+            .collect();
+        let batch = Sgp4Batch::new(&GEOPHYSICAL_CONSTANTS, &elements).unwrap();
+        assert_eq!(batch.len(), 2);
+
+        let ets: Vec<Et> = elements
+            .iter()
+            .flat_map(|e| (-2..5).map(move |k| Et(e[9] + 43200.0 * k as f64)))
+            .collect();
+        let states = batch.propagate(&ets).unwrap();
+        assert_eq!(states.len(), 2 * ets.len());
+        assert_eq!(
+            states[ets.len() + 3],
+            evaluate(ets[3], &GEOPHYSICAL_CONSTANTS, &elements[1]).unwrap()
+        );
+        assert!(batch.compare(&ets).unwrap().is_empty());
+
+        let each = batch.propagate_each(&ets[..2]);
+        assert_eq!(each[1].as_ref().unwrap()[1], states[ets.len() + 1]);
+    }
+
+    #[test]
+    fn test_catalog() {
+        load_test_data();
+        let text = format!(
+            "LUME-1\n{}\n{}\n\
+             1 43908U 18111AJ  20147.12345678  .00000806  00000-0  34965-4 0  9991\n\
+             2 43908  97.2676  47.7136 0020001 220.6050 139.3698 15.24999521 78550\n\
+             INTELSAT\n{}\n{}\nLUME-1\n{}\n{}\n",
+            TLES[0][0], TLES[0][1], TLES[1][0], TLES[1][1], TLES[0][0], TLES[0][1]
+        );
+        let catalog = Catalog::parse(&text, 4).unwrap();
+        let objects = catalog.objects();
+        assert_eq!(objects.len(), 2);
+        assert_eq!(objects[0].catalog_number(), 28626);
+        assert_eq!(objects[1].catalog_number(), 43908);
+        assert_eq!(objects[1].spk_id(), -143908);
+        // Sorted by epoch, with the repeated element set dropped
+        assert_eq!(objects[1].lines().len(), 2);
+        assert_eq!(objects[1].lines()[0][0], TLES[0][0]);
+
+        let bad = text.replacen("78550", "78551", 1);
+        let error = Catalog::parse(&bad, 4).unwrap_err();
+        assert_eq!(error.short_message, "SPICE(BADTLE)");
+        assert!(error.long_message.contains("line 4"));
+
+        let path = std::env::temp_dir().join(format!("cspice-test-{}.bsp", std::process::id()));
+        let _ = std::fs::remove_file(&path);
+        catalog
+            .write_spk(&path, &GEOPHYSICAL_CONSTANTS, 86400.0)
+            .unwrap();
+        // Writing through a write buffer gives an identical file
+        let buffered = path.with_extension("buffered.bsp");
+        let _ = std::fs::remove_file(&buffered);
+        crate::data::set_write_buffer(2).unwrap();
+        let result = catalog.write_spk(&buffered, &GEOPHYSICAL_CONSTANTS, 86400.0);
+        crate::data::set_write_buffer(0).unwrap();
+        result.unwrap();
+        assert_eq!(
+            std::fs::read(&path).unwrap(),
+            std::fs::read(&buffered).unwrap()
+        );
+        std::fs::remove_file(&buffered).unwrap();
+        let path = path.to_string_lossy().to_string();
+        crate::data::furnish(&path).unwrap();
+        let (epoch, _) = parse_elements(FIRST_YEAR, TLES[0]).unwrap();
+        let state = crate::spk::geometric_state(-143908, epoch, "J2000", 399);
+        crate::data::unload(&path).unwrap();
+        std::fs::remove_file(&path).unwrap();
+        let (state, _) = state.unwrap();
+        let radius =
+            (state.position.x.powi(2) + state.position.y.powi(2) + state.position.z.powi(2)).sqrt();
+        assert!((6800.0..7100.0).contains(&radius));
+    }
+}
@@ -0,0 +1,327 @@
+//! Two-body propagation of states and conic elements.
+//!
+//! [propagate()] and [conic_state()] handle one state at a time. For large numbers of states, such
+//! as the samples of a Monte Carlo analysis, [StateArrays] holds states as a structure of arrays
+//! that [propagate_batch()] propagates in one call, and [propagate_parallel()] propagates on
+//! several threads. Every function gives exactly the states that
+//! [prop2b_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/prop2b_c.html) would.
+use crate::error::get_last_error;
+use crate::spk::State;
+use crate::time::Et;
+use crate::{with_spice_lock_or_panic, Error};
+use cspice_sys::{conics_c, conicv_c, prop2b_c, prop2v_c, SpiceDouble, SpiceInt};
+use std::os::raw::c_int;
+use std::thread;
+
+extern "C" {
+    // The propagator behind prop2v_c. It uses no saved variables and does not participate in error
+    // handling, so unlike the rest of SPICE it can be called without the SPICE lock.
+    fn zzprop2v_(
+        n: *mut SpiceInt,
+        ld: *mut SpiceInt,
+        gm: *mut SpiceDouble,
+        gmstep: *mut SpiceInt,
+        pvinit: *mut SpiceDouble,
+        dt: *mut SpiceDouble,
+        dtstep: *mut SpiceInt,
+        pvprop: *mut SpiceDouble,
+        fail: *mut SpiceInt,
+        code: *mut SpiceInt,
+    ) -> c_int;
+
+    // Signals the SPICE error for a failure reported by zzprop2v_.
+    fn zzp2verr_(fail: *mut SpiceInt, code: *mut SpiceInt) -> c_int;
+}
+
+/// Conic elements, in the order and units used by
+/// [conics_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/conics_c.html):
+/// perifocal distance, eccentricity, inclination, longitude of the ascending node, argument of
+/// periapse, mean anomaly at epoch, epoch and gravitational parameter.
+pub type ConicElements = [SpiceDouble; 8];
+
+/// States stored as a structure of arrays: the x positions of all the states, followed by the y
+/// positions, and so on to the z velocities.
+#[derive(Clone, Debug, PartialEq)]
+pub struct StateArrays {
+    len: usize,
+    components: Vec<SpiceDouble>,
+}
+
+impl StateArrays {
+    /// `len` states, all zero.
+    pub fn zeros(len: usize) -> Self {
+        Self {
+            len,
+            components: vec![0.0; 6 * len],
+        }
+    }
+
+    /// Store `states` as a structure of arrays.
+    pub fn from_states(states: &[State]) -> Self {
+        let mut arrays = Self::zeros(states.len());
+        for (i, state) in states.iter().enumerate() {
+            arrays.set(i, state);
+        }
+        arrays
+    }
+
+    /// The number of states.
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    /// Whether there are no states.
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// Component `k` of every state, where components 0 to 5 are x, y, z, dx/dt, dy/dt and dz/dt.
+    pub fn component(&self, k: usize) -> &[SpiceDouble] {
+        &self.components[k * self.len..(k + 1) * self.len]
+    }
+
+    /// Component `k` of every state, for modification.
+    pub fn component_mut(&mut self, k: usize) -> &mut [SpiceDouble] {
+        &mut self.components[k * self.len..(k + 1) * self.len]
+    }
+
+    /// The state at index `i`.
+    pub fn get(&self, i: usize) -> State {
+        State::from([0, 1, 2, 3, 4, 5].map(|k| self.components[k * self.len + i]))
+    }
+
+    /// Replace the state at index `i`.
+    pub fn set(&mut self, i: usize, state: &State) {
+        let values = [
+            state.position.x,
+            state.position.y,
+            state.position.z,
+            state.velocity.0[0],
+            state.velocity.0[1],
+            state.velocity.0[2],
+        ];
+        for (k, value) in values.into_iter().enumerate() {
+            self.components[k * self.len + i] = value;
+        }
+    }
+
+    /// The states, one after another.
+    pub fn to_states(&self) -> Vec<State> {
+        (0..self.len).map(|i| self.get(i)).collect()
+    }
+}
+
+/// Propagate a state relative to a central mass with gravitational parameter `gm` by `dt` seconds
+/// under two-body motion.
+///
+/// See [prop2b_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/prop2b_c.html).
+pub fn propagate(gm: SpiceDouble, state: &State, dt: SpiceDouble) -> Result<State, Error> {
+    let initial = StateArrays::from_states(std::slice::from_ref(state)).components;
+    with_spice_lock_or_panic(|| {
+        let mut propagated = [0.0; 6];
+        unsafe {
+            prop2b_c(
+                gm,
+                initial.as_ptr() as *mut SpiceDouble,
+                dt,
+                propagated.as_mut_ptr(),
+            )
+        };
+        get_last_error()?;
+        Ok(State::from(propagated))
+    })
+}
+
+/// Propagate every state by `dt` seconds, as [propagate()] would.
+///
+/// See [prop2v_c](https://github.com/jacob-pro/cspice-rs/blob/master/cspice-fork/src/cspice/prop2v_c.c).
+pub fn propagate_batch(
+    gm: SpiceDouble,
+    states: &StateArrays,
+    dt: SpiceDouble,
+) -> Result<StateArrays, Error> {
+    let mut propagated = StateArrays::zeros(states.len);
+    with_spice_lock_or_panic(|| {
+        unsafe {
+            prop2v_c(
+                gm,
+                states.len as SpiceInt,
+                states.components.as_ptr(),
+                dt,
+                propagated.components.as_mut_ptr(),
+            )
+        };
+        get_last_error()
+    })?;
+    Ok(propagated)
+}
+
+/// Propagate every state by `dt` seconds, as [propagate()] would, dividing the states between up
+/// to `threads` threads. The SPICE lock is held only if a state cannot be propagated.
+///
+/// If several states cannot be propagated, the error is that for the first of them.
+pub fn propagate_parallel(
+    gm: SpiceDouble,
+    states: &StateArrays,
+    dt: SpiceDouble,
+    threads: usize,
+) -> Result<StateArrays, Error> {
+    if gm <= 0.0 {
+        // Let prop2v_c report the error, however many states there are.
+        return propagate_batch(gm, states, dt);
+    }
+    let len = states.len;
+    let mut propagated = StateArrays::zeros(len);
+    let chunk = len.div_ceil(threads.clamp(1, len.max(1))).max(1);
+    let input = states.components.as_ptr() as usize;
+    let output = propagated.components.as_mut_ptr() as usize;
+    let failures: Vec<(SpiceInt, SpiceInt)> = thread::scope(|scope| {
+        let handles: Vec<_> = (0..len)
+            .step_by(chunk)
+            .map(|start| {
+                scope.spawn(move || {
+                    let mut n = chunk.min(len - start) as SpiceInt;
+                    let mut ld = len as SpiceInt;
+                    let mut gm = gm;
+                    let mut dt = dt;
+                    let (mut step, mut fail, mut code) = (0, 0, 0);
+                    // Each thread reads and writes only its own states, at offsets start..start+n
+                    // of each component.
+                    unsafe {
+                        zzprop2v_(
+                            &mut n,
+                            &mut ld,
+                            &mut gm,
+                            &mut step,
+                            (input as *mut SpiceDouble).add(start),
+                            &mut dt,
+                            &mut step,
+                            (output as *mut SpiceDouble).add(start),
+                            &mut fail,
+                            &mut code,
+                        )
+                    };
+                    (fail + (fail != 0) as SpiceInt * start as SpiceInt, code)
+                })
+            })
+            .collect();
+        handles
+            .into_iter()
+            .map(|handle| handle.join().unwrap())
+            .filter(|(fail, _)| *fail != 0)
+            .collect()
+    });
+    if let Some(&(mut fail, mut code)) = failures.first() {
+        with_spice_lock_or_panic(|| {
+            unsafe { zzp2verr_(&mut fail, &mut code) };
+            get_last_error()
+        })?;
+    }
+    Ok(propagated)
+}
+
+/// Determine the state of an orbiting body from conic elements at `et`.
+///
+/// See [conics_c](https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/conics_c.html).
+pub fn conic_state(elements: &ConicElements, et: Et) -> Result<State, Error> {
+    with_spice_lock_or_panic(|| {
+        let mut state = [0.0; 6];
+        unsafe {
+            conics_c(
+                elements.as_ptr() as *mut SpiceDouble,
+                et.0,
+                state.as_mut_ptr(),
+            )
+        };
+        get_last_error()?;
+        Ok(State::from(state))
+    })
+}
+
+/// Determine the states of many orbiting bodies from conic elements at `et`, as [conic_state()]
+/// would.
+///
+/// See [conicv_c](https://github.com/jacob-pro/cspice-rs/blob/master/cspice-fork/src/cspice/conicv_c.c).
+pub fn conic_states(elements: &[ConicElements], et: Et) -> Result<Vec<State>, Error> {
+    let mut states = vec![[0.0; 6]; elements.len()];
+    with_spice_lock_or_panic(|| {
+        unsafe {
+            conicv_c(
+                elements.len() as SpiceInt,
+                elements.as_ptr(),
+                et.0,
+                states.as_mut_ptr(),
+            )
+        };
+        get_last_error()
+    })?;
+    Ok(states.into_iter().map(State::from).collect())
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    const GM: SpiceDouble = 398600.4418;
+
+    /// States spread over elliptic and hyperbolic orbits, from a simple generator so that the test
+    /// is repeatable.
+    fn sample_states(len: usize) -> StateArrays {
+        let mut seed: u64 = 1;
+        let mut next = || {
+            seed = seed
+                .wrapping_mul(6364136223846793005)
+                .wrapping_add(1442695040888963407);
+            (seed >> 11) as f64 / (1u64 << 53) as f64 * 2.0 - 1.0
+        };
+        let mut states = StateArrays::zeros(len);
+        for i in 0..len {
+            let radius = 6600.0 + 30000.0 * next().abs();
+            let state = [
+                radius * next(),
+                radius * next(),
+                radius * next(),
+                12.0 * next(),
+                12.0 * next(),
+                12.0 * next(),
+            ];
+            states.set(i, &State::from(state));
+        }
+        states
+    }
+
+    #[test]
+    fn test_propagate_batch() {
+        let states = sample_states(500);
+        for dt in [-86400.0, -1.0, 0.0, 3600.0, 1e6] {
+            let batch = propagate_batch(GM, &states, dt).unwrap();
+            let parallel = propagate_parallel(GM, &states, dt, 3).unwrap();
+            assert_eq!(batch, parallel);
+            for i in 0..states.len() {
+                assert_eq!(batch.get(i), propagate(GM, &states.get(i), dt).unwrap());
+            }
+        }
+
+        let mut bad = states.clone();
+        bad.set(7, &State::from([0.0, 0.0, 0.0, 1.0, 0.0, 0.0]));
+        bad.set(400, &State::from([7000.0, 0.0, 0.0, 1.0, 0.0, 0.0]));
+        let error = propagate_parallel(GM, &bad, 60.0, 4).unwrap_err();
+        assert_eq!(error.short_message, "SPICE(ZEROPOSITION)");
+        assert!(error.long_message.contains("index 7"));
+        let error = propagate_batch(-1.0, &states, 60.0).unwrap_err();
+        assert_eq!(error.short_message, "SPICE(NONPOSITIVEMASS)");
+    }
+
+    #[test]
+    fn test_conic_states() {
+        let elements = [
+            [7000.0, 0.1, 0.5, 1.0, 2.0, 3.0, 0.0, GM],
+            [7000.0, 1.0, 0.5, 1.0, 2.0, 3.0, 0.0, GM],
+            [7000.0, 1.5, 0.5, 1.0, 2.0, 3.0, 0.0, GM],
+        ];
+        let states = conic_states(&elements, Et(1e5)).unwrap();
+        for (elements, state) in elements.iter().zip(&states) {
+            assert_eq!(*state, conic_state(elements, Et(1e5)).unwrap());
+        }
+    }
+}